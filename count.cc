@@ -2,11 +2,10 @@
 
 // TODO: get rid of the "include/" bit
 #include "include/rapidjson/filereadstream.h"
-#include "include/rapidjson/document.h"
-#include "include/rapidjson/writer.h"
-#include "include/rapidjson/stringbuffer.h"
+#include "include/rapidjson/elementreader.h"
 
 #include <cstdio>
+#include <cstring>
 
 #include <map>
 #include <string>
@@ -39,24 +38,38 @@ int main(int argc, char** argv) {
   }
 
   char readBuffer[65536];
-  FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-  Document d;
-  d.ParseStream(is);
-  fclose(fp);
 
-  assert(d.HasMember("type"));
-  assert(d["type"].IsString());
-  if (d["type"] != "FeatureCollection") {
-    cerr << "Expected type=FeatureCollection, got type=" << d["type"].GetString() << endl;
+  // Find the type first, skipping the members before it without decoding them.
+  string type;
+  {
+    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
+    GenericPullReader<UTF8<>, UTF8<>, FileReadStream> r(is);
+    ASSERT(r.Next() && r.GetToken() == kPullTokenStartObject, "not an object");
+    while (r.Next() && r.GetToken() == kPullTokenKey) {
+      if (strcmp(r.GetString(), "type") == 0) {
+        ASSERT(r.Next() && r.GetToken() == kPullTokenString, "type is not a string");
+        type = r.GetString();
+        break;
+      }
+      r.Skip();
+    }
+    ASSERT(!type.empty() || !r.HasParseError(), "parse error at offset " << r.GetErrorOffset());
+  }
+  if (type != "FeatureCollection") {
+    cerr << "Expected type=FeatureCollection, got type=" << type << endl;
     return 2;
   }
 
-  ASSERT(d.HasMember("features"), "Feature collection has no features");
-  ASSERT(d["features"].IsArray(), "features is not an array");
+  rewind(fp);
+  FileReadStream is(fp, readBuffer, sizeof(readBuffer));
+
+  // Only one feature is in memory at a time.
+  GenericElementReader<UTF8<>, FileReadStream> features(is, Pointer("/features"));
+  ASSERT(features.HasArray() || features.HasParseError(), "features is not an array");
 
   map<string, int> geometry_counts;
-  for (const auto& feature : d["features"].GetArray()) {
+  while (features.Next()) {
+    const auto& feature = features.GetElement();
     ASSERT(feature.HasMember("geometry"), "feature has no geometry");
     const auto& geometry = feature["geometry"];
     ASSERT(geometry.IsObject(), "geometry is not an object");
@@ -65,6 +78,8 @@ int main(int argc, char** argv) {
     ASSERT(type.IsString(), "geometry type is not a string");
     geometry_counts[type.GetString()]++;
   }
+  fclose(fp);
+  ASSERT(!features.HasParseError(), "parse error at offset " << features.GetErrorOffset());
 
   for (const auto type_count : geometry_counts) {
     cout << type_count.first << ": " << type_count.second << endl;
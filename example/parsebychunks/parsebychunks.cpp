@@ -0,0 +1,59 @@
+// Example of parsing JSON to document by chunks, without threads.
+
+#include "rapidjson/chunkedreader.h"
+#include "rapidjson/document.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/ostreamwrapper.h"
+#include <cstring>
+#include <iostream>
+
+using namespace rapidjson;
+
+// Sends the events of the chunks to the document, when given to Document::Populate().
+struct ChunkGenerator {
+    ChunkGenerator(const char* const* chunks) : chunks_(chunks), reader_() {}
+
+    template <typename Handler>
+    bool operator()(Handler& handler) {
+        // The chunks would typically come from a socket, as they arrive.
+        for (const char* const* chunk = chunks_; *chunk; chunk++)
+            if (!reader_.Feed(*chunk, std::strlen(*chunk), handler))
+                return false;
+        return reader_.Finish(handler);
+    }
+
+    const char* const* chunks_;
+    ChunkedReader reader_;
+
+private:
+    ChunkGenerator(const ChunkGenerator&);
+    ChunkGenerator& operator=(const ChunkGenerator&);
+};
+
+int main() {
+    const char* chunks[] = {
+        " { \"hello\" : \"world\", \"t\" : tr",
+        //" { \"hello\" : \"world\", \"t\" : trX", // For test parsing error
+        "ue, \"f\" : false, \"n\": null, \"i\":123, \"pi\": 3.14",
+        "16, \"a\":[1, 2, 3, 4] } ",
+        0
+    };
+
+    Document d;
+    ChunkGenerator g(chunks);
+    d.Populate(g);
+
+    if (g.reader_.HasParseError()) {
+        std::cout << "Error at offset " << g.reader_.GetErrorOffset() << ": " << GetParseError_En(g.reader_.GetParseErrorCode()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Stringify the JSON to cout
+    OStreamWrapper os(std::cout);
+    Writer<OStreamWrapper> writer(os);
+    d.Accept(writer);
+    std::cout << std::endl;
+
+    return EXIT_SUCCESS;
+}
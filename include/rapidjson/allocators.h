@@ -52,6 +52,28 @@ concept Allocator {
 \endcode
 */
 
+#if RAPIDJSON_ALLOCATION_STATS
+///////////////////////////////////////////////////////////////////////////////
+// AllocationStats
+
+//! Counters of the memory allocated for parsing.
+/*! Only collected with \ref RAPIDJSON_ALLOCATION_STATS. Allocators fill the
+    fields about blocks and chunks, readers those about the parsing stacks,
+    and documents all of them.
+*/
+struct AllocationStats {
+    AllocationStats() : allocationCount(), allocatedBytes(), chunkCount(), chunkBytes(), stackResizeCount(), stackBytes(), peakStackSize() {}
+
+    size_t allocationCount;     //!< Blocks allocated with Malloc() or by Realloc().
+    size_t allocatedBytes;      //!< Bytes of these blocks, and of blocks expanded in place.
+    size_t chunkCount;          //!< Chunks allocated by MemoryPoolAllocator from its base allocator.
+    size_t chunkBytes;          //!< Capacity of these chunks in bytes.
+    size_t stackResizeCount;    //!< Allocations and expansions of the parsing stacks.
+    size_t stackBytes;          //!< Bytes requested by these.
+    size_t peakStackSize;       //!< Largest size of the parsing stack in bytes (of values for a document, of strings for a reader).
+};
+#endif // RAPIDJSON_ALLOCATION_STATS
+
 ///////////////////////////////////////////////////////////////////////////////
 // CrtAllocator
 
@@ -62,9 +84,17 @@ concept Allocator {
 class CrtAllocator {
 public:
     static const bool kNeedFree = true;
+#if RAPIDJSON_ALLOCATION_STATS
+    CrtAllocator() : stats_() {}
+#endif
     void* Malloc(size_t size) { 
-        if (size) //  behavior of malloc(0) is implementation defined.
+        if (size) { //  behavior of malloc(0) is implementation defined.
+#if RAPIDJSON_ALLOCATION_STATS
+            stats_.allocationCount++;
+            stats_.allocatedBytes += size;
+#endif
             return std::malloc(size);
+        }
         else
             return NULL; // standardize to returning NULL.
     }
@@ -74,9 +104,21 @@ public:
             std::free(originalPtr);
             return NULL;
         }
+#if RAPIDJSON_ALLOCATION_STATS
+        stats_.allocationCount++;
+        stats_.allocatedBytes += newSize;
+#endif
         return std::realloc(originalPtr, newSize);
     }
     static void Free(void *ptr) { std::free(ptr); }
+
+#if RAPIDJSON_ALLOCATION_STATS
+    //! Blocks allocated since construction.
+    const AllocationStats& GetAllocationStats() const { return stats_; }
+
+private:
+    AllocationStats stats_;
+#endif
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -109,6 +151,9 @@ public:
     */
     MemoryPoolAllocator(size_t chunkSize = kDefaultChunkCapacity, BaseAllocator* baseAllocator = 0) : 
         chunkHead_(0), chunk_capacity_(chunkSize), userBuffer_(0), baseAllocator_(baseAllocator), ownBaseAllocator_(0)
+#if RAPIDJSON_ALLOCATION_STATS
+        , stats_()
+#endif
     {
     }
 
@@ -124,6 +169,9 @@ public:
     */
     MemoryPoolAllocator(void *buffer, size_t size, size_t chunkSize = kDefaultChunkCapacity, BaseAllocator* baseAllocator = 0) :
         chunkHead_(0), chunk_capacity_(chunkSize), userBuffer_(buffer), baseAllocator_(baseAllocator), ownBaseAllocator_(0)
+#if RAPIDJSON_ALLOCATION_STATS
+        , stats_()
+#endif
     {
         RAPIDJSON_ASSERT(buffer != 0);
         RAPIDJSON_ASSERT(size > sizeof(ChunkHeader));
@@ -152,6 +200,76 @@ public:
             chunkHead_->size = 0; // Clear user buffer
     }
 
+    //! Deallocates all memory blocks, but keeps enough memory to allocate them again.
+    /*! The memory is kept in a single chunk: the user buffer if it is large
+        enough, or else the largest chunk, replaced by a chunk holding all the
+        blocks if it is too small. So repeating the same allocations after
+        Reset() does not call the base allocator anymore, which makes it
+        suitable to reuse the allocator for a stream of similar documents.
+    */
+    void Reset() {
+        size_t size = 0;
+        ChunkHeader* largest = 0;
+        for (ChunkHeader* c = chunkHead_; c != 0; c = c->next) {
+            size += c->size;
+            if (c != userBuffer_ && (largest == 0 || c->capacity > largest->capacity))
+                largest = c;
+        }
+        if (userBuffer_ && size <= reinterpret_cast<ChunkHeader*>(userBuffer_)->capacity)
+            largest = 0, size = 0;  // Everything fits in the user buffer
+        else if (largest && largest->capacity < size)
+            largest = 0;            // Replaced by a chunk of all blocks
+
+        while (chunkHead_ && chunkHead_ != userBuffer_) {
+            ChunkHeader* next = chunkHead_->next;
+            if (chunkHead_ != largest)
+                baseAllocator_->Free(chunkHead_);
+            chunkHead_ = next;
+        }
+        if (chunkHead_ && chunkHead_ == userBuffer_)
+            chunkHead_->size = 0; // Clear user buffer
+
+        if (largest) {
+            largest->size = 0;
+            largest->next = chunkHead_;
+            chunkHead_ = largest;
+        }
+        else if (size > 0)
+            AddChunk(chunk_capacity_ > size ? chunk_capacity_ : size);
+    }
+
+    //! Takes over the memory chunks of another allocator.
+    /*! The blocks allocated by \c rhs stay valid and are now owned by this
+        allocator, which deallocates them with its own base allocator; \c rhs
+        is left empty. This lets values built with separate allocators, e.g. on
+        several threads, be combined into one document without copying them.
+        \param rhs Allocator without a user buffer, whose chunks the base
+            allocator of this one can free (as with the stateless CrtAllocator).
+    */
+    void Adopt(MemoryPoolAllocator& rhs) {
+        RAPIDJSON_ASSERT(&rhs != this);
+        RAPIDJSON_ASSERT(rhs.userBuffer_ == 0);
+        if (!rhs.chunkHead_)
+            return;
+        if (!baseAllocator_)
+            ownBaseAllocator_ = baseAllocator_ = RAPIDJSON_NEW(BaseAllocator());
+
+        // The chunks go in front, since a user buffer must stay the last chunk.
+        ChunkHeader* last = rhs.chunkHead_;
+        while (last->next)
+            last = last->next;
+        last->next = chunkHead_;
+        chunkHead_ = rhs.chunkHead_;
+        rhs.chunkHead_ = 0;
+#if RAPIDJSON_ALLOCATION_STATS
+        stats_.allocationCount += rhs.stats_.allocationCount;
+        stats_.allocatedBytes += rhs.stats_.allocatedBytes;
+        stats_.chunkCount += rhs.stats_.chunkCount;
+        stats_.chunkBytes += rhs.stats_.chunkBytes;
+        rhs.stats_ = AllocationStats();
+#endif
+    }
+
     //! Computes the total capacity of allocated memory chunks.
     /*! \return total capacity in bytes.
     */
@@ -180,6 +298,10 @@ public:
         size = RAPIDJSON_ALIGN(size);
         if (chunkHead_ == 0 || chunkHead_->size + size > chunkHead_->capacity)
             AddChunk(chunk_capacity_ > size ? chunk_capacity_ : size);
+#if RAPIDJSON_ALLOCATION_STATS
+        stats_.allocationCount++;
+        stats_.allocatedBytes += size;
+#endif
 
         void *buffer = reinterpret_cast<char *>(chunkHead_) + RAPIDJSON_ALIGN(sizeof(ChunkHeader)) + chunkHead_->size;
         chunkHead_->size += size;
@@ -206,6 +328,9 @@ public:
             size_t increment = static_cast<size_t>(newSize - originalSize);
             if (chunkHead_->size + increment <= chunkHead_->capacity) {
                 chunkHead_->size += increment;
+#if RAPIDJSON_ALLOCATION_STATS
+                stats_.allocatedBytes += increment;
+#endif
                 return originalPtr;
             }
         }
@@ -221,6 +346,11 @@ public:
     //! Frees a memory block (concept Allocator)
     static void Free(void *ptr) { (void)ptr; } // Do nothing
 
+#if RAPIDJSON_ALLOCATION_STATS
+    //! Blocks and chunks allocated since construction.
+    const AllocationStats& GetAllocationStats() const { return stats_; }
+#endif
+
 private:
     //! Copy constructor is not permitted.
     MemoryPoolAllocator(const MemoryPoolAllocator& rhs) /* = delete */;
@@ -238,6 +368,10 @@ private:
         chunk->size = 0;
         chunk->next = chunkHead_;
         chunkHead_ =  chunk;
+#if RAPIDJSON_ALLOCATION_STATS
+        stats_.chunkCount++;
+        stats_.chunkBytes += capacity;
+#endif
     }
 
     static const int kDefaultChunkCapacity = 64 * 1024; //!< Default chunk capacity.
@@ -256,6 +390,9 @@ private:
     void *userBuffer_;          //!< User supplied buffer.
     BaseAllocator* baseAllocator_;  //!< base allocator for allocating memory chunks.
     BaseAllocator* ownBaseAllocator_;   //!< base allocator created by this object.
+#if RAPIDJSON_ALLOCATION_STATS
+    AllocationStats stats_;     //!< Counters since construction.
+#endif
 };
 
 RAPIDJSON_NAMESPACE_END
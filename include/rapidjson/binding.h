@@ -0,0 +1,595 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_BINDING_H_
+#define RAPIDJSON_BINDING_H_
+
+/*! \file binding.h */
+
+#include "reader.h"
+#include "keyset.h"
+#include "internal/stack.h"
+#include "internal/strfunc.h"
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// StructBinding
+
+//! Declaration of the members of a struct, for GenericBindingHandler and WriteStruct().
+/*!
+    The fields are declared by calling the \c Fields functor with the name and
+    the member pointer of each one, in the order in which they are written:
+
+    \code
+    struct Point {
+        int x, y;
+        template <typename Fields>
+        static void Bind(Fields& f) { f("x", &Point::x)("y", &Point::y); }
+    };
+    \endcode
+
+    By default, the static member template \c Bind() of the struct is called.
+    A struct which cannot be changed is declared by specializing StructBinding
+    instead:
+
+    \code
+    namespace rapidjson {
+    template <> struct StructBinding<Point> {
+        template <typename Fields>
+        static void Declare(Fields& f) { f("x", &Point::x)("y", &Point::y); }
+    };
+    }
+    \endcode
+
+    A field can be a \c bool, \c int, \c unsigned, \c int64_t, \c uint64_t,
+    \c float, \c double, \c std::basic_string of the character type, another
+    bound struct, or a \c std::vector of any of these. Structs must be default
+    constructible.
+*/
+template <typename T>
+struct StructBinding {
+    template <typename Fields>
+    static void Declare(Fields& fields) { T::Bind(fields); }
+};
+
+namespace internal {
+
+///////////////////////////////////////////////////////////////////////////////
+// BindingType
+
+template <typename Ch>
+class BindingFieldTable;
+
+//! How a bound C++ type receives the parsed values.
+/*! The setters return false if the value does not fit the type. */
+template <typename Ch>
+struct BindingType {
+    enum Kind {
+        kScalarKind,
+        kStructKind,
+        kArrayKind
+    };
+
+    Kind kind;
+    bool (*setBool)(void* target, bool b);
+    bool (*setInt64)(void* target, int64_t i);
+    bool (*setUint64)(void* target, uint64_t u);
+    bool (*setDouble)(void* target, double d);
+    bool (*setString)(void* target, const Ch* str, SizeType length);
+    void* (*append)(void* target);                      //!< Array: adds an element and returns it.
+    void (*clear)(void* target);                        //!< Array: removes the elements.
+    const BindingType& (*element)();                    //!< Array: type of the elements.
+    const BindingFieldTable<Ch>& (*fields)();           //!< Struct: the fields.
+};
+
+//! Setters of the values a type does not accept.
+template <typename Ch>
+struct BindingReject {
+    static bool Bool(void*, bool) { return false; }
+    static bool Int64(void*, int64_t) { return false; }
+    static bool Uint64(void*, uint64_t) { return false; }
+    static bool Double(void*, double) { return false; }
+    static bool String(void*, const Ch*, SizeType) { return false; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// BindingFieldTable
+
+//! Field of a bound struct.
+template <typename Ch>
+struct BindingField {
+    size_t offset;                                  //!< Offset of the member in the struct.
+    const BindingType<Ch>& (*type)();
+};
+
+//! Fields of a bound struct, found by name with a GenericKeySet.
+template <typename Ch>
+class BindingFieldTable {
+public:
+    typedef BindingField<Ch> Field;
+
+    BindingFieldTable() : names_(), fields_() {}
+
+    void Add(const Ch* name, size_t offset, const BindingType<Ch>& (*type)()) {
+        names_.Add(GenericStringRef<Ch>(name));    // fields must have different names
+        const Field f = { offset, type };
+        fields_.push_back(f);
+    }
+
+    //! Field of the name, or 0.
+    const Field* Find(const Ch* name, SizeType length) const {
+        const int id = names_.Find(name, length);
+        return id >= 0 ? &fields_[static_cast<size_t>(id)] : 0;
+    }
+
+    //! Builds the perfect hash of the names added.
+    void Build() { names_.Build(); }
+
+private:
+    BindingFieldTable(const BindingFieldTable&);
+    BindingFieldTable& operator=(const BindingFieldTable&);
+
+    GenericKeySet<Ch> names_;
+    std::vector<Field> fields_;     //!< Field of each name ID.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// BindingTraits
+
+//! Parsing and writing of a bound type, a struct unless specialized.
+template <typename T, typename Ch>
+struct BindingTraits;
+
+//! Collects the fields of a struct into its table.
+template <typename S, typename Ch>
+class BindingFieldCollector {
+public:
+    explicit BindingFieldCollector(BindingFieldTable<Ch>& table) : table_(table), sample_() {}
+
+    template <typename T>
+    BindingFieldCollector& operator()(const Ch* name, T S::* member) {
+        const size_t offset = static_cast<size_t>(reinterpret_cast<const char*>(&(sample_.*member)) - reinterpret_cast<const char*>(&sample_));
+        table_.Add(name, offset, &BindingTraits<T, Ch>::Type);
+        return *this;
+    }
+
+private:
+    BindingFieldCollector(const BindingFieldCollector&);
+    BindingFieldCollector& operator=(const BindingFieldCollector&);
+
+    BindingFieldTable<Ch>& table_;
+    const S sample_;    //!< For the offsets of the members.
+};
+
+//! Writes the fields of a struct to a handler.
+template <typename S, typename Handler>
+class BindingFieldWriter {
+public:
+    typedef typename Handler::Ch Ch;
+
+    BindingFieldWriter(Handler& handler, const S& object) : handler_(handler), object_(object), count_(), ok_(true) {}
+
+    template <typename T>
+    BindingFieldWriter& operator()(const Ch* name, T S::* member) {
+        ok_ = ok_ && handler_.Key(name, StrLen(name), false) && BindingTraits<T, Ch>::Write(handler_, object_.*member);
+        count_++;
+        return *this;
+    }
+
+    SizeType Count() const { return count_; }
+    bool Ok() const { return ok_; }
+
+private:
+    BindingFieldWriter(const BindingFieldWriter&);
+    BindingFieldWriter& operator=(const BindingFieldWriter&);
+
+    Handler& handler_;
+    const S& object_;
+    SizeType count_;
+    bool ok_;
+};
+
+template <typename T, typename Ch>
+struct BindingTraits {
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kStructKind, R::Bool, R::Int64, R::Uint64, R::Double, R::String, 0, 0, 0, &Fields };
+        return type;
+    }
+
+    static const BindingFieldTable<Ch>& Fields() {
+        static const FieldTable table;
+        return table;
+    }
+
+    template <typename Handler>
+    static bool Write(Handler& handler, const T& value) {
+        if (RAPIDJSON_UNLIKELY(!handler.StartObject()))
+            return false;
+        BindingFieldWriter<T, Handler> writer(handler, value);
+        StructBinding<T>::Declare(writer);
+        return writer.Ok() && handler.EndObject(writer.Count());
+    }
+
+private:
+    //! The fields of T, collected and built on construction.
+    struct FieldTable : BindingFieldTable<Ch> {
+        FieldTable() {
+            BindingFieldCollector<T, Ch> collector(*this);
+            StructBinding<T>::Declare(collector);
+            this->Build();
+        }
+    };
+};
+
+template <typename Ch>
+struct BindingTraits<bool, Ch> {
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kScalarKind, SetBool, R::Int64, R::Uint64, R::Double, R::String, 0, 0, 0, 0 };
+        return type;
+    }
+
+    static bool SetBool(void* target, bool b) { *static_cast<bool*>(target) = b; return true; }
+
+    template <typename Handler>
+    static bool Write(Handler& handler, bool b) { return handler.Bool(b); }
+};
+
+//! Integers, which accept the parsed integers in their range.
+template <typename T, typename Ch>
+struct BindingIntegerTraits {
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kScalarKind, R::Bool, SetInt64, SetUint64, R::Double, R::String, 0, 0, 0, 0 };
+        return type;
+    }
+
+    static bool SetInt64(void* target, int64_t i) {
+        if (i < 0 ? (!std::numeric_limits<T>::is_signed || i < static_cast<int64_t>(std::numeric_limits<T>::min()))
+                  : static_cast<uint64_t>(i) > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+            return false;
+        *static_cast<T*>(target) = static_cast<T>(i);
+        return true;
+    }
+
+    static bool SetUint64(void* target, uint64_t u) {
+        if (u > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+            return false;
+        *static_cast<T*>(target) = static_cast<T>(u);
+        return true;
+    }
+
+    template <typename Handler> static bool Write(Handler& handler, int i) { return handler.Int(i); }
+    template <typename Handler> static bool Write(Handler& handler, unsigned u) { return handler.Uint(u); }
+    template <typename Handler> static bool Write(Handler& handler, int64_t i) { return handler.Int64(i); }
+    template <typename Handler> static bool Write(Handler& handler, uint64_t u) { return handler.Uint64(u); }
+};
+
+template <typename Ch> struct BindingTraits<int, Ch> : BindingIntegerTraits<int, Ch> {};
+template <typename Ch> struct BindingTraits<unsigned, Ch> : BindingIntegerTraits<unsigned, Ch> {};
+template <typename Ch> struct BindingTraits<int64_t, Ch> : BindingIntegerTraits<int64_t, Ch> {};
+template <typename Ch> struct BindingTraits<uint64_t, Ch> : BindingIntegerTraits<uint64_t, Ch> {};
+
+//! Floating point types, which accept any number.
+template <typename T, typename Ch>
+struct BindingFloatTraits {
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kScalarKind, R::Bool, SetInt64, SetUint64, SetDouble, R::String, 0, 0, 0, 0 };
+        return type;
+    }
+
+    static bool SetInt64(void* target, int64_t i) { *static_cast<T*>(target) = static_cast<T>(i); return true; }
+    static bool SetUint64(void* target, uint64_t u) { *static_cast<T*>(target) = static_cast<T>(u); return true; }
+    static bool SetDouble(void* target, double d) { *static_cast<T*>(target) = static_cast<T>(d); return true; }
+
+    template <typename Handler>
+    static bool Write(Handler& handler, T d) { return handler.Double(static_cast<double>(d)); }
+};
+
+template <typename Ch> struct BindingTraits<float, Ch> : BindingFloatTraits<float, Ch> {};
+template <typename Ch> struct BindingTraits<double, Ch> : BindingFloatTraits<double, Ch> {};
+
+template <typename Ch, typename CharTraits, typename A>
+struct BindingTraits<std::basic_string<Ch, CharTraits, A>, Ch> {
+    typedef std::basic_string<Ch, CharTraits, A> StringType;
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kScalarKind, R::Bool, R::Int64, R::Uint64, R::Double, SetString, 0, 0, 0, 0 };
+        return type;
+    }
+
+    static bool SetString(void* target, const Ch* str, SizeType length) {
+        static_cast<StringType*>(target)->assign(str, length);
+        return true;
+    }
+
+    template <typename Handler>
+    static bool Write(Handler& handler, const StringType& s) { return handler.String(s.data(), static_cast<SizeType>(s.size()), false); }
+};
+
+template <typename T, typename A, typename Ch>
+struct BindingTraits<std::vector<T, A>, Ch> {
+    typedef std::vector<T, A> VectorType;
+
+    static const BindingType<Ch>& Type() {
+        typedef BindingReject<Ch> R;
+        static const BindingType<Ch> type = { BindingType<Ch>::kArrayKind, R::Bool, R::Int64, R::Uint64, R::Double, R::String, Append, Clear, &BindingTraits<T, Ch>::Type, 0 };
+        return type;
+    }
+
+    static void* Append(void* target) {
+        VectorType& v = *static_cast<VectorType*>(target);
+        v.push_back(T());
+        return &v.back();
+    }
+
+    static void Clear(void* target) { static_cast<VectorType*>(target)->clear(); }
+
+    template <typename Handler>
+    static bool Write(Handler& handler, const VectorType& v) {
+        if (RAPIDJSON_UNLIKELY(!handler.StartArray()))
+            return false;
+        typedef BindingTraits<T, Ch> ElementTraits;
+        for (typename VectorType::const_iterator i = v.begin(); i != v.end(); ++i)
+            if (RAPIDJSON_UNLIKELY(!ElementTraits::Write(handler, *i)))
+                return false;
+        return handler.EndArray(static_cast<SizeType>(v.size()));
+    }
+};
+
+} // namespace internal
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericBindingHandler
+
+//! Handler which parses into a bound struct, without building a DOM.
+/*!
+    The members are looked up in the fields declared with StructBinding, by a
+    perfect hash built on first use, and parsed values are stored directly
+    into the struct. Arrays are parsed into \c std::vector, which is cleared
+    first. Members which are not declared are ignored, and skipped without
+    being parsed with \ref kParseSkipValueFlag. A \c null value leaves its
+    field unchanged, or adds a default element to an array.
+
+    A value which does not fit its field, such as a string for an \c int or
+    a number out of range, stops parsing with \ref kParseErrorTermination.
+
+    ParseStruct() is the simplest way to use it.
+
+    \note implements Handler concept
+    \tparam T Bound struct (or vector of them).
+    \tparam Encoding Encoding of the strings and names.
+    \tparam StackAllocator Allocator for the stack of nested values.
+*/
+template <typename T, typename Encoding = UTF8<>, typename StackAllocator = CrtAllocator>
+class GenericBindingHandler {
+public:
+    typedef typename Encoding::Ch Ch;
+
+    //! Constructor.
+    /*! \param value Value to parse into, which must outlive the handler.
+        \param stackAllocator Optional allocator for the stack of nested values.
+    */
+    explicit GenericBindingHandler(T& value, StackAllocator* stackAllocator = 0) :
+        stack_(stackAllocator, kDefaultStackCapacity), target_(&value), type_(&internal::BindingTraits<T, Ch>::Type()), mode_(kValueMode), ignoreDepth_() {}
+
+    bool Null() {
+        if (mode_ == kIgnoreMode)
+            return Ignore();
+        Next();
+        return EndValue();
+    }
+    bool Bool(bool b) { return Set(mode_ == kIgnoreMode || (Next() && type_->setBool(target_, b))); }
+    bool Int(int i) { return Set(mode_ == kIgnoreMode || (Next() && type_->setInt64(target_, i))); }
+    bool Uint(unsigned u) { return Set(mode_ == kIgnoreMode || (Next() && type_->setUint64(target_, u))); }
+    bool Int64(int64_t i) { return Set(mode_ == kIgnoreMode || (Next() && type_->setInt64(target_, i))); }
+    bool Uint64(uint64_t u) { return Set(mode_ == kIgnoreMode || (Next() && type_->setUint64(target_, u))); }
+    bool Double(double d) { return Set(mode_ == kIgnoreMode || (Next() && type_->setDouble(target_, d))); }
+    bool RawNumber(const Ch* str, SizeType length, bool copy) { return String(str, length, copy); }
+    bool String(const Ch* str, SizeType length, bool) { return Set(mode_ == kIgnoreMode || (Next() && type_->setString(target_, str, length))); }
+
+    bool StartObject() {
+        if (mode_ == kIgnoreMode) {
+            ignoreDepth_++;
+            return true;
+        }
+        Next();
+        if (RAPIDJSON_UNLIKELY(type_->kind != Type::kStructKind))
+            return false;
+        Push();
+        mode_ = kNameMode;
+        return true;
+    }
+
+    bool Key(const Ch* str, SizeType length, bool) {
+        if (mode_ == kIgnoreMode)
+            return true;
+        const Frame& frame = *stack_.template Top<Frame>();
+        const Field* field = frame.type->fields().Find(str, length);
+        if (field) {
+            target_ = static_cast<char*>(frame.target) + field->offset;
+            type_ = &field->type();
+            mode_ = kValueMode;
+        }
+        else {
+            mode_ = kIgnoreMode;
+            ignoreDepth_ = 0;
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType) { return End(); }
+
+    bool StartArray() {
+        if (mode_ == kIgnoreMode) {
+            ignoreDepth_++;
+            return true;
+        }
+        Next();
+        if (RAPIDJSON_UNLIKELY(type_->kind != Type::kArrayKind))
+            return false;
+        type_->clear(target_);
+        Push();
+        mode_ = kElementMode;
+        return true;
+    }
+
+    bool EndArray(SizeType) { return End(); }
+
+    //! Skips the values of the members which are not declared, see \ref kParseSkipValueFlag.
+    bool SkipValue() {
+        if (mode_ == kIgnoreMode && ignoreDepth_ == 0) {
+            mode_ = kNameMode;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    GenericBindingHandler(const GenericBindingHandler&);
+    GenericBindingHandler& operator=(const GenericBindingHandler&);
+
+    typedef internal::BindingType<Ch> Type;
+    typedef internal::BindingField<Ch> Field;
+
+    //! Object or array being parsed.
+    struct Frame {
+        void* target;
+        const Type* type;
+    };
+
+    enum Mode {
+        kValueMode,     //!< The next value goes to target_.
+        kElementMode,   //!< The next value is appended to the array on top of the stack.
+        kNameMode,      //!< A member name or the end of the object on top of the stack is next.
+        kIgnoreMode,    //!< Inside the value of an unknown member, ignoreDepth_ objects and arrays deep.
+        kDoneMode
+    };
+
+    //! Sets target_ and type_ to where the next value goes.
+    bool Next() {
+        if (mode_ == kElementMode) {
+            const Frame& frame = *stack_.template Top<Frame>();
+            target_ = frame.type->append(frame.target);
+            type_ = &frame.type->element();
+        }
+        RAPIDJSON_ASSERT(mode_ == kValueMode || mode_ == kElementMode);
+        return true;
+    }
+
+    void Push() {
+        Frame* frame = stack_.template Push<Frame>();
+        frame->target = target_;
+        frame->type = type_;
+    }
+
+    bool Set(bool ok) {
+        if (mode_ == kIgnoreMode)
+            return Ignore();
+        return ok && EndValue();
+    }
+
+    //! End of an ignored scalar, or of a nested value in an ignored one.
+    bool Ignore() {
+        if (ignoreDepth_ == 0)
+            mode_ = kNameMode;
+        return true;
+    }
+
+    bool End() {
+        if (mode_ == kIgnoreMode) {
+            --ignoreDepth_;
+            return Ignore();
+        }
+        stack_.template Pop<Frame>(1);
+        return EndValue();
+    }
+
+    //! A value is complete, continue with the enclosing object or array.
+    bool EndValue() {
+        if (stack_.Empty())
+            mode_ = kDoneMode;
+        else
+            mode_ = stack_.template Top<Frame>()->type->kind == Type::kStructKind ? kNameMode : kElementMode;
+        return true;
+    }
+
+    static const size_t kDefaultStackCapacity = 16 * sizeof(Frame);
+    internal::Stack<StackAllocator> stack_;
+    void* target_;
+    const Type* type_;
+    Mode mode_;
+    unsigned ignoreDepth_;
+};
+
+//! Parse JSON text from an input stream into a bound struct.
+/*! Members which are not declared are skipped without being parsed.
+    \tparam parseFlags Combination of \ref ParseFlag.
+    \tparam SourceEncoding Encoding of the input stream.
+    \tparam InputStream Type of input stream, implementing Stream concept.
+    \tparam T Bound struct (or vector of them).
+    \param is Input stream to be parsed.
+    \param value Value to parse into. Only the fields found in the text are changed.
+    \return The result of parsing.
+*/
+template <unsigned parseFlags, typename SourceEncoding, typename InputStream, typename T>
+ParseResult ParseStruct(InputStream& is, T& value) {
+    GenericBindingHandler<T, SourceEncoding> handler(value);
+    GenericReader<SourceEncoding, SourceEncoding> reader;
+    return reader.template Parse<parseFlags | kParseSkipValueFlag>(is, handler);
+}
+
+//! Parse JSON text from an input stream into a bound struct, with UTF-8 encoding.
+template <unsigned parseFlags, typename InputStream, typename T>
+ParseResult ParseStruct(InputStream& is, T& value) {
+    return ParseStruct<parseFlags, UTF8<> >(is, value);
+}
+
+//! Parse JSON text from an input stream into a bound struct, with UTF-8 encoding and \ref kParseDefaultFlags.
+template <typename InputStream, typename T>
+ParseResult ParseStruct(InputStream& is, T& value) {
+    return ParseStruct<kParseDefaultFlags, UTF8<> >(is, value);
+}
+
+//! Generate the events of a bound struct to a handler, such as a Writer.
+/*! The members are generated in the order of their declaration.
+    \tparam Handler type of handler.
+    \tparam T Bound struct (or vector of them).
+    \param handler An object implementing concept Handler, with a \c Ch typedef.
+    \param value Value to write.
+    \return Whether the handler accepted all the events.
+*/
+template <typename Handler, typename T>
+bool WriteStruct(Handler& handler, const T& value) {
+    return internal::BindingTraits<T, typename Handler::Ch>::Write(handler, value);
+}
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_BINDING_H_
@@ -0,0 +1,340 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_CHUNKEDREADER_H_
+#define RAPIDJSON_CHUNKEDREADER_H_
+
+#include "reader.h"
+#include "memorystream.h"
+#include <cstring> // std::memcpy
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericChunkedReader
+
+//! Push parser of a JSON text received in chunks.
+/*!
+    Each call to Feed() takes the next chunk of the text, of any length, and
+    sends the handler the events of the tokens completed by it. Finish()
+    marks the end of the text. Parsing is driven by
+    GenericReader::IterativeParseNext(), whose state is kept in the reader
+    between chunks, so no thread is needed and the text is never held in
+    full.
+
+    The complete tokens of a chunk are parsed in place. Only the part
+    after the last complete token, such as a string or a number cut by the
+    end of the chunk, is copied into a buffer of the chunked reader, until
+    the chunk completing it arrives. A number or literal is complete once the
+    character following it has been received.
+
+    \code
+    ChunkedReader r;
+    while (size_t n = recv(socket, buffer, sizeof(buffer), 0))
+        if (!r.Feed(buffer, n, handler))
+            break;
+    r.Finish(handler);
+    \endcode
+
+    The events are the same as with GenericReader::Parse(), and so are the
+    errors, whose offsets count from the start of the first chunk. To fill a
+    GenericDocument, feed the chunks from a generator passed to
+    GenericDocument::Populate().
+
+    \tparam SourceEncoding Encoding of the chunks, with \c char code units.
+    \tparam TargetEncoding Encoding of the strings sent to the handler.
+    \tparam parseFlags Combination of \ref ParseFlag. \ref kParseInsituFlag is
+        not supported, and \ref kParseSkipValueFlag and \ref kParseStructuralIndexFlag
+        are ignored.
+    \tparam StackAllocator Allocator type for the stack of the reader and for the buffer.
+*/
+template <typename SourceEncoding, typename TargetEncoding, unsigned parseFlags = kParseDefaultFlags, typename StackAllocator = CrtAllocator>
+class GenericChunkedReader {
+    RAPIDJSON_STATIC_ASSERT((internal::IsSame<typename SourceEncoding::Ch, char>::Value));
+    RAPIDJSON_STATIC_ASSERT(!(parseFlags & kParseInsituFlag));
+public:
+    typedef typename SourceEncoding::Ch Ch; //!< SourceEncoding character type
+    typedef GenericReader<SourceEncoding, TargetEncoding, StackAllocator> ReaderType; //!< Reader type used for parsing.
+
+    //! Constructor.
+    /*! \param stackAllocator Optional allocator for allocating stack memory.
+        \param stackCapacity Initial capacity of the stack of the reader in bytes.
+    */
+    GenericChunkedReader(StackAllocator* stackAllocator = 0, size_t stackCapacity = kDefaultStackCapacity) :
+        reader_(stackAllocator, stackCapacity), pending_(stackAllocator, kDefaultStackCapacity), scan_(kScanBetween), offset_(), parseResult_()
+    {
+        reader_.IterativeParseInit();
+    }
+
+    //! Prepare for a new text, keeping the allocated memory.
+    void Reset() {
+        reader_.IterativeParseInit();
+        pending_.Clear();
+        scan_ = kScanBetween;
+        offset_ = 0;
+        parseResult_.Clear();
+    }
+
+    //! Parse the next chunk of the text.
+    /*! \param data Chunk, need not be null-terminated. It is not used after the call.
+        \param length Length of \c data in code units.
+        \param handler The handler to receive the events, the same for all chunks.
+        \return Whether the parsing is successful so far. After an error, the
+            following chunks are ignored.
+    */
+    template <typename Handler>
+    ParseResult Feed(const Ch* data, size_t length, Handler& handler) {
+        if (HasParseError())
+            return parseResult_;
+        if (reader_.IterativeParseComplete())
+            return CheckTrailing(data, length);
+
+        size_t begin = 0;
+        if (!pending_.Empty()) {
+            // Complete the buffered token first.
+            const size_t end = Scan(data, 0, length, true);
+            if (end == kNoToken) {
+                Append(data, length);
+                return parseResult_;
+            }
+            Append(data, end);
+            if (!ParseTokens(pending_.template Bottom<Ch>(), pending_.GetSize(), handler))
+                return parseResult_;
+            pending_.Clear();
+            begin = end;
+            if (reader_.IterativeParseComplete()) {
+                scan_ = kScanBetween; // The scan may have gone further than the root.
+                return CheckTrailing(data + begin, length - begin);
+            }
+        }
+
+        const size_t end = Scan(data, begin, length, false);
+        if (end != kNoToken) {
+            if (!ParseTokens(data + begin, end - begin, handler))
+                return parseResult_;
+            begin = end;
+            if (reader_.IterativeParseComplete()) {
+                scan_ = kScanBetween; // The scan may have gone further than the root.
+                return CheckTrailing(data + begin, length - begin);
+            }
+        }
+        Append(data + begin, length - begin);
+        return parseResult_;
+    }
+
+    //! Parse the end of the text.
+    /*! Completes a number or literal ending the text, and reports incomplete texts.
+        \param handler The handler to receive the events.
+        \return Whether the parsing is successful.
+    */
+    template <typename Handler>
+    ParseResult Finish(Handler& handler) {
+        if (HasParseError())
+            return parseResult_;
+        if (!reader_.IterativeParseComplete()) {
+            MemoryStream is(pending_.template Bottom<Ch>(), pending_.GetSize());
+            while (!reader_.IterativeParseComplete())
+                if (!reader_.template IterativeParseNext<parseFlags>(is, handler))
+                    parseResult_.Set(reader_.GetParseErrorCode(), offset_ + reader_.GetErrorOffset());
+            offset_ += pending_.GetSize();
+            pending_.Clear();
+        }
+        else if (!(parseFlags & kParseStopWhenDoneFlag) && (scan_ == kScanSlash || scan_ == kScanBlockComment || scan_ == kScanBlockCommentStar))
+            parseResult_.Set(kParseErrorUnspecificSyntaxError, offset_); // Unclosed comment
+        return parseResult_;
+    }
+
+    //! Whether the root value has been parsed, or an error occurred.
+    bool IsComplete() const { return reader_.IterativeParseComplete(); }
+
+    //! Size in code units of the incomplete token copied from the chunks.
+    size_t GetPendingSize() const { return pending_.GetSize() / sizeof(Ch); }
+
+    //! Whether a parse error has occured.
+    bool HasParseError() const { return parseResult_.IsError(); }
+
+    //! Get the \ref ParseErrorCode of the parsing.
+    ParseErrorCode GetParseErrorCode() const { return parseResult_.Code(); }
+
+    //! Get the position of the parsing error from the start of the text, 0 otherwise.
+    size_t GetErrorOffset() const { return parseResult_.Offset(); }
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericChunkedReader(const GenericChunkedReader&);
+    GenericChunkedReader& operator=(const GenericChunkedReader&);
+
+    // Position of the scan in the text, between tokens or inside one.
+    enum ScanState {
+        kScanBetween,
+        kScanString,
+        kScanStringEscape,
+        kScanBare,              // Number, literal or invalid token
+        kScanSlash,             // Comments, only with kParseCommentsFlag
+        kScanBlockComment,
+        kScanBlockCommentStar,
+        kScanLineComment
+    };
+
+    static const size_t kNoToken = ~size_t(0);
+
+    static bool IsSpace(Ch c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+    static bool IsBareEnd(Ch c) {
+        return IsSpace(c) || c == ',' || c == ':' || c == '{' || c == '}' || c == '[' || c == ']' || c == '"' || c == '\0' ||
+            ((parseFlags & kParseCommentsFlag) && c == '/');
+    }
+
+    // Scan data[i, length) from the state left by the previous chunk, and return the end of
+    // the first (or last) token completed in it, kNoToken if none. Delimiters are not tokens,
+    // as IterativeParseNext() goes on after them.
+    size_t Scan(const Ch* data, size_t i, size_t length, bool first) {
+        size_t last = kNoToken;
+        for (; i < length; i++) {
+            const Ch c = data[i];
+            switch (scan_) {
+            case kScanString:
+                if (c == '\\')
+                    scan_ = kScanStringEscape;
+                else if (c == '"') {
+                    scan_ = kScanBetween;
+                    last = i + 1;
+                    if (first)
+                        return last;
+                }
+                break;
+
+            case kScanStringEscape:
+                scan_ = kScanString;
+                break;
+
+            case kScanBare:
+                if (IsBareEnd(c)) {
+                    scan_ = kScanBetween;
+                    last = i;
+                    if (first)
+                        return last;
+                    i--; // Scan c again, between tokens.
+                }
+                break;
+
+            case kScanSlash:
+                if (c == '*')
+                    scan_ = kScanBlockComment;
+                else if (c == '/')
+                    scan_ = kScanLineComment;
+                else {
+                    // Let the reader report the invalid comment.
+                    scan_ = kScanBetween;
+                    last = i;
+                    if (first)
+                        return last;
+                    i--;
+                }
+                break;
+
+            case kScanBlockComment:
+                if (c == '*')
+                    scan_ = kScanBlockCommentStar;
+                break;
+
+            case kScanBlockCommentStar:
+                scan_ = c == '/' ? kScanBetween : c == '*' ? kScanBlockCommentStar : kScanBlockComment;
+                break;
+
+            case kScanLineComment:
+                if (c == '\n')
+                    scan_ = kScanBetween;
+                break;
+
+            default:
+                RAPIDJSON_ASSERT(scan_ == kScanBetween);
+                if (c == '{' || c == '}' || c == '[' || c == ']' || c == '\0') {
+                    last = i + 1;
+                    if (first)
+                        return last;
+                }
+                else if (c == '"')
+                    scan_ = kScanString;
+                else if ((parseFlags & kParseCommentsFlag) && c == '/')
+                    scan_ = kScanSlash;
+                else if (!IsSpace(c) && c != ',' && c != ':')
+                    scan_ = kScanBare;
+                break;
+            }
+        }
+        return last;
+    }
+
+    // Send the events of data[0, length), which ends with a complete token.
+    template <typename Handler>
+    bool ParseTokens(const Ch* data, size_t length, Handler& handler) {
+        MemoryStream is(data, length);
+        while (is.Tell() < length && !reader_.IterativeParseComplete()) {
+            if (!reader_.template IterativeParseNext<parseFlags>(is, handler)) {
+                parseResult_.Set(reader_.GetParseErrorCode(), offset_ + reader_.GetErrorOffset());
+                return false;
+            }
+        }
+        offset_ += length;
+        return true;
+    }
+
+    // After the root value, only whitespace and comments may follow.
+    ParseResult CheckTrailing(const Ch* data, size_t length) {
+        if (parseFlags & kParseStopWhenDoneFlag)
+            return parseResult_;
+        for (size_t i = 0; i < length; i++) {
+            const Ch c = data[i];
+            if (scan_ == kScanBetween && !IsSpace(c) && !((parseFlags & kParseCommentsFlag) && c == '/')) {
+                parseResult_.Set(kParseErrorDocumentRootNotSingular, offset_ + i);
+                return parseResult_;
+            }
+            if (Scan(data, i, i + 1, true) != kNoToken) {
+                parseResult_.Set(kParseErrorUnspecificSyntaxError, offset_ + i);
+                return parseResult_;
+            }
+        }
+        offset_ += length;
+        return parseResult_;
+    }
+
+    void Append(const Ch* data, size_t length) {
+        if (length)
+            std::memcpy(pending_.template Push<Ch>(length), data, length * sizeof(Ch));
+    }
+
+    static const size_t kDefaultStackCapacity = 256;    //!< Default stack capacity in bytes.
+    ReaderType reader_;
+    internal::Stack<StackAllocator> pending_;   //!< Text after the last complete token.
+    ScanState scan_;                            //!< Scan state at the end of the text received.
+    size_t offset_;                             //!< Offset of the first code unit not parsed.
+    ParseResult parseResult_;
+};
+
+//! Chunked reader with UTF8 encoding and default flags.
+typedef GenericChunkedReader<UTF8<>, UTF8<> > ChunkedReader;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_CHUNKEDREADER_H_
@@ -50,6 +50,36 @@ RAPIDJSON_DIAG_OFF(effc++)
 #include <utility> // std::move
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// RAPIDJSON_MEMBER_HASH_THRESHOLD
+
+/*! \def RAPIDJSON_MEMBER_HASH_THRESHOLD
+    \ingroup RAPIDJSON_CONFIG
+    \brief Minimum capacity of an object for indexing its member names with a hash table.
+
+    Objects with a capacity of at least this many members keep an open-addressing
+    hash table of their member names behind the member array, in the same allocation.
+    GenericValue::FindMember() (and thus \c HasMember(), \c operator[] and
+    \c RemoveMember() by name) then takes constant average time instead of
+    scanning all members. The table is built when a parsed object ends or when the
+    object grows past the threshold, and is updated by \c AddMember(), \c RemoveMember()
+    and \c EraseMember(). It has 2 to 4 slots of 8 bytes per member of capacity,
+    so it costs 16 to 32 bytes per member on top of the 32 (or 48) of the member.
+
+    The non-const \c MemberBegin() and \c FindMember() give iterators which can
+    reorder (e.g. by \c std::sort) or rename members, so they mark the table
+    stale. A name missing from a stale table is searched linearly, and a non-const
+    lookup then rebuilds the table. Otherwise, looking up a name which is not a
+    member takes constant time too. Members must not be reordered or renamed
+    through iterators obtained before the last lookup of a missing name.
+
+    Defaults to \c 0, which disables the index. It must be the same in all
+    translation units of a program.
+*/
+#ifndef RAPIDJSON_MEMBER_HASH_THRESHOLD
+#define RAPIDJSON_MEMBER_HASH_THRESHOLD 0
+#endif
+
 RAPIDJSON_NAMESPACE_BEGIN
 
 // Forward declaration.
@@ -59,6 +89,15 @@ class GenericValue;
 template <typename Encoding, typename Allocator, typename StackAllocator>
 class GenericDocument;
 
+template <typename Encoding, typename Allocator>
+class GenericPathFilter;
+
+template <typename PathFilterType, typename OutputHandler, typename StateAllocator>
+class GenericFilteredHandler;
+
+template <typename Encoding, typename Allocator, typename StackAllocator>
+class GenericParallelParser;
+
 //! Name-value pair in a JSON object value.
 /*!
     This class was internal to GenericValue. It used to be a inner struct.
@@ -726,8 +765,14 @@ public:
                 }
                 break;
 
+            case kPackedDoubleArrayFlag:
+            case kPackedInt64ArrayFlag:
+                Allocator::Free(GetPackedValues());     // numbers need no destructor
+                Allocator::Free(GetPackedArrayHeader());
+                break;
+
             case kObjectFlag:
-                for (MemberIterator m = MemberBegin(); m != MemberEnd(); ++m)
+                for (Member* m = GetMembersPointer(); m != GetMembersPointer() + data_.o.size; ++m)
                     m->~Member();
                 Allocator::Free(GetMembersPointer());
                 break;
@@ -866,6 +911,14 @@ public:
         case kArrayType:
             if (data_.a.size != rhs.data_.a.size)
                 return false;
+            if (IsPackedArray() || rhs.IsPackedArray()) {
+                GenericValue lhsElement;
+                RhsType rhsElement;
+                for (SizeType i = 0; i < data_.a.size; i++)
+                    if (GetElement(i, lhsElement) != rhs.GetElement(i, rhsElement))
+                        return false;
+                return true;
+            }
             for (SizeType i = 0; i < data_.a.size; i++)
                 if ((*this)[i] != rhs[i])
                     return false;
@@ -937,7 +990,7 @@ public:
     bool IsTrue()   const { return data_.f.flags == kTrueFlag; }
     bool IsBool()   const { return (data_.f.flags & kBoolFlag) != 0; }
     bool IsObject() const { return data_.f.flags == kObjectFlag; }
-    bool IsArray()  const { return data_.f.flags == kArrayFlag; }
+    bool IsArray()  const { return (data_.f.flags & kTypeMask) == kArrayType; }
     bool IsNumber() const { return (data_.f.flags & kNumberFlag) != 0; }
     bool IsInt()    const { return (data_.f.flags & kIntFlag) != 0; }
     bool IsUint()   const { return (data_.f.flags & kUintFlag) != 0; }
@@ -1024,7 +1077,10 @@ public:
         return (*this)[n];
     }
     template <typename T>
-    RAPIDJSON_DISABLEIF_RETURN((internal::NotExpr<internal::IsSame<typename internal::RemoveConst<T>::Type, Ch> >),(const GenericValue&)) operator[](T* name) const { return const_cast<GenericValue&>(*this)[name]; }
+    RAPIDJSON_DISABLEIF_RETURN((internal::NotExpr<internal::IsSame<typename internal::RemoveConst<T>::Type, Ch> >),(const GenericValue&)) operator[](T* name) const {
+        GenericValue n(StringRef(name));
+        return (*this)[n];
+    }
 
     //! Get a value from an object associated with the name.
     /*! \pre IsObject() == true
@@ -1037,9 +1093,9 @@ public:
     */
     template <typename SourceAllocator>
     GenericValue& operator[](const GenericValue<Encoding, SourceAllocator>& name) {
-        MemberIterator member = FindMember(name);
-        if (member != MemberEnd())
-            return member->value;
+        const SizeType index = FindMemberIndex(name);
+        if (index != data_.o.size)
+            return GetMembersPointer()[index].value;
         else {
             RAPIDJSON_ASSERT(false);    // see above note
 
@@ -1053,7 +1109,12 @@ public:
         }
     }
     template <typename SourceAllocator>
-    const GenericValue& operator[](const GenericValue<Encoding, SourceAllocator>& name) const { return const_cast<GenericValue&>(*this)[name]; }
+    const GenericValue& operator[](const GenericValue<Encoding, SourceAllocator>& name) const {
+        ConstMemberIterator member = FindMember(name);
+        if (member != MemberEnd())
+            return member->value;
+        return const_cast<GenericValue&>(*this)[name];  // see above note
+    }
 
 #if RAPIDJSON_HAS_STDSTRING
     //! Get a value from an object associated with name (string object).
@@ -1068,8 +1129,10 @@ public:
     /*! \pre IsObject() == true */
     ConstMemberIterator MemberEnd() const   { RAPIDJSON_ASSERT(IsObject()); return ConstMemberIterator(GetMembersPointer() + data_.o.size); }
     //! Member iterator
-    /*! \pre IsObject() == true */
-    MemberIterator MemberBegin()            { RAPIDJSON_ASSERT(IsObject()); return MemberIterator(GetMembersPointer()); }
+    /*! \pre IsObject() == true
+        \note Marks the member hash index stale (see \ref RAPIDJSON_MEMBER_HASH_THRESHOLD).
+    */
+    MemberIterator MemberBegin()            { RAPIDJSON_ASSERT(IsObject()); SetMemberHashStale(); return MemberIterator(GetMembersPointer()); }
     //! \em Past-the-end member iterator
     /*! \pre IsObject() == true */
     MemberIterator MemberEnd()              { RAPIDJSON_ASSERT(IsObject()); return MemberIterator(GetMembersPointer() + data_.o.size); }
@@ -1118,14 +1181,18 @@ public:
         \note Earlier versions of Rapidjson returned a \c NULL pointer, in case
             the requested member doesn't exist. For consistency with e.g.
             \c std::map, this has been changed to MemberEnd() now.
-        \note Linear time complexity.
+        \note Linear time complexity, constant on average for objects with a
+            member hash index (see \ref RAPIDJSON_MEMBER_HASH_THRESHOLD).
     */
     MemberIterator FindMember(const Ch* name) {
         GenericValue n(StringRef(name));
         return FindMember(n);
     }
 
-    ConstMemberIterator FindMember(const Ch* name) const { return const_cast<GenericValue&>(*this).FindMember(name); }
+    ConstMemberIterator FindMember(const Ch* name) const {
+        GenericValue n(StringRef(name));
+        return FindMember(n);
+    }
 
     //! Find member by name.
     /*!
@@ -1138,19 +1205,23 @@ public:
         \note Earlier versions of Rapidjson returned a \c NULL pointer, in case
             the requested member doesn't exist. For consistency with e.g.
             \c std::map, this has been changed to MemberEnd() now.
-        \note Linear time complexity.
+        \note Linear time complexity, constant on average in an object with a
+            member hash index (see \ref RAPIDJSON_MEMBER_HASH_THRESHOLD).
     */
     template <typename SourceAllocator>
     MemberIterator FindMember(const GenericValue<Encoding, SourceAllocator>& name) {
+        const SizeType index = FindMemberIndex(name);
+        if (index != data_.o.size)
+            SetMemberHashStale();   // the member can be renamed through the iterator
+        return MemberIterator(GetMembersPointer() + index);
+    }
+    template <typename SourceAllocator>
+    ConstMemberIterator FindMember(const GenericValue<Encoding, SourceAllocator>& name) const {
         RAPIDJSON_ASSERT(IsObject());
         RAPIDJSON_ASSERT(name.IsString());
-        MemberIterator member = MemberBegin();
-        for ( ; member != MemberEnd(); ++member)
-            if (name.StringEqual(member->name))
-                break;
-        return member;
+        bool rebuild;
+        return MemberBegin() + FindMemberIndex(name, rebuild);
     }
-    template <typename SourceAllocator> ConstMemberIterator FindMember(const GenericValue<Encoding, SourceAllocator>& name) const { return const_cast<GenericValue&>(*this).FindMember(name); }
 
 #if RAPIDJSON_HAS_STDSTRING
     //! Find member by string object name.
@@ -1182,17 +1253,21 @@ public:
         if (o.size >= o.capacity) {
             if (o.capacity == 0) {
                 o.capacity = kDefaultObjectCapacity;
-                SetMembersPointer(reinterpret_cast<Member*>(allocator.Malloc(o.capacity * sizeof(Member))));
+                SetMembersPointer(reinterpret_cast<Member*>(allocator.Malloc(MemberBufferSize(o.capacity))));
             }
             else {
                 SizeType oldCapacity = o.capacity;
                 o.capacity += (oldCapacity + 1) / 2; // grow by factor 1.5
-                SetMembersPointer(reinterpret_cast<Member*>(allocator.Realloc(GetMembersPointer(), oldCapacity * sizeof(Member), o.capacity * sizeof(Member))));
+                SetMembersPointer(reinterpret_cast<Member*>(allocator.Realloc(GetMembersPointer(), MemberBufferSize(oldCapacity), MemberBufferSize(o.capacity))));
             }
+            if (HasMemberHash(o.capacity))
+                RebuildMemberHash();
         }
         Member* members = GetMembersPointer();
         members[o.size].name.RawAssign(name);
         members[o.size].value.RawAssign(value);
+        if (HasMemberHash(o.capacity))
+            AddMemberHash(o.size);
         o.size++;
         return *this;
     }
@@ -1327,9 +1402,11 @@ public:
     */
     void RemoveAllMembers() {
         RAPIDJSON_ASSERT(IsObject()); 
-        for (MemberIterator m = MemberBegin(); m != MemberEnd(); ++m)
+        for (Member* m = GetMembersPointer(); m != GetMembersPointer() + data_.o.size; ++m)
             m->~Member();
         data_.o.size = 0;
+        if (HasMemberHash(data_.o.capacity))
+            RebuildMemberHash();
     }
 
     //! Remove a member in object by its name.
@@ -1351,9 +1428,9 @@ public:
 
     template <typename SourceAllocator>
     bool RemoveMember(const GenericValue<Encoding, SourceAllocator>& name) {
-        MemberIterator m = FindMember(name);
-        if (m != MemberEnd()) {
-            RemoveMember(m);
+        const SizeType index = FindMemberIndex(name);
+        if (index != data_.o.size) {
+            RemoveMember(MemberIterator(GetMembersPointer() + index));
             return true;
         }
         else
@@ -1372,14 +1449,22 @@ public:
         RAPIDJSON_ASSERT(IsObject());
         RAPIDJSON_ASSERT(data_.o.size > 0);
         RAPIDJSON_ASSERT(GetMembersPointer() != 0);
-        RAPIDJSON_ASSERT(m >= MemberBegin() && m < MemberEnd());
+        const MemberIterator begin(GetMembersPointer());    // MemberBegin() would mark the hash index stale
+        RAPIDJSON_ASSERT(m >= begin && m < MemberEnd());
 
         MemberIterator last(GetMembersPointer() + (data_.o.size - 1));
+        bool rebuild = false;
+        if (HasMemberHash(data_.o.capacity)) {
+            const SizeType index = static_cast<SizeType>(m - begin);
+            rebuild = IsMemberHashStale() || !RemoveMemberHash(index) || (m != last && !RenumberMemberHash(data_.o.size - 1, index));
+        }
         if (data_.o.size > 1 && m != last)
             *m = *last; // Move the last one to this place
         else
             m->~Member(); // Only one left, just destroy
         --data_.o.size;
+        if (rebuild)
+            RebuildMemberHash();
         return m;
     }
 
@@ -1409,15 +1494,18 @@ public:
         RAPIDJSON_ASSERT(IsObject());
         RAPIDJSON_ASSERT(data_.o.size > 0);
         RAPIDJSON_ASSERT(GetMembersPointer() != 0);
-        RAPIDJSON_ASSERT(first >= MemberBegin());
+        const ConstMemberIterator begin(GetMembersPointer());  // MemberBegin() would mark the hash index stale
+        RAPIDJSON_ASSERT(first >= begin);
         RAPIDJSON_ASSERT(first <= last);
         RAPIDJSON_ASSERT(last <= MemberEnd());
 
-        MemberIterator pos = MemberBegin() + (first - MemberBegin());
+        MemberIterator pos(GetMembersPointer() + (first - begin));
         for (MemberIterator itr = pos; itr != last; ++itr)
             itr->~Member();
         std::memmove(&*pos, &*last, static_cast<size_t>(MemberEnd() - last) * sizeof(Member));
         data_.o.size -= static_cast<SizeType>(last - first);
+        if (HasMemberHash(data_.o.capacity))
+            RebuildMemberHash();
         return pos;
     }
 
@@ -1437,9 +1525,9 @@ public:
 
     template <typename SourceAllocator>
     bool EraseMember(const GenericValue<Encoding, SourceAllocator>& name) {
-        MemberIterator m = FindMember(name);
-        if (m != MemberEnd()) {
-            EraseMember(m);
+        const SizeType index = FindMemberIndex(name);
+        if (index != data_.o.size) {
+            EraseMember(ConstMemberIterator(GetMembersPointer() + index));
             return true;
         }
         else
@@ -1473,7 +1561,7 @@ public:
     */
     void Clear() {
         RAPIDJSON_ASSERT(IsArray()); 
-        GenericValue* e = GetElementsPointer();
+        GenericValue* e = GetElements();
         for (GenericValue* v = e; v != e + data_.a.size; ++v)
             v->~GenericValue();
         data_.a.size = 0;
@@ -1487,22 +1575,27 @@ public:
     GenericValue& operator[](SizeType index) {
         RAPIDJSON_ASSERT(IsArray());
         RAPIDJSON_ASSERT(index < data_.a.size);
-        return GetElementsPointer()[index];
+        return GetElements()[index];
+    }
+    //! \see IsPackedArray()
+    const GenericValue& operator[](SizeType index) const {
+        RAPIDJSON_ASSERT(IsArray());
+        RAPIDJSON_ASSERT(index < data_.a.size);
+        return GetConstElements()[index];
     }
-    const GenericValue& operator[](SizeType index) const { return const_cast<GenericValue&>(*this)[index]; }
 
     //! Element iterator
     /*! \pre IsArray() == true */
-    ValueIterator Begin() { RAPIDJSON_ASSERT(IsArray()); return GetElementsPointer(); }
+    ValueIterator Begin() { RAPIDJSON_ASSERT(IsArray()); return GetElements(); }
     //! \em Past-the-end element iterator
     /*! \pre IsArray() == true */
-    ValueIterator End() { RAPIDJSON_ASSERT(IsArray()); return GetElementsPointer() + data_.a.size; }
+    ValueIterator End() { RAPIDJSON_ASSERT(IsArray()); return GetElements() + data_.a.size; }
     //! Constant element iterator
     /*! \pre IsArray() == true */
-    ConstValueIterator Begin() const { return const_cast<GenericValue&>(*this).Begin(); }
+    ConstValueIterator Begin() const { RAPIDJSON_ASSERT(IsArray()); return GetConstElements(); }
     //! Constant \em past-the-end element iterator
     /*! \pre IsArray() == true */
-    ConstValueIterator End() const { return const_cast<GenericValue&>(*this).End(); }
+    ConstValueIterator End() const { RAPIDJSON_ASSERT(IsArray()); return GetConstElements() + data_.a.size; }
 
     //! Request the array to have enough capacity to store elements.
     /*! \param newCapacity  The capacity that the array at least need to have.
@@ -1513,7 +1606,7 @@ public:
     GenericValue& Reserve(SizeType newCapacity, Allocator &allocator) {
         RAPIDJSON_ASSERT(IsArray());
         if (newCapacity > data_.a.capacity) {
-            SetElementsPointer(reinterpret_cast<GenericValue*>(allocator.Realloc(GetElementsPointer(), data_.a.capacity * sizeof(GenericValue), newCapacity * sizeof(GenericValue))));
+            SetElementsPointer(reinterpret_cast<GenericValue*>(allocator.Realloc(GetElements(), data_.a.capacity * sizeof(GenericValue), newCapacity * sizeof(GenericValue))));
             data_.a.capacity = newCapacity;
         }
         return *this;
@@ -1587,7 +1680,7 @@ public:
     GenericValue& PopBack() {
         RAPIDJSON_ASSERT(IsArray());
         RAPIDJSON_ASSERT(!Empty());
-        GetElementsPointer()[--data_.a.size].~GenericValue();
+        GetElements()[--data_.a.size].~GenericValue();
         return *this;
     }
 
@@ -1628,6 +1721,54 @@ public:
     Array GetArray() { RAPIDJSON_ASSERT(IsArray()); return Array(*this); }
     ConstArray GetArray() const { RAPIDJSON_ASSERT(IsArray()); return ConstArray(*this); }
 
+    //! Check whether the array stores its numbers packed, as doubles or int64_t.
+    /*! Arrays of numbers are packed by \ref kParsePackNumberArraysFlag,
+        SetDoubleArray() and SetInt64Array(). Size(), Accept() and comparisons
+        use the packed numbers, and GetDoubleArray() or GetInt64Array() return
+        them. Non-const access to the elements, by operator[](), Begin(),
+        GetArray() or modifying the array, first converts it to values,
+        allocated with the allocator which packed it. Const access keeps the
+        array packed: the first one converts a copy of the numbers to values,
+        kept until the array is destroyed or unpacked. As this allocates, it
+        must not happen on several threads at once.
+    */
+    bool IsPackedArray() const { return (data_.f.flags & (kPackedDoubleFlag | kPackedInt64Flag)) != 0; }
+
+    //! Check whether the array is packed as doubles.
+    bool IsDoubleArray() const { return data_.f.flags == kPackedDoubleArrayFlag; }
+
+    //! Check whether the array is packed as int64_t.
+    bool IsInt64Array() const { return data_.f.flags == kPackedInt64ArrayFlag; }
+
+    //! Get the numbers of an array packed as doubles, Size() of them.
+    /*! \pre IsDoubleArray() == true */
+    const double* GetDoubleArray() const { RAPIDJSON_ASSERT(IsDoubleArray()); return GetPackedElements<double>(); }
+
+    //! Get the numbers of an array packed as int64_t, Size() of them.
+    /*! \pre IsInt64Array() == true */
+    const int64_t* GetInt64Array() const { RAPIDJSON_ASSERT(IsInt64Array()); return GetPackedElements<int64_t>(); }
+
+    //! Set this value as an array of doubles, packed.
+    /*! \param values Numbers to copy.
+        \param count Number of values.
+        \param allocator Allocator for the numbers, and for converting them to values on access. Commonly use GenericDocument::GetAllocator().
+        \return The value itself for fluent API.
+        \post IsDoubleArray() == true, unless \c count is zero.
+    */
+    GenericValue& SetDoubleArray(const double* values, SizeType count, Allocator& allocator) {
+        this->~GenericValue();
+        SetPackedArrayRaw<double>(kPackedDoubleArrayFlag, values, count, allocator);
+        return *this;
+    }
+
+    //! Set this value as an array of int64_t, packed.
+    /*! \see SetDoubleArray() */
+    GenericValue& SetInt64Array(const int64_t* values, SizeType count, Allocator& allocator) {
+        this->~GenericValue();
+        SetPackedArrayRaw<int64_t>(kPackedInt64ArrayFlag, values, count, allocator);
+        return *this;
+    }
+
     //@}
 
     //!@name Number
@@ -1777,9 +1918,16 @@ public:
         case kArrayType:
             if (RAPIDJSON_UNLIKELY(!handler.StartArray()))
                 return false;
-            for (const GenericValue* v = Begin(); v != End(); ++v)
-                if (RAPIDJSON_UNLIKELY(!v->Accept(handler)))
-                    return false;
+            if (RAPIDJSON_UNLIKELY(IsPackedArray())) {
+                GenericValue element;
+                for (SizeType i = 0; i < data_.a.size; i++)
+                    if (RAPIDJSON_UNLIKELY(!GetPackedElement(i, element).Accept(handler)))
+                        return false;
+            }
+            else
+                for (const GenericValue* v = Begin(); v != End(); ++v)
+                    if (RAPIDJSON_UNLIKELY(!v->Accept(handler)))
+                        return false;
             return handler.EndArray(data_.a.size);
     
         case kStringType:
@@ -1810,6 +1958,8 @@ private:
         kStringFlag     = 0x0400,
         kCopyFlag       = 0x0800,
         kInlineStrFlag  = 0x1000,
+        kPackedDoubleFlag = 0x2000,
+        kPackedInt64Flag  = 0x4000,
 
         // Initial flags of different types.
         kNullFlag = kNullType,
@@ -1826,6 +1976,8 @@ private:
         kShortStringFlag = kStringType | kStringFlag | kCopyFlag | kInlineStrFlag,
         kObjectFlag = kObjectType,
         kArrayFlag = kArrayType,
+        kPackedDoubleArrayFlag = kArrayType | kPackedDoubleFlag,
+        kPackedInt64ArrayFlag = kArrayType | kPackedInt64Flag,
 
         kTypeMask = 0x07
     };
@@ -1921,6 +2073,286 @@ private:
     RAPIDJSON_FORCEINLINE Member* GetMembersPointer() const { return RAPIDJSON_GETPOINTER(Member, data_.o.members); }
     RAPIDJSON_FORCEINLINE Member* SetMembersPointer(Member* members) { return RAPIDJSON_SETPOINTER(Member, data_.o.members, members); }
 
+    // Member hash index, see RAPIDJSON_MEMBER_HASH_THRESHOLD.
+    // A power-of-two table of slots with linear probing follows the member array.
+    // It is followed by one more slot, whose index is not 0 when the table is stale.
+    struct MemberHashSlot {
+        SizeType index;     //!< Member index + 1, 0 for an empty slot.
+        SizeType hash;
+    };
+
+    static const SizeType kMemberHashThreshold = RAPIDJSON_MEMBER_HASH_THRESHOLD;
+
+    static bool HasMemberHash(SizeType capacity) { return kMemberHashThreshold != 0 && capacity >= kMemberHashThreshold; }
+
+    //! At most half of the slots are used.
+    static SizeType MemberHashSlotCount(SizeType capacity) {
+        SizeType count = 8;
+        while (count / 2 < capacity)
+            count *= 2;
+        return count;
+    }
+
+    //! Size in bytes of the members (and hash slots) of an object with the given capacity.
+    static size_t MemberBufferSize(SizeType capacity) {
+        size_t size = capacity * sizeof(Member);
+        if (HasMemberHash(capacity))
+            size += (MemberHashSlotCount(capacity) + 1) * sizeof(MemberHashSlot);
+        return size;
+    }
+
+    //! FNV-1a hash of a member name.
+    static SizeType HashMemberName(const Ch* str, SizeType length) {
+        uint32_t h = 2166136261u;
+        for (SizeType i = 0; i < length; i++) {
+            h ^= static_cast<uint32_t>(str[i]);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    MemberHashSlot* GetMemberHashSlots() const { return reinterpret_cast<MemberHashSlot*>(GetMembersPointer() + data_.o.capacity); }
+
+    bool IsMemberHashStale() const { return GetMemberHashSlots()[MemberHashSlotCount(data_.o.capacity)].index != 0; }
+
+    void SetMemberHashStale() {
+        if (HasMemberHash(data_.o.capacity))
+            GetMemberHashSlots()[MemberHashSlotCount(data_.o.capacity)].index = 1;
+    }
+
+    //! Index of the member with the name, or \c size if there is none.
+    SizeType FindMemberHash(const Ch* str, SizeType length) const {
+        const MemberHashSlot* slots = GetMemberHashSlots();
+        const Member* members = GetMembersPointer();
+        const SizeType mask = MemberHashSlotCount(data_.o.capacity) - 1;
+        const SizeType hash = HashMemberName(str, length);
+        for (SizeType i = hash & mask; slots[i].index != 0; i = (i + 1) & mask) {
+            if (slots[i].hash == hash) {
+                const GenericValue& name = members[slots[i].index - 1].name;
+                if (name.GetStringLength() == length && std::memcmp(name.GetString(), str, sizeof(Ch) * length) == 0)
+                    return slots[i].index - 1;
+            }
+        }
+        return data_.o.size;
+    }
+
+    //! Index of the first member with the name, or \c size if there is none.
+    /*! A name missing from a stale hash index is searched linearly, and
+        \c rebuild is set, as the index should be rebuilt. A name found in it is
+        a member, but with duplicated names, not necessarily the first one.
+    */
+    template <typename SourceAllocator>
+    SizeType FindMemberIndex(const GenericValue<Encoding, SourceAllocator>& name, bool& rebuild) const {
+        rebuild = false;
+        if (HasMemberHash(data_.o.capacity)) {
+            const SizeType index = FindMemberHash(name.GetString(), name.GetStringLength());
+            if (index != data_.o.size || !IsMemberHashStale())
+                return index;
+            rebuild = true;
+        }
+        const Member* members = GetMembersPointer();
+        SizeType index = 0;
+        while (index < data_.o.size && !name.StringEqual(members[index].name))
+            index++;
+        return index;
+    }
+
+    //! Index of the first member with the name, or \c size if there is none, rebuilding a stale hash index.
+    template <typename SourceAllocator>
+    SizeType FindMemberIndex(const GenericValue<Encoding, SourceAllocator>& name) {
+        RAPIDJSON_ASSERT(IsObject());
+        RAPIDJSON_ASSERT(name.IsString());
+        bool rebuild;
+        const SizeType index = static_cast<const GenericValue&>(*this).FindMemberIndex(name, rebuild);
+        if (rebuild)
+            RebuildMemberHash();
+        return index;
+    }
+
+    //! Slot which refers to a member, or the slot count if the index is stale.
+    SizeType FindMemberHashSlot(SizeType index) const {
+        const MemberHashSlot* slots = GetMemberHashSlots();
+        const GenericValue& name = GetMembersPointer()[index].name;
+        const SizeType mask = MemberHashSlotCount(data_.o.capacity) - 1;
+        const SizeType hash = HashMemberName(name.GetString(), name.GetStringLength());
+        for (SizeType i = hash & mask; slots[i].index != 0; i = (i + 1) & mask)
+            if (slots[i].index == index + 1 && slots[i].hash == hash)
+                return i;
+        return mask + 1;
+    }
+
+    void AddMemberHash(SizeType index) {
+        MemberHashSlot* slots = GetMemberHashSlots();
+        const GenericValue& name = GetMembersPointer()[index].name;
+        const SizeType mask = MemberHashSlotCount(data_.o.capacity) - 1;
+        const SizeType hash = HashMemberName(name.GetString(), name.GetStringLength());
+        SizeType i = hash & mask;
+        while (slots[i].index != 0)
+            i = (i + 1) & mask;
+        slots[i].index = index + 1;
+        slots[i].hash = hash;
+    }
+
+    //! Remove the slot of a member, moving back later slots of the same probe sequence.
+    /*! \return \c false if the index is stale. */
+    bool RemoveMemberHash(SizeType index) {
+        MemberHashSlot* slots = GetMemberHashSlots();
+        const SizeType mask = MemberHashSlotCount(data_.o.capacity) - 1;
+        SizeType hole = FindMemberHashSlot(index);
+        if (hole > mask)
+            return false;
+        for (SizeType i = (hole + 1) & mask; slots[i].index != 0; i = (i + 1) & mask) {
+            const SizeType home = slots[i].hash & mask;
+            // The slot can fill the hole if its home is not in (hole, i].
+            if (hole <= i ? (home <= hole || home > i) : (home <= hole && home > i)) {
+                slots[hole] = slots[i];
+                hole = i;
+            }
+        }
+        slots[hole].index = 0;
+        return true;
+    }
+
+    //! \return \c false if the index is stale.
+    bool RenumberMemberHash(SizeType from, SizeType to) {
+        SizeType slot = FindMemberHashSlot(from);
+        if (slot == MemberHashSlotCount(data_.o.capacity))
+            return false;
+        GetMemberHashSlots()[slot].index = to + 1;
+        return true;
+    }
+
+    //! Also clears the stale mark.
+    void RebuildMemberHash() {
+        std::memset(static_cast<void*>(GetMemberHashSlots()), 0, (MemberHashSlotCount(data_.o.capacity) + 1) * sizeof(MemberHashSlot));
+        for (SizeType i = 0; i < data_.o.size; i++)
+            AddMemberHash(i);
+    }
+
+    // Packed arrays, see IsPackedArray().
+    // The numbers follow a header with the allocator to unpack them with, and
+    // their values once converted for const access.
+    struct PackedArrayHeader {
+        Allocator* allocator;
+        GenericValue* values;   //!< Null until converted.
+    };
+
+    PackedArrayHeader* GetPackedArrayHeader() const { return reinterpret_cast<PackedArrayHeader*>(GetElementsPointer()); }
+
+    template <typename T>
+    T* GetPackedElements() const { return reinterpret_cast<T*>(GetPackedArrayHeader() + 1); }
+
+    //! The elements of an array, unpacked first if it is packed.
+    RAPIDJSON_FORCEINLINE GenericValue* GetElements() {
+        if (RAPIDJSON_UNLIKELY(data_.f.flags != kArrayFlag))
+            UnpackArray();
+        return GetElementsPointer();
+    }
+
+    //! The elements of an array for const access, converted from the numbers once if it is packed.
+    RAPIDJSON_FORCEINLINE const GenericValue* GetConstElements() const {
+        if (RAPIDJSON_UNLIKELY(data_.f.flags != kArrayFlag))
+            return ConvertPackedArray();
+        return GetElementsPointer();
+    }
+
+    void UnpackArray() {
+        RAPIDJSON_ASSERT(IsPackedArray());
+        GenericValue* e = ConvertPackedArray();
+        Allocator::Free(GetPackedArrayHeader());
+        data_.f.flags = kArrayFlag;
+        SetElementsPointer(e);
+    }
+
+    //! The values of the numbers of a packed array, or null if not converted yet.
+    GenericValue* GetPackedValues() const { return GetPackedArrayHeader()->values; }
+
+    //! The values of the numbers of a packed array, converted on the first call.
+    GenericValue* ConvertPackedArray() const {
+        RAPIDJSON_ASSERT(IsPackedArray());
+        if (GenericValue* values = GetPackedValues())
+            return values;
+        PackedArrayHeader* header = GetPackedArrayHeader();
+        const SizeType count = data_.a.size;
+        GenericValue* e = static_cast<GenericValue*>(header->allocator->Malloc(count * sizeof(GenericValue)));
+        if (data_.f.flags == kPackedDoubleArrayFlag) {
+            const double* d = GetPackedElements<double>();
+            for (SizeType i = 0; i < count; i++)
+                new (e + i) GenericValue(d[i]);
+        }
+        else {
+            const int64_t* d = GetPackedElements<int64_t>();
+            for (SizeType i = 0; i < count; i++)
+                new (e + i) GenericValue(d[i]);
+        }
+        header->values = e;
+        return e;
+    }
+
+    //! Element of a packed array, as a number value.
+    const GenericValue& GetPackedElement(SizeType index, GenericValue& element) const {
+        if (data_.f.flags == kPackedDoubleArrayFlag)
+            element.SetDouble(GetPackedElements<double>()[index]);
+        else
+            element.SetInt64(GetPackedElements<int64_t>()[index]);
+        return element;
+    }
+
+    //! Element of an array, in \c element if the array is packed.
+    const GenericValue& GetElement(SizeType index, GenericValue& element) const {
+        return IsPackedArray() ? GetPackedElement(index, element) : GetElementsPointer()[index];
+    }
+
+    //! Initialize this value as packed array of \c count numbers, without calling destructor.
+    template <typename T>
+    T* SetPackedArrayRaw(uint16_t flags, SizeType count, Allocator& allocator) {
+        RAPIDJSON_ASSERT(count > 0);
+        PackedArrayHeader* header = static_cast<PackedArrayHeader*>(allocator.Malloc(sizeof(PackedArrayHeader) + count * sizeof(T)));
+        header->allocator = &allocator;
+        header->values = 0;
+        data_.f.flags = flags;
+        SetElementsPointer(reinterpret_cast<GenericValue*>(header));
+        data_.a.size = data_.a.capacity = count;
+        return GetPackedElements<T>();
+    }
+
+    template <typename T>
+    void SetPackedArrayRaw(uint16_t flags, const T* values, SizeType count, Allocator& allocator) {
+        if (count)
+            std::memcpy(SetPackedArrayRaw<T>(flags, count, allocator), values, count * sizeof(T));
+        else
+            new (this) GenericValue(kArrayType);
+    }
+
+    //! Initialize this value as packed array of the values, if they are all doubles or all integers, without calling destructor.
+    /*! Integers are packed as int64_t. Arrays mixing integers and doubles are
+        not packed, so that each element keeps its type.
+        \return Whether the values were packed.
+    */
+    bool SetNumberArrayRaw(const GenericValue* values, SizeType count, Allocator& allocator) {
+        if (count == 0)
+            return false;
+        if (values[0].data_.f.flags == kNumberDoubleFlag) {
+            for (SizeType i = 1; i < count; i++)
+                if (values[i].data_.f.flags != kNumberDoubleFlag)
+                    return false;
+            double* d = SetPackedArrayRaw<double>(kPackedDoubleArrayFlag, count, allocator);
+            for (SizeType i = 0; i < count; i++)
+                d[i] = values[i].data_.n.d;
+        }
+        else {
+            for (SizeType i = 0; i < count; i++) {
+                const uint16_t flags = values[i].data_.f.flags;
+                if ((flags & kNumberFlag) == 0 || (flags & kInt64Flag) == 0)
+                    return false;   // not a number, a double, or a uint64_t above int64_t
+            }
+            int64_t* d = SetPackedArrayRaw<int64_t>(kPackedInt64ArrayFlag, count, allocator);
+            for (SizeType i = 0; i < count; i++)
+                d[i] = values[i].data_.n.i64;
+        }
+        return true;
+    }
+
     // Initialize this value as array with initial data, without calling destructor.
     void SetArrayRaw(GenericValue* values, SizeType count, Allocator& allocator) {
         data_.f.flags = kArrayFlag;
@@ -1938,13 +2370,15 @@ private:
     void SetObjectRaw(Member* members, SizeType count, Allocator& allocator) {
         data_.f.flags = kObjectFlag;
         if (count) {
-            Member* m = static_cast<Member*>(allocator.Malloc(count * sizeof(Member)));
+            Member* m = static_cast<Member*>(allocator.Malloc(MemberBufferSize(count)));
             SetMembersPointer(m);
             std::memcpy(m, members, count * sizeof(Member));
         }
         else
             SetMembersPointer(0);
         data_.o.size = data_.o.capacity = count;
+        if (HasMemberHash(count))
+            RebuildMemberHash();
     }
 
     //! Initialize this value as constant string, without calling destructor.
@@ -2026,7 +2460,10 @@ public:
         \param stackAllocator   Optional allocator for allocating memory for stack.
     */
     explicit GenericDocument(Type type, Allocator* allocator = 0, size_t stackCapacity = kDefaultStackCapacity, StackAllocator* stackAllocator = 0) :
-        GenericValue<Encoding, Allocator>(type),  allocator_(allocator), ownAllocator_(0), stack_(stackAllocator, stackCapacity), parseResult_()
+        GenericValue<Encoding, Allocator>(type),  allocator_(allocator), ownAllocator_(0), stack_(stackAllocator, stackCapacity), parseResult_(), packNumberArrays_()
+#if RAPIDJSON_ALLOCATION_STATS
+        , allocationStats_()
+#endif
     {
         if (!allocator_)
             ownAllocator_ = allocator_ = RAPIDJSON_NEW(Allocator());
@@ -2039,7 +2476,10 @@ public:
         \param stackAllocator   Optional allocator for allocating memory for stack.
     */
     GenericDocument(Allocator* allocator = 0, size_t stackCapacity = kDefaultStackCapacity, StackAllocator* stackAllocator = 0) : 
-        allocator_(allocator), ownAllocator_(0), stack_(stackAllocator, stackCapacity), parseResult_()
+        allocator_(allocator), ownAllocator_(0), stack_(stackAllocator, stackCapacity), parseResult_(), packNumberArrays_()
+#if RAPIDJSON_ALLOCATION_STATS
+        , allocationStats_()
+#endif
     {
         if (!allocator_)
             ownAllocator_ = allocator_ = RAPIDJSON_NEW(Allocator());
@@ -2052,7 +2492,11 @@ public:
           allocator_(rhs.allocator_),
           ownAllocator_(rhs.ownAllocator_),
           stack_(std::move(rhs.stack_)),
-          parseResult_(rhs.parseResult_)
+          parseResult_(rhs.parseResult_),
+          packNumberArrays_()
+#if RAPIDJSON_ALLOCATION_STATS
+        , allocationStats_(rhs.allocationStats_)
+#endif
     {
         rhs.allocator_ = 0;
         rhs.ownAllocator_ = 0;
@@ -2079,6 +2523,9 @@ public:
         ownAllocator_ = rhs.ownAllocator_;
         stack_ = std::move(rhs.stack_);
         parseResult_ = rhs.parseResult_;
+#if RAPIDJSON_ALLOCATION_STATS
+        allocationStats_ = rhs.allocationStats_;
+#endif
 
         rhs.allocator_ = 0;
         rhs.ownAllocator_ = 0;
@@ -2100,6 +2547,9 @@ public:
         internal::Swap(allocator_, rhs.allocator_);
         internal::Swap(ownAllocator_, rhs.ownAllocator_);
         internal::Swap(parseResult_, rhs.parseResult_);
+#if RAPIDJSON_ALLOCATION_STATS
+        internal::Swap(allocationStats_, rhs.allocationStats_);
+#endif
         return *this;
     }
 
@@ -2117,6 +2567,36 @@ public:
      */
     friend inline void swap(GenericDocument& a, GenericDocument& b) RAPIDJSON_NOEXCEPT { a.Swap(b); }
 
+    //! Empties the document to parse another JSON text, keeping the memory of its allocators.
+    /*! The document becomes null and the parse error is cleared. If the allocator,
+        or the stack allocator, is a MemoryPoolAllocator, it is reset with
+        MemoryPoolAllocator::Reset(), which keeps the memory of all its blocks in
+        one chunk. Only with MemoryPoolAllocator for both, parsing a stream of
+        similar documents into one document does not allocate from the heap once
+        the chunks are large enough. With a CrtAllocator for the stacks, as in
+        Document, every parse still allocates its stacks and frees them at the end:
+        \code
+        typedef GenericDocument<UTF8<>, MemoryPoolAllocator<>, MemoryPoolAllocator<> > DocumentType;
+        DocumentType d;
+        while (const char* json = NextMessage()) {
+            d.Reset().Parse(json);
+            // ...
+        }
+        \endcode
+        \return The document itself for fluent API.
+        \warning All values allocated with the allocators become invalid, including
+            those outside of this document.
+    */
+    GenericDocument& Reset() {
+        ValueType::SetNull();
+        ClearStack();
+        parseResult_.Clear();
+        ResetAllocator(*allocator_);
+        if (stack_.HasAllocator())
+            ResetAllocator(stack_.GetAllocator());
+        return *this;
+    }
+
     //! Populate this document by a generator which produces SAX events.
     /*! \tparam Generator A functor with <tt>bool f(Handler)</tt> prototype.
         \param g Generator functor which sends SAX events to the parameter.
@@ -2147,7 +2627,14 @@ public:
         GenericReader<SourceEncoding, Encoding, StackAllocator> reader(
             stack_.HasAllocator() ? &stack_.GetAllocator() : 0);
         ClearStackOnExit scope(*this);
+        packNumberArrays_ = (parseFlags & kParsePackNumberArraysFlag) != 0;
+#if RAPIDJSON_ALLOCATION_STATS
+        BeginAllocationStats();
+#endif
         parseResult_ = reader.template Parse<parseFlags>(is, *this);
+#if RAPIDJSON_ALLOCATION_STATS
+        EndAllocationStats(reader);
+#endif
         if (parseResult_) {
             RAPIDJSON_ASSERT(stack_.GetSize() == sizeof(ValueType)); // Got one and only one root object
             ValueType::operator=(*stack_.template Pop<ValueType>(1));// Move value from stack to document
@@ -2177,6 +2664,83 @@ public:
     }
     //!@}
 
+    //!@name Parse with a path filter
+    //!@{
+
+    //! Parse JSON text from an input stream, keeping only the values selected by a path filter (with Encoding conversion)
+    /*! Values dropped by the filter are never pushed onto the parsing stack, nor
+        allocated with the document's allocator. They are skipped by the reader
+        (see \ref kParseSkipValueFlag), so their content is not validated.
+        Include "pathfilter.h" to use this.
+        \tparam parseFlags Combination of \ref ParseFlag.
+        \tparam SourceEncoding Encoding of input stream
+        \tparam InputStream Type of input stream, implementing Stream concept
+        \param is Input stream to be parsed.
+        \param filter Patterns selecting the values to keep, see GenericPathFilter.
+        \return The document itself for fluent API.
+    */
+    template <unsigned parseFlags, typename SourceEncoding, typename InputStream, typename FilterAllocator>
+    GenericDocument& ParseStream(InputStream& is, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        GenericReader<SourceEncoding, Encoding, StackAllocator> reader(
+            stack_.HasAllocator() ? &stack_.GetAllocator() : 0);
+        ClearStackOnExit scope(*this);
+        GenericFilteredHandler<GenericPathFilter<Encoding, FilterAllocator>, GenericDocument, StackAllocator> handler(
+            filter, *this, stack_.HasAllocator() ? &stack_.GetAllocator() : 0);
+        packNumberArrays_ = (parseFlags & kParsePackNumberArraysFlag) != 0;
+#if RAPIDJSON_ALLOCATION_STATS
+        BeginAllocationStats();
+#endif
+        parseResult_ = reader.template Parse<parseFlags | kParseSkipValueFlag>(is, handler);
+#if RAPIDJSON_ALLOCATION_STATS
+        EndAllocationStats(reader);
+#endif
+        if (parseResult_) {
+            RAPIDJSON_ASSERT(stack_.GetSize() == sizeof(ValueType)); // Got one and only one root object
+            ValueType::operator=(*stack_.template Pop<ValueType>(1));// Move value from stack to document
+        }
+        return *this;
+    }
+
+    //! Parse JSON text from an input stream, keeping only the values selected by a path filter
+    template <unsigned parseFlags, typename InputStream, typename FilterAllocator>
+    GenericDocument& ParseStream(InputStream& is, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        return ParseStream<parseFlags, Encoding>(is, filter);
+    }
+
+    //! Parse JSON text from an input stream, keeping only the values selected by a path filter (with \ref kParseDefaultFlags)
+    template <typename InputStream, typename FilterAllocator>
+    GenericDocument& ParseStream(InputStream& is, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        return ParseStream<kParseDefaultFlags, Encoding>(is, filter);
+    }
+
+    //! Parse JSON text from a mutable string, keeping only the values selected by a path filter
+    template <unsigned parseFlags, typename FilterAllocator>
+    GenericDocument& ParseInsitu(Ch* str, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        GenericInsituStringStream<Encoding> s(str);
+        return ParseStream<parseFlags | kParseInsituFlag>(s, filter);
+    }
+
+    //! Parse JSON text from a mutable string, keeping only the values selected by a path filter (with \ref kParseDefaultFlags)
+    template <typename FilterAllocator>
+    GenericDocument& ParseInsitu(Ch* str, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        return ParseInsitu<kParseDefaultFlags>(str, filter);
+    }
+
+    //! Parse JSON text from a read-only string, keeping only the values selected by a path filter
+    template <unsigned parseFlags, typename FilterAllocator>
+    GenericDocument& Parse(const Ch* str, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        RAPIDJSON_ASSERT(!(parseFlags & kParseInsituFlag));
+        GenericStringStream<Encoding> s(str);
+        return ParseStream<parseFlags>(s, filter);
+    }
+
+    //! Parse JSON text from a read-only string, keeping only the values selected by a path filter (with \ref kParseDefaultFlags)
+    template <typename FilterAllocator>
+    GenericDocument& Parse(const Ch* str, const GenericPathFilter<Encoding, FilterAllocator>& filter) {
+        return Parse<kParseDefaultFlags>(str, filter);
+    }
+    //!@}
+
     //!@name Parse in-place from mutable string
     //!@{
 
@@ -2304,6 +2868,17 @@ public:
     //! Get the capacity of stack in bytes.
     size_t GetStackCapacity() const { return stack_.GetCapacity(); }
 
+#if RAPIDJSON_ALLOCATION_STATS
+    //! Get the memory allocated by the last parsing.
+    /*! The blocks and chunks are counted by the allocator when it is a
+        \c CrtAllocator or a \c MemoryPoolAllocator, and are 0 otherwise. The
+        stacks are the one of the document, whose peak size tells the
+        \c stackCapacity to construct the document with, and those of the reader.
+        \note Requires \ref RAPIDJSON_ALLOCATION_STATS.
+    */
+    const AllocationStats& GetAllocationStats() const { return allocationStats_; }
+#endif
+
 private:
     // clear stack on any exit from ParseStream, e.g. due to exception
     struct ClearStackOnExit {
@@ -2318,6 +2893,7 @@ private:
     // callers of the following private Handler functions
     // template <typename,typename,typename> friend class GenericReader; // for parsing
     template <typename, typename> friend class GenericValue; // for deep copying
+    template <typename, typename, typename> friend class GenericParallelParser; // for parsing elements onto the stack
 
 public:
     // Implementation of Handler
@@ -2329,6 +2905,20 @@ public:
     bool Uint64(uint64_t i) { new (stack_.template Push<ValueType>()) ValueType(i); return true; }
     bool Double(double d) { new (stack_.template Push<ValueType>()) ValueType(d); return true; }
 
+    bool Doubles(const double* values, SizeType count) {
+        ValueType* v = stack_.template Push<ValueType>(count);
+        for (SizeType i = 0; i < count; i++)
+            new (v + i) ValueType(values[i]);
+        return true;
+    }
+
+    bool Int64s(const int64_t* values, SizeType count) {
+        ValueType* v = stack_.template Push<ValueType>(count);
+        for (SizeType i = 0; i < count; i++)
+            new (v + i) ValueType(values[i]);
+        return true;
+    }
+
     bool RawNumber(const Ch* str, SizeType length, bool copy) { 
         if (copy) 
             new (stack_.template Push<ValueType>()) ValueType(str, length, GetAllocator());
@@ -2359,7 +2949,9 @@ public:
     
     bool EndArray(SizeType elementCount) {
         ValueType* elements = stack_.template Pop<ValueType>(elementCount);
-        stack_.template Top<ValueType>()->SetArrayRaw(elements, elementCount, GetAllocator());
+        ValueType* array = stack_.template Top<ValueType>();
+        if (!packNumberArrays_ || !array->SetNumberArrayRaw(elements, elementCount, GetAllocator()))
+            array->SetArrayRaw(elements, elementCount, GetAllocator());
         return true;
     }
 
@@ -2382,11 +2974,52 @@ private:
         RAPIDJSON_DELETE(ownAllocator_);
     }
 
+    // Allocators which need Free() have got their memory back from the values already.
+    template <typename A>
+    static void ResetAllocator(A&) {}
+
+    template <typename BaseAllocator>
+    static void ResetAllocator(MemoryPoolAllocator<BaseAllocator>& a) { a.Reset(); }
+
+#if RAPIDJSON_ALLOCATION_STATS
+    void BeginAllocationStats() {
+        allocationStats_ = GetAllocatorStats(*allocator_);
+        stack_.ResetStats();
+    }
+
+    template <typename Reader>
+    void EndAllocationStats(const Reader& reader) {
+        const AllocationStats begin = allocationStats_;
+        const AllocationStats end = GetAllocatorStats(*allocator_);
+        allocationStats_ = reader.GetAllocationStats();
+        allocationStats_.allocationCount = end.allocationCount - begin.allocationCount;
+        allocationStats_.allocatedBytes = end.allocatedBytes - begin.allocatedBytes;
+        allocationStats_.chunkCount = end.chunkCount - begin.chunkCount;
+        allocationStats_.chunkBytes = end.chunkBytes - begin.chunkBytes;
+        allocationStats_.stackResizeCount += stack_.GetResizeCount();
+        allocationStats_.stackBytes += stack_.GetResizeBytes();
+        allocationStats_.peakStackSize = stack_.GetPeakSize();
+    }
+
+    // Other allocators are not counted.
+    template <typename A>
+    static AllocationStats GetAllocatorStats(const A&) { return AllocationStats(); }
+
+    template <typename BaseAllocator>
+    static AllocationStats GetAllocatorStats(const MemoryPoolAllocator<BaseAllocator>& a) { return a.GetAllocationStats(); }
+
+    static AllocationStats GetAllocatorStats(const CrtAllocator& a) { return a.GetAllocationStats(); }
+#endif
+
     static const size_t kDefaultStackCapacity = 1024;
     Allocator* allocator_;
     Allocator* ownAllocator_;
     internal::Stack<StackAllocator> stack_;
     ParseResult parseResult_;
+    bool packNumberArrays_;             //!< kParsePackNumberArraysFlag of the current parsing.
+#if RAPIDJSON_ALLOCATION_STATS
+    AllocationStats allocationStats_;   //!< Counters of the last parsing.
+#endif
 };
 
 //! GenericDocument with UTF8 encoding
@@ -2400,7 +3033,11 @@ GenericValue<Encoding,Allocator>::GenericValue(const GenericValue<Encoding,Sourc
 {
     switch (rhs.GetType()) {
     case kObjectType:
-    case kArrayType: { // perform deep copy via SAX Handler
+    case kArrayType:
+        if (rhs.IsPackedArray())    // both packed types have 8-byte numbers
+            std::memcpy(SetPackedArrayRaw<double>(rhs.data_.f.flags, rhs.data_.a.size, allocator),
+                rhs.template GetPackedElements<double>(), rhs.data_.a.size * sizeof(double));
+        else { // perform deep copy via SAX Handler
             GenericDocument<Encoding,Allocator> d(&allocator);
             rhs.Accept(d);
             RawAssign(*d.stack_.template Pop<GenericValue>(1));
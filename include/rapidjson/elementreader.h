@@ -0,0 +1,217 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_ELEMENTREADER_H_
+#define RAPIDJSON_ELEMENTREADER_H_
+
+#include "document.h"
+#include "pointer.h"
+#include "pullreader.h"
+#include <cstring>
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericElementReader
+
+//! Reads the elements of an array in a JSON text one at a time, each into a small document.
+/*!
+    Loading a whole GeoJSON FeatureCollection only to iterate its "features"
+    needs memory for all of them. The element reader streams through the
+    text to the array identified by a JSON pointer, skipping the other values
+    without decoding them, and then parses each element of the array into
+    the same document, which is emptied with GenericDocument::Reset() before
+    each element. So with MemoryPoolAllocator, the memory used is bounded by
+    the largest element rather than by the whole text.
+
+    \code
+    FILE* fp = fopen("features.json", "rb");
+    char buffer[65536];
+    FileReadStream is(fp, buffer, sizeof(buffer));
+    GenericElementReader<UTF8<>, FileReadStream> r(is, Pointer("/features"));
+    while (r.Next()) {
+        const Document& feature = r.GetElement();
+        // ...
+    }
+    if (r.HasParseError())
+        // ...
+    \endcode
+
+    After the last element, the rest of the text is skipped with structural
+    checks only, so Next() only returns \c false without an error for a
+    well-formed text.
+
+    \tparam Encoding Encoding of the input stream and of the documents.
+    \tparam InputStream Type of input stream, implementing Stream concept.
+    \tparam parseFlags Combination of \ref ParseFlag. \ref kParseStructuralIndexFlag
+        and \ref kParsePackNumberArraysFlag are ignored.
+    \tparam Allocator Allocator of the document of the elements.
+    \tparam StackAllocator Allocator for the parsing stacks.
+*/
+template <typename Encoding, typename InputStream, unsigned parseFlags = kParseDefaultFlags, typename Allocator = MemoryPoolAllocator<>, typename StackAllocator = CrtAllocator>
+class GenericElementReader {
+public:
+    typedef typename Encoding::Ch Ch;   //!< Character type of the documents.
+    typedef GenericDocument<Encoding, Allocator, StackAllocator> DocumentType;  //!< Document type of the elements.
+    typedef GenericPullReader<Encoding, Encoding, InputStream, parseFlags, StackAllocator> PullReaderType;   //!< Pull reader finding the array.
+
+    //! Constructor finding the array at a JSON pointer.
+    /*! Reads the text up to the beginning of the array, see HasArray().
+        \param is Input stream to be parsed, must outlive the element reader.
+        \param pointer Valid JSON pointer to the array. It is not used after construction.
+        \param allocator Optional allocator of the document of the elements. It is reset before each element.
+        \param stackAllocator Optional allocator for the parsing stacks.
+    */
+    template <typename ValueType, typename PointerAllocator>
+    GenericElementReader(InputStream& is, const GenericPointer<ValueType, PointerAllocator>& pointer, Allocator* allocator = 0, StackAllocator* stackAllocator = 0) :
+        pull_(is, stackAllocator), document_(allocator, kDefaultStackCapacity, stackAllocator), index_(), hasArray_(), done_()
+    {
+        RAPIDJSON_ASSERT(pointer.IsValid());
+        hasArray_ = Find(pointer.GetTokens(), pointer.GetTokenCount());
+        done_ = !hasArray_;
+    }
+
+    //! Constructor for the elements of the root array.
+    /*! \param is Input stream to be parsed, must outlive the element reader.
+        \param allocator Optional allocator of the document of the elements. It is reset before each element.
+        \param stackAllocator Optional allocator for the parsing stacks.
+    */
+    explicit GenericElementReader(InputStream& is, Allocator* allocator = 0, StackAllocator* stackAllocator = 0) :
+        pull_(is, stackAllocator), document_(allocator, kDefaultStackCapacity, stackAllocator), index_(), hasArray_(), done_()
+    {
+        hasArray_ = Find(static_cast<const Token*>(0), 0);
+        done_ = !hasArray_;
+    }
+
+    //! Parse the next element into GetElement().
+    /*! All the values of the previous element become invalid.
+        \return \c false after the last element, if there is no array, or on
+            error, see HasParseError().
+    */
+    bool Next() {
+        if (done_)
+            return false;
+        document_.Reset();
+        ElementGenerator g(pull_);
+        document_.Populate(g);
+        if (g.parsed) {
+            index_++;
+            return true;
+        }
+        done_ = true;
+        if (!pull_.HasParseError())
+            while (pull_.Next())    // check the rest of the text
+                pull_.Skip();
+        return false;
+    }
+
+    //! Document holding the current element.
+    /*! It is null before the first element and after the last one.
+        \warning It is reset by the next call to Next(), including its allocator.
+    */
+    DocumentType& GetElement() { return document_; }
+    //! Document holding the current element.
+    const DocumentType& GetElement() const { return document_; }
+
+    //! Index of the current element in the array.
+    SizeType GetIndex() const { RAPIDJSON_ASSERT(index_ > 0); return index_ - 1; }
+
+    //! Whether the JSON pointer has been found, as an array.
+    /*! When \c false without a parse error, the pointer refers to no value or
+        to a value which is not an array, and Next() returns \c false.
+    */
+    bool HasArray() const { return hasArray_; }
+
+    //! Whether a parse error has occured.
+    bool HasParseError() const { return pull_.HasParseError(); }
+
+    //! Get the \ref ParseErrorCode of the parsing.
+    ParseErrorCode GetParseErrorCode() const { return pull_.GetParseErrorCode(); }
+
+    //! Get the position of the parsing error in input, 0 otherwise.
+    size_t GetErrorOffset() const { return pull_.GetErrorOffset(); }
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericElementReader(const GenericElementReader&);
+    GenericElementReader& operator=(const GenericElementReader&);
+
+    typedef typename GenericPointer<GenericValue<Encoding> >::Token Token;
+
+    // Sends the events of the next element to the document, for GenericDocument::Populate().
+    struct ElementGenerator {
+        explicit ElementGenerator(PullReaderType& p) : pull(p), parsed() {}
+        template <typename Handler>
+        bool operator()(Handler& handler) { return parsed = pull.ParseElement(handler); }
+
+        PullReaderType& pull;
+        bool parsed;
+    };
+
+    // Reads up to the value of the tokens, skipping the other values, and
+    // returns whether it is an array.
+    template <typename PointerToken>
+    bool Find(const PointerToken* tokens, size_t tokenCount) {
+        if (!pull_.Next())
+            return false;
+        for (size_t i = 0; i < tokenCount; i++) {
+            const PointerToken& t = tokens[i];
+            if (pull_.GetToken() == kPullTokenStartObject) {
+                for (;;) {
+                    if (!pull_.Next() || pull_.GetToken() != kPullTokenKey)
+                        return false;
+                    if (pull_.GetStringLength() == t.length && std::memcmp(pull_.GetString(), t.name, t.length * sizeof(Ch)) == 0)
+                        break;
+                    if (!pull_.Skip())
+                        return false;
+                }
+            }
+            else if (pull_.GetToken() == kPullTokenStartArray && t.index != kPointerInvalidIndex) {
+                for (SizeType j = 0; j < t.index; j++)
+                    if (!pull_.Next() || pull_.GetToken() == kPullTokenEndArray || !pull_.Skip())
+                        return false;
+            }
+            else
+                return false;
+            if (!pull_.Next())
+                return false;
+            if (pull_.GetToken() == kPullTokenEndArray)    // index past the end
+                return false;
+        }
+        return pull_.GetToken() == kPullTokenStartArray;
+    }
+
+    static const size_t kDefaultStackCapacity = 1024;
+    PullReaderType pull_;
+    DocumentType document_;
+    SizeType index_;
+    bool hasArray_;
+    bool done_;
+};
+
+//! Element reader of UTF-8 strings, with default flags.
+typedef GenericElementReader<UTF8<>, StringStream> ElementReader;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_ELEMENTREADER_H_
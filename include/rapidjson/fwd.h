@@ -89,6 +89,21 @@ class GenericReader;
 
 typedef GenericReader<UTF8<char>, UTF8<char>, CrtAllocator> Reader;
 
+// chunkedreader.h
+
+template <typename SourceEncoding, typename TargetEncoding, unsigned parseFlags, typename StackAllocator>
+class GenericChunkedReader;
+
+// pullreader.h
+
+template <typename SourceEncoding, typename TargetEncoding, typename InputStream, unsigned parseFlags, typename StackAllocator>
+class GenericPullReader;
+
+// elementreader.h
+
+template <typename Encoding, typename InputStream, unsigned parseFlags, typename Allocator, typename StackAllocator>
+class GenericElementReader;
+
 // writer.h
 
 template<typename OutputStream, typename SourceEncoding, typename TargetEncoding, typename StackAllocator, unsigned writeFlags>
@@ -120,6 +135,18 @@ class GenericDocument;
 
 typedef GenericDocument<UTF8<char>, MemoryPoolAllocator<CrtAllocator>, CrtAllocator> Document;
 
+// lazydocument.h
+
+template <typename Encoding, typename Allocator>
+class GenericLazyValue;
+
+typedef GenericLazyValue<UTF8<char>, MemoryPoolAllocator<CrtAllocator> > LazyValue;
+
+template <typename Encoding, typename Allocator>
+class GenericLazyDocument;
+
+typedef GenericLazyDocument<UTF8<char>, MemoryPoolAllocator<CrtAllocator> > LazyDocument;
+
 // pointer.h
 
 template <typename ValueType, typename Allocator>
@@ -127,6 +154,45 @@ class GenericPointer;
 
 typedef GenericPointer<Value, CrtAllocator> Pointer;
 
+// pathfilter.h
+
+template <typename Encoding, typename Allocator>
+class GenericPathFilter;
+
+typedef GenericPathFilter<UTF8<char>, CrtAllocator> PathFilter;
+
+template <typename PathFilterType, typename OutputHandler, typename StateAllocator>
+class GenericFilteredHandler;
+
+// ndjson.h
+
+template <typename Encoding, typename Allocator, typename StackAllocator>
+class GenericNDJsonParser;
+
+typedef GenericNDJsonParser<UTF8<char>, MemoryPoolAllocator<CrtAllocator>, MemoryPoolAllocator<CrtAllocator> > NDJsonParser;
+
+// parallelparser.h
+
+template <typename Encoding, typename Allocator, typename StackAllocator>
+class GenericParallelParser;
+
+typedef GenericParallelParser<UTF8<char>, MemoryPoolAllocator<CrtAllocator>, CrtAllocator> ParallelParser;
+
+// binding.h
+
+template <typename T>
+struct StructBinding;
+
+template <typename T, typename Encoding, typename StackAllocator>
+class GenericBindingHandler;
+
+// keyset.h
+
+template <typename CharType, typename Allocator>
+class GenericKeySet;
+
+typedef GenericKeySet<char, CrtAllocator> KeySet;
+
 // schema.h
 
 template <typename SchemaDocumentType>
@@ -0,0 +1,74 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_INTERNAL_BITSCAN_H_
+#define RAPIDJSON_INTERNAL_BITSCAN_H_
+
+#include "../rapidjson.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_BitScanForward)
+#if defined(_M_AMD64)
+#pragma intrinsic(_BitScanForward64)
+#endif
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+namespace internal {
+
+//! Index of the lowest set bit, \c bits must not be zero.
+inline unsigned CountTrailingZero64(uint64_t bits) {
+    RAPIDJSON_ASSERT(bits != 0);
+#if defined(_MSC_VER) && defined(_M_AMD64)
+    unsigned long offset;
+    _BitScanForward64(&offset, bits);
+    return static_cast<unsigned>(offset);
+#elif defined(_MSC_VER)
+    unsigned long offset;
+    if (static_cast<uint32_t>(bits) != 0)
+        _BitScanForward(&offset, static_cast<uint32_t>(bits));
+    else {
+        _BitScanForward(&offset, static_cast<uint32_t>(bits >> 32));
+        offset += 32;
+    }
+    return static_cast<unsigned>(offset);
+#elif defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+    unsigned offset = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        offset++;
+    }
+    return offset;
+#endif
+}
+
+//! Number of set bits.
+inline unsigned PopCount64(uint64_t bits) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(bits));
+#else
+    bits -= (bits >> 1) & RAPIDJSON_UINT64_C2(0x55555555, 0x55555555);
+    bits = (bits & RAPIDJSON_UINT64_C2(0x33333333, 0x33333333)) + ((bits >> 2) & RAPIDJSON_UINT64_C2(0x33333333, 0x33333333));
+    bits = (bits + (bits >> 4)) & RAPIDJSON_UINT64_C2(0x0F0F0F0F, 0x0F0F0F0F);
+    return static_cast<unsigned>((bits * RAPIDJSON_UINT64_C2(0x01010101, 0x01010101)) >> 56);
+#endif
+}
+
+} // namespace internal
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_INTERNAL_BITSCAN_H_
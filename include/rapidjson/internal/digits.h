@@ -0,0 +1,163 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_INTERNAL_DIGITS_H_
+#define RAPIDJSON_INTERNAL_DIGITS_H_
+
+#include "bitscan.h"
+#include <cstring>
+
+#ifdef RAPIDJSON_SSE42
+#include <nmmintrin.h>
+#elif defined(RAPIDJSON_SSE2)
+#include <emmintrin.h>
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+namespace internal {
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+//! Bit i is set when byte i of the block is a digit.
+inline unsigned DigitMask(__m128i block) {
+    const __m128i lo = _mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1));
+    const __m128i hi = _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(lo, hi)));
+}
+
+//! Bit i is set when byte i of the block is '0'.
+inline unsigned ZeroMask(__m128i block) {
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8('0'))));
+}
+#endif
+
+//! Counts the digits at the start of a null-terminated string, at most 16.
+/*!
+    \param p Start of the digits.
+    \param[out] zeros Number of leading '0' characters, at most the returned count.
+    \return Number of consecutive digits.
+    \note With SSE2/SSE4.2 the digits are classified 16 at a time from aligned
+        blocks, and a block is only read if it holds a character of the
+        string, so the read cannot cross into an unmapped page.
+*/
+inline unsigned CountDigits(const char* p, unsigned& zeros) {
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+    const char* aligned = reinterpret_cast<const char*>(reinterpret_cast<size_t>(p) & ~static_cast<size_t>(15));
+    const unsigned offset = static_cast<unsigned>(p - aligned);
+    const __m128i first = _mm_load_si128(reinterpret_cast<const __m128i*>(aligned));
+    uint64_t digits = DigitMask(first);
+    uint64_t zeroBits = ZeroMask(first);
+    if ((digits >> offset) == (0xFFFFu >> offset)) {
+        // All digits up to the end of the block: the next block is still part of the string.
+        const __m128i second = _mm_load_si128(reinterpret_cast<const __m128i*>(aligned + 16));
+        digits |= static_cast<uint64_t>(DigitMask(second)) << 16;
+        zeroBits |= static_cast<uint64_t>(ZeroMask(second)) << 16;
+    }
+    digits >>= offset;
+    zeroBits >>= offset;
+    unsigned count = CountTrailingZero64(~digits);
+    if (count > 16)
+        count = 16;
+    zeros = CountTrailingZero64(~zeroBits);
+    if (zeros > count)
+        zeros = count;
+    return count;
+#else
+    unsigned count = 0;
+    while (count < 16 && p[count] >= '0' && p[count] <= '9')
+        count++;
+    zeros = 0;
+    while (zeros < count && p[zeros] == '0')
+        zeros++;
+    return count;
+#endif
+}
+
+#ifdef RAPIDJSON_SSE42
+//! Value of the eight digits (0-9) in the low 64 bits, most significant first.
+inline uint32_t ConvertEightDigits(__m128i v) {
+    // Multiply-add neighbouring digits, then pairs, then quadruples.
+    v = _mm_maddubs_epi16(v, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    v = _mm_madd_epi16(v, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    v = _mm_packus_epi32(v, v);
+    v = _mm_madd_epi16(v, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+}
+#elif RAPIDJSON_ENDIAN == RAPIDJSON_LITTLEENDIAN
+//! Value of eight digit characters loaded into a little-endian integer, or zero bytes.
+inline uint32_t ConvertEightDigits(uint64_t v) {
+    // The same multiply-adds within a 64-bit register.
+    v = ((v & RAPIDJSON_UINT64_C2(0x0F0F0F0F, 0x0F0F0F0F)) * 2561) >> 8;
+    v = ((v & RAPIDJSON_UINT64_C2(0x00FF00FF, 0x00FF00FF)) * 6553601) >> 16;
+    return static_cast<uint32_t>(((v & RAPIDJSON_UINT64_C2(0x0000FFFF, 0x0000FFFF)) * RAPIDJSON_UINT64_C2(0x00002710, 0x00000001)) >> 32);
+}
+#endif
+
+//! Converts exactly eight digit characters to their value.
+inline uint32_t ParseEightDigits(const char* p) {
+#ifdef RAPIDJSON_SSE42
+    return ConvertEightDigits(_mm_sub_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0')));
+#elif RAPIDJSON_ENDIAN == RAPIDJSON_LITTLEENDIAN
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return ConvertEightDigits(v);
+#else
+    uint32_t v = 0;
+    for (int i = 0; i < 8; i++)
+        v = v * 10 + static_cast<uint32_t>(p[i] - '0');
+    return v;
+#endif
+}
+
+//! 10^n for n in [0, 8].
+inline uint32_t Pow10Digits(unsigned n) {
+    static const uint32_t e[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    RAPIDJSON_ASSERT(n <= 8);
+    return e[n];
+}
+
+//! Converts the first \c count (at most 8) digits of a null-terminated string.
+/*! The \c count characters must be digits, as counted by CountDigits(). */
+inline uint32_t ParseDigits(const char* p, unsigned count) {
+    RAPIDJSON_ASSERT(count <= 8);
+    if (count == 8)
+        return ParseEightDigits(p);
+    if (count == 0)
+        return 0;
+
+#if defined(RAPIDJSON_SSE42) || RAPIDJSON_ENDIAN == RAPIDJSON_LITTLEENDIAN
+    if ((reinterpret_cast<size_t>(p) & 4095) <= 4096 - 8) {
+        // Load eight characters within the page and shift out those after the digits,
+        // which leaves leading zeros.
+        const int shift = static_cast<int>(8 * (8 - count));
+#ifdef RAPIDJSON_SSE42
+        const __m128i v = _mm_sub_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi8('0'));
+        return ConvertEightDigits(_mm_sll_epi64(v, _mm_cvtsi32_si128(shift)));
+#else
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return ConvertEightDigits(v << shift);
+#endif
+    }
+#endif
+
+    uint32_t v = 0;
+    for (unsigned i = 0; i < count; i++)
+        v = v * 10 + static_cast<uint32_t>(p[i] - '0');
+    return v;
+}
+
+} // namespace internal
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_INTERNAL_DIGITS_H_
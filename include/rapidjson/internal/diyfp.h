@@ -40,6 +40,26 @@ RAPIDJSON_DIAG_PUSH
 RAPIDJSON_DIAG_OFF(padded)
 #endif
 
+//! Full 128-bit product of two 64-bit integers.
+/*! \return The low 64 bits, with the high 64 bits in \c high. */
+inline uint64_t Multiply128(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(_MSC_VER) && defined(_M_AMD64)
+    return _umul128(a, b, high);
+#elif (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6)) && defined(__x86_64__)
+    __extension__ typedef unsigned __int128 uint128;
+    const uint128 p = static_cast<uint128>(a) * static_cast<uint128>(b);
+    *high = static_cast<uint64_t>(p >> 64);
+    return static_cast<uint64_t>(p);
+#else
+    const uint64_t M32 = 0xFFFFFFFF;
+    const uint64_t a0 = a & M32, a1 = a >> 32, b0 = b & M32, b1 = b >> 32;
+    const uint64_t x0 = a0 * b0, x1 = a0 * b1, x2 = a1 * b0, x3 = a1 * b1;
+    const uint64_t middle = (x0 >> 32) + (x1 & M32) + (x2 & M32);
+    *high = x3 + (x1 >> 32) + (x2 >> 32) + (middle >> 32);
+    return (middle << 32) | (x0 & M32);
+#endif
+}
+
 struct DiyFp {
     DiyFp() : f(), e() {}
 
@@ -22,6 +22,7 @@
 #include "itoa.h" // GetDigitsLut()
 #include "diyfp.h"
 #include "ieee754.h"
+#include "schubfach.h"
 
 RAPIDJSON_NAMESPACE_BEGIN
 namespace internal {
@@ -229,7 +230,11 @@ inline char* dtoa(double value, char* buffer, int maxDecimalPlaces = 324) {
             value = -value;
         }
         int length, K;
+#if RAPIDJSON_SCHUBFACH
+        Schubfach(value, buffer, &length, &K);
+#else
         Grisu2(value, buffer, &length, &K);
+#endif
         return Prettify(buffer, length, K, maxDecimalPlaces);
     }
 }
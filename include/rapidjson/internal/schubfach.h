@@ -0,0 +1,775 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// This is a C++ header-only implementation of the Schubfach algorithm from:
+// Giulietti, Raffaello. "The Schubfach way to render doubles." (2020).
+
+#ifndef RAPIDJSON_SCHUBFACH_
+#define RAPIDJSON_SCHUBFACH_
+
+#include "itoa.h"
+#include "diyfp.h" // Multiply128()
+#include "ieee754.h"
+
+RAPIDJSON_NAMESPACE_BEGIN
+namespace internal {
+
+//! floor(log10(2^e)) for e in [-1100, 1000].
+inline int SchubfachFloorLog10Pow2(int e) {
+    return (e * 315653) >> 20;
+}
+
+//! floor(log10(3/4 * 2^e)) for e in [-1100, 1000].
+inline int SchubfachFloorLog10ThreeQuartersPow2(int e) {
+    return (e * 631305 - 261663) >> 21;
+}
+
+//! floor(log2(10^e)) for e in [-330, 330].
+inline int SchubfachFloorLog2Pow10(int e) {
+    return (e * 1741647) >> 19;
+}
+
+//! 126-bit approximation g = g1 * 2^63 + g0 of 10^-k.
+/*! g = floor(10^-k * 2^(125 - floor(log2(10^-k)))) + 1, for k in [-324, 292].
+    \return Pointer to g1, followed by g0.
+*/
+inline const uint64_t* SchubfachPow10(int k) {
+    static const uint64_t kPow10[] = {
+        RAPIDJSON_UINT64_C2(0x4F0CEDC9, 0x5A718DD4), RAPIDJSON_UINT64_C2(0x5B01E8B0, 0x9AA0D1B5),
+        RAPIDJSON_UINT64_C2(0x7E7B160E, 0xF71C1621), RAPIDJSON_UINT64_C2(0x119CA780, 0xF767B5EE),
+        RAPIDJSON_UINT64_C2(0x652F44D8, 0xC5B011B4), RAPIDJSON_UINT64_C2(0x0E16EC67, 0x2C52F7F2),
+        RAPIDJSON_UINT64_C2(0x50F29D7A, 0x37C00E29), RAPIDJSON_UINT64_C2(0x581256B8, 0xF0425FF5),
+        RAPIDJSON_UINT64_C2(0x40C21794, 0xF96671BA), RAPIDJSON_UINT64_C2(0x79A84560, 0xC0351991),
+        RAPIDJSON_UINT64_C2(0x679CF287, 0xF570B5F7), RAPIDJSON_UINT64_C2(0x75DA089A, 0xCD21C281),
+        RAPIDJSON_UINT64_C2(0x52E3F539, 0x9126F7F9), RAPIDJSON_UINT64_C2(0x44AE6D48, 0xA41B0201),
+        RAPIDJSON_UINT64_C2(0x424FF761, 0x40EBF994), RAPIDJSON_UINT64_C2(0x36F1F106, 0xE9AF34CD),
+        RAPIDJSON_UINT64_C2(0x6A198BCE, 0xCE465C20), RAPIDJSON_UINT64_C2(0x57E981A4, 0xA918547B),
+        RAPIDJSON_UINT64_C2(0x54E13CA5, 0x71D1E34D), RAPIDJSON_UINT64_C2(0x2CBACE1D, 0x541376C9),
+        RAPIDJSON_UINT64_C2(0x43E763B7, 0x8E4182A4), RAPIDJSON_UINT64_C2(0x23C8A4E4, 0x4342C56E),
+        RAPIDJSON_UINT64_C2(0x6CA56C58, 0xE39C043A), RAPIDJSON_UINT64_C2(0x060DD4A0, 0x6B9E08B0),
+        RAPIDJSON_UINT64_C2(0x56EABD13, 0xE9499CFB), RAPIDJSON_UINT64_C2(0x1E7176E6, 0xBC7E6D59),
+        RAPIDJSON_UINT64_C2(0x45889743, 0x2107B0C8), RAPIDJSON_UINT64_C2(0x7EC12BEB, 0xC9FEBDE1),
+        RAPIDJSON_UINT64_C2(0x6F40F205, 0x01A5E7A7), RAPIDJSON_UINT64_C2(0x7E01DFDF, 0xA9979635),
+        RAPIDJSON_UINT64_C2(0x5900C19D, 0x9AEB1FB9), RAPIDJSON_UINT64_C2(0x4B34B319, 0x547944F7),
+        RAPIDJSON_UINT64_C2(0x4733CE17, 0xAF227FC7), RAPIDJSON_UINT64_C2(0x55C3C27A, 0xA9FA9D93),
+        RAPIDJSON_UINT64_C2(0x71EC7CF2, 0xB1D0CC72), RAPIDJSON_UINT64_C2(0x560603F7, 0x765DC8EA),
+        RAPIDJSON_UINT64_C2(0x5B239728, 0x8E40A38E), RAPIDJSON_UINT64_C2(0x7804CFF9, 0x2B7E3A55),
+        RAPIDJSON_UINT64_C2(0x48E945BA, 0x0B66E93F), RAPIDJSON_UINT64_C2(0x13370CC7, 0x55FE9511),
+        RAPIDJSON_UINT64_C2(0x74A86F90, 0x123E41FE), RAPIDJSON_UINT64_C2(0x51F1AE0B, 0xBCCA881B),
+        RAPIDJSON_UINT64_C2(0x5D538C73, 0x41CB67FE), RAPIDJSON_UINT64_C2(0x74C15809, 0x63D539AF),
+        RAPIDJSON_UINT64_C2(0x4AA93D29, 0x016F8665), RAPIDJSON_UINT64_C2(0x43CDE007, 0x8310FAF3),
+        RAPIDJSON_UINT64_C2(0x77752EA8, 0x024C0A3C), RAPIDJSON_UINT64_C2(0x0616333F, 0x381B2B1E),
+        RAPIDJSON_UINT64_C2(0x5F90F220, 0x01D66E96), RAPIDJSON_UINT64_C2(0x3811C298, 0xF9AF55B1),
+        RAPIDJSON_UINT64_C2(0x4C73F4E6, 0x67DEBEDE), RAPIDJSON_UINT64_C2(0x600E3547, 0x2E25DE28),
+        RAPIDJSON_UINT64_C2(0x7A532170, 0xA6313164), RAPIDJSON_UINT64_C2(0x3349EED8, 0x49D6303F),
+        RAPIDJSON_UINT64_C2(0x61DC1AC0, 0x84F42783), RAPIDJSON_UINT64_C2(0x42A18BE0, 0x3B11C033),
+        RAPIDJSON_UINT64_C2(0x4E49AF00, 0x6A5CEC69), RAPIDJSON_UINT64_C2(0x1BB46FE6, 0x95A7CCF5),
+        RAPIDJSON_UINT64_C2(0x7D42B19A, 0x43C7E0A8), RAPIDJSON_UINT64_C2(0x2C53E63D, 0xBC3FAE55),
+        RAPIDJSON_UINT64_C2(0x64355AE1, 0xCFD31A20), RAPIDJSON_UINT64_C2(0x237651CA, 0xFCFFBEAA),
+        RAPIDJSON_UINT64_C2(0x502AAF1B, 0x0CA8E1B3), RAPIDJSON_UINT64_C2(0x35F8416F, 0x30CC9888),
+        RAPIDJSON_UINT64_C2(0x402225AF, 0x3D53E7C2), RAPIDJSON_UINT64_C2(0x5E603458, 0xF3D6E06D),
+        RAPIDJSON_UINT64_C2(0x669D0918, 0x621FD937), RAPIDJSON_UINT64_C2(0x4A3386F4, 0xB957CD7B),
+        RAPIDJSON_UINT64_C2(0x52173A79, 0xE8197A92), RAPIDJSON_UINT64_C2(0x6E8F9F2A, 0x2DDFD796),
+        RAPIDJSON_UINT64_C2(0x41AC2EC7, 0xECE12EDB), RAPIDJSON_UINT64_C2(0x720C7F54, 0xF17FDFAB),
+        RAPIDJSON_UINT64_C2(0x69137E0C, 0xAE3517C6), RAPIDJSON_UINT64_C2(0x1CE0CBBB, 0x1BFFCC45),
+        RAPIDJSON_UINT64_C2(0x540F980A, 0x24F74638), RAPIDJSON_UINT64_C2(0x171A3C95, 0xAFFFD69E),
+        RAPIDJSON_UINT64_C2(0x433FACD4, 0xEA5F6B60), RAPIDJSON_UINT64_C2(0x127B63AA, 0xF3331218),
+        RAPIDJSON_UINT64_C2(0x6B991487, 0xDD657899), RAPIDJSON_UINT64_C2(0x6A5F05DE, 0x51EB5026),
+        RAPIDJSON_UINT64_C2(0x5614106C, 0xB11DFA14), RAPIDJSON_UINT64_C2(0x5518D17E, 0xA7EF7352),
+        RAPIDJSON_UINT64_C2(0x44DCD9F0, 0x8DB194DD), RAPIDJSON_UINT64_C2(0x2A7A4132, 0x1FF2C2A8),
+        RAPIDJSON_UINT64_C2(0x6E2E2980, 0xE2B5BAFB), RAPIDJSON_UINT64_C2(0x5D906850, 0x331E043F),
+        RAPIDJSON_UINT64_C2(0x5824EE00, 0xB55E2F2F), RAPIDJSON_UINT64_C2(0x647386A6, 0x8F4B3699),
+        RAPIDJSON_UINT64_C2(0x4683F19A, 0x2AB1BF59), RAPIDJSON_UINT64_C2(0x36C2D21E, 0xD908F87B),
+        RAPIDJSON_UINT64_C2(0x70D31C29, 0xDDE93228), RAPIDJSON_UINT64_C2(0x579E1CFE, 0x280E5A5D),
+        RAPIDJSON_UINT64_C2(0x5A427CEE, 0x4B20F4ED), RAPIDJSON_UINT64_C2(0x2C7E7D98, 0x200B7B7E),
+        RAPIDJSON_UINT64_C2(0x483530BE, 0xA280C3F1), RAPIDJSON_UINT64_C2(0x09FECAE0, 0x19A2C932),
+        RAPIDJSON_UINT64_C2(0x73884DFD, 0xD0CE064E), RAPIDJSON_UINT64_C2(0x43314499, 0xC29E0EB6),
+        RAPIDJSON_UINT64_C2(0x5C6D0B31, 0x73D8050B), RAPIDJSON_UINT64_C2(0x4F5A9D47, 0xCEE4D891),
+        RAPIDJSON_UINT64_C2(0x49F0D5C1, 0x29799DA2), RAPIDJSON_UINT64_C2(0x72AEE439, 0x7250AD41),
+        RAPIDJSON_UINT64_C2(0x764E22CE, 0xA8C295D1), RAPIDJSON_UINT64_C2(0x377E39F5, 0x83B44868),
+        RAPIDJSON_UINT64_C2(0x5EA4E8A5, 0x53CEDE41), RAPIDJSON_UINT64_C2(0x12CB6191, 0x3629D387),
+        RAPIDJSON_UINT64_C2(0x4BB72084, 0x430BE500), RAPIDJSON_UINT64_C2(0x756F8140, 0xF8217605),
+        RAPIDJSON_UINT64_C2(0x792500D3, 0x9E796E67), RAPIDJSON_UINT64_C2(0x6F18CECE, 0x59CF233C),
+        RAPIDJSON_UINT64_C2(0x60EA670F, 0xB1FABEB9), RAPIDJSON_UINT64_C2(0x3F470BD8, 0x47D8E8FD),
+        RAPIDJSON_UINT64_C2(0x4D885272, 0xF4C89894), RAPIDJSON_UINT64_C2(0x329F3CAD, 0x064720CA),
+        RAPIDJSON_UINT64_C2(0x7C0D50B7, 0xEE0DC0ED), RAPIDJSON_UINT64_C2(0x37652DE1, 0xA3A50143),
+        RAPIDJSON_UINT64_C2(0x633DDA2C, 0xBE716724), RAPIDJSON_UINT64_C2(0x2C50F181, 0x4FB73436),
+        RAPIDJSON_UINT64_C2(0x4F64AE8A, 0x31F45283), RAPIDJSON_UINT64_C2(0x3D0D8E01, 0x0C92902B),
+        RAPIDJSON_UINT64_C2(0x7F077DA9, 0xE986EA6B), RAPIDJSON_UINT64_C2(0x7B48E334, 0xE0EA8045),
+        RAPIDJSON_UINT64_C2(0x659F97BB, 0x2138BB89), RAPIDJSON_UINT64_C2(0x49071C2A, 0x4D88669D),
+        RAPIDJSON_UINT64_C2(0x514C7962, 0x80FA2FA1), RAPIDJSON_UINT64_C2(0x20D27CEE, 0xA46D1EE4),
+        RAPIDJSON_UINT64_C2(0x4109FAB5, 0x33FB594D), RAPIDJSON_UINT64_C2(0x670ECA58, 0x838A7F1D),
+        RAPIDJSON_UINT64_C2(0x680FF788, 0x532BC216), RAPIDJSON_UINT64_C2(0x0B4ADD5A, 0x6C10CB62),
+        RAPIDJSON_UINT64_C2(0x533FF939, 0xDC2301AB), RAPIDJSON_UINT64_C2(0x22A24AAE, 0xBCDA3C4E),
+        RAPIDJSON_UINT64_C2(0x4299942E, 0x49B59AEF), RAPIDJSON_UINT64_C2(0x354EA225, 0x63E1C9D8),
+        RAPIDJSON_UINT64_C2(0x6A8F537D, 0x42BC2B18), RAPIDJSON_UINT64_C2(0x554A9D08, 0x9FCFA95A),
+        RAPIDJSON_UINT64_C2(0x553F75FD, 0xCEFCEF46), RAPIDJSON_UINT64_C2(0x776EE406, 0xE63FBAAE),
+        RAPIDJSON_UINT64_C2(0x4432C4CB, 0x0BFD8C38), RAPIDJSON_UINT64_C2(0x5F8BE99F, 0x1E996225),
+        RAPIDJSON_UINT64_C2(0x6D1E07AB, 0x466279F4), RAPIDJSON_UINT64_C2(0x327975CB, 0x64289D08),
+        RAPIDJSON_UINT64_C2(0x574B3955, 0xD1E86190), RAPIDJSON_UINT64_C2(0x28612B09, 0x1CED4A6D),
+        RAPIDJSON_UINT64_C2(0x45D5C777, 0xDB204E0D), RAPIDJSON_UINT64_C2(0x06B4226D, 0xB0BDD524),
+        RAPIDJSON_UINT64_C2(0x6FBC7259, 0x5E9A167B), RAPIDJSON_UINT64_C2(0x24536A49, 0x1AC95506),
+        RAPIDJSON_UINT64_C2(0x59638EAD, 0xE54811FC), RAPIDJSON_UINT64_C2(0x1D0F883A, 0x7BD44405),
+        RAPIDJSON_UINT64_C2(0x4782D88B, 0x1DD34196), RAPIDJSON_UINT64_C2(0x4A72D361, 0xFCA9D004),
+        RAPIDJSON_UINT64_C2(0x726AF411, 0xC952028A), RAPIDJSON_UINT64_C2(0x43EAEBCF, 0xFAA94CD3),
+        RAPIDJSON_UINT64_C2(0x5B88C341, 0x6DDB353B), RAPIDJSON_UINT64_C2(0x4FEF230C, 0xC88770A9),
+        RAPIDJSON_UINT64_C2(0x493A35CD, 0xF17C2A96), RAPIDJSON_UINT64_C2(0x0CBF4F3D, 0x6D3926EE),
+        RAPIDJSON_UINT64_C2(0x7529EFAF, 0xE8C6AA89), RAPIDJSON_UINT64_C2(0x61321862, 0x485B717C),
+        RAPIDJSON_UINT64_C2(0x5DBB2626, 0x53D22207), RAPIDJSON_UINT64_C2(0x675B46B5, 0x06AF8DFD),
+        RAPIDJSON_UINT64_C2(0x4AFC1E85, 0x0FDB4E6C), RAPIDJSON_UINT64_C2(0x52AF6BC4, 0x05593E64),
+        RAPIDJSON_UINT64_C2(0x77F9CA6E, 0x7FC54A47), RAPIDJSON_UINT64_C2(0x377F12D3, 0x3BC1FD6D),
+        RAPIDJSON_UINT64_C2(0x5FFB0858, 0x66376E9F), RAPIDJSON_UINT64_C2(0x45FF4242, 0x9634CABD),
+        RAPIDJSON_UINT64_C2(0x4CC8D379, 0xEB5F8BB2), RAPIDJSON_UINT64_C2(0x6B329B68, 0x782A3BCB),
+        RAPIDJSON_UINT64_C2(0x7ADAEBF6, 0x4565AC51), RAPIDJSON_UINT64_C2(0x2B842BDA, 0x59DD2C77),
+        RAPIDJSON_UINT64_C2(0x6248BCC5, 0x045156A7), RAPIDJSON_UINT64_C2(0x3C69BCAE, 0xAE4A89F9),
+        RAPIDJSON_UINT64_C2(0x4EA09704, 0x03744552), RAPIDJSON_UINT64_C2(0x6387CA25, 0x583BA194),
+        RAPIDJSON_UINT64_C2(0x7DCDBE6C, 0xD253A21E), RAPIDJSON_UINT64_C2(0x05A6103B, 0xC05F68ED),
+        RAPIDJSON_UINT64_C2(0x64A49857, 0x0EA94E7E), RAPIDJSON_UINT64_C2(0x37B80CFC, 0x99E5ED8A),
+        RAPIDJSON_UINT64_C2(0x5083AD12, 0x72210B98), RAPIDJSON_UINT64_C2(0x2C933D96, 0xE184BE08),
+        RAPIDJSON_UINT64_C2(0x40695741, 0xF4E73C79), RAPIDJSON_UINT64_C2(0x7075CADF, 0x1AD09807),
+        RAPIDJSON_UINT64_C2(0x670EF203, 0x2171FA5C), RAPIDJSON_UINT64_C2(0x4D894498, 0x2AE759A4),
+        RAPIDJSON_UINT64_C2(0x52725B35, 0xB45B2EB0), RAPIDJSON_UINT64_C2(0x3E076A13, 0x5585E150),
+        RAPIDJSON_UINT64_C2(0x41F515C4, 0x9048F226), RAPIDJSON_UINT64_C2(0x64D2BB42, 0xAAD1810D),
+        RAPIDJSON_UINT64_C2(0x698822D4, 0x1A0E503E), RAPIDJSON_UINT64_C2(0x07B79204, 0x44826815),
+        RAPIDJSON_UINT64_C2(0x546CE8A9, 0xAE71D9CB), RAPIDJSON_UINT64_C2(0x1FC60E69, 0xD0685344),
+        RAPIDJSON_UINT64_C2(0x438A53BA, 0xF1F4AE3C), RAPIDJSON_UINT64_C2(0x196B3EBB, 0x0D20429D),
+        RAPIDJSON_UINT64_C2(0x6C1085F7, 0xE9877D2D), RAPIDJSON_UINT64_C2(0x0F11FDF8, 0x15006A94),
+        RAPIDJSON_UINT64_C2(0x56739E5F, 0xEE05FDBD), RAPIDJSON_UINT64_C2(0x58DB3193, 0x44005543),
+        RAPIDJSON_UINT64_C2(0x45294B7F, 0xF19E6497), RAPIDJSON_UINT64_C2(0x60AF5ADC, 0x3666AA9C),
+        RAPIDJSON_UINT64_C2(0x6EA878CC, 0xB5CA3A8C), RAPIDJSON_UINT64_C2(0x344BC493, 0x8A3DDDC7),
+        RAPIDJSON_UINT64_C2(0x5886C70A, 0x2B082ED6), RAPIDJSON_UINT64_C2(0x5D096A0F, 0xA1CB17D2),
+        RAPIDJSON_UINT64_C2(0x46D238D4, 0xEF39BF12), RAPIDJSON_UINT64_C2(0x173ABB3F, 0xB4A27975),
+        RAPIDJSON_UINT64_C2(0x71505AEE, 0x4B8F981D), RAPIDJSON_UINT64_C2(0x0B912B99, 0x2103F588),
+        RAPIDJSON_UINT64_C2(0x5AA6AF25, 0x093FACE4), RAPIDJSON_UINT64_C2(0x0940EFAD, 0xB4032AD3),
+        RAPIDJSON_UINT64_C2(0x488558EA, 0x6DCC8A50), RAPIDJSON_UINT64_C2(0x07672624, 0x900288A9),
+        RAPIDJSON_UINT64_C2(0x74088E43, 0xE2E0DD4C), RAPIDJSON_UINT64_C2(0x723EA36D, 0xB337410E),
+        RAPIDJSON_UINT64_C2(0x5CD3A503, 0x1BE71770), RAPIDJSON_UINT64_C2(0x5B654F8A, 0xF5C5CDA5),
+        RAPIDJSON_UINT64_C2(0x4A42EA68, 0xE31F45F3), RAPIDJSON_UINT64_C2(0x62B772D5, 0x916B0AEB),
+        RAPIDJSON_UINT64_C2(0x76D1770E, 0x38320986), RAPIDJSON_UINT64_C2(0x0458B7BC, 0x1BDE77DD),
+        RAPIDJSON_UINT64_C2(0x5F0DF8D8, 0x2CF4D46B), RAPIDJSON_UINT64_C2(0x1D13C630, 0x164B9318),
+        RAPIDJSON_UINT64_C2(0x4C0B2D79, 0xBD90A9EF), RAPIDJSON_UINT64_C2(0x30DC9E8C, 0xDEA2DC13),
+        RAPIDJSON_UINT64_C2(0x79AB7BF5, 0xFC1AA97F), RAPIDJSON_UINT64_C2(0x0160FDAE, 0x31049351),
+        RAPIDJSON_UINT64_C2(0x6155FCC4, 0xC9AEEDFF), RAPIDJSON_UINT64_C2(0x1AB3FE24, 0xF403A90E),
+        RAPIDJSON_UINT64_C2(0x4DDE63D0, 0xA158BE65), RAPIDJSON_UINT64_C2(0x6229981D, 0x9002EDA5),
+        RAPIDJSON_UINT64_C2(0x7C97061A, 0x9BC130A2), RAPIDJSON_UINT64_C2(0x69DC2695, 0xB337E2A1),
+        RAPIDJSON_UINT64_C2(0x63AC04E2, 0x163426E8), RAPIDJSON_UINT64_C2(0x54B01EDE, 0x28F9821B),
+        RAPIDJSON_UINT64_C2(0x4FBCD0B4, 0xDE901F20), RAPIDJSON_UINT64_C2(0x43C018B1, 0xBA6134E2),
+        RAPIDJSON_UINT64_C2(0x7F948121, 0x6419CB67), RAPIDJSON_UINT64_C2(0x1F99C11C, 0x5D68549D),
+        RAPIDJSON_UINT64_C2(0x6610674D, 0xE9AE3C52), RAPIDJSON_UINT64_C2(0x4C7B00E3, 0x7DED107E),
+        RAPIDJSON_UINT64_C2(0x51A6B90B, 0x21583042), RAPIDJSON_UINT64_C2(0x09FC00B5, 0xFE574065),
+        RAPIDJSON_UINT64_C2(0x41522DA2, 0x811359CE), RAPIDJSON_UINT64_C2(0x3B300091, 0x9845CD1D),
+        RAPIDJSON_UINT64_C2(0x68837C37, 0x34EBC2E3), RAPIDJSON_UINT64_C2(0x784CCDB5, 0xC06FAE95),
+        RAPIDJSON_UINT64_C2(0x539C635F, 0x5D8968B6), RAPIDJSON_UINT64_C2(0x2D0A3E2B, 0x00595877),
+        RAPIDJSON_UINT64_C2(0x42E382B2, 0xB13ABA2B), RAPIDJSON_UINT64_C2(0x3DA1CB55, 0x99E11393),
+        RAPIDJSON_UINT64_C2(0x6B059DEA, 0xB52AC378), RAPIDJSON_UINT64_C2(0x629C7888, 0xF634EC1E),
+        RAPIDJSON_UINT64_C2(0x559E17EE, 0xF755692D), RAPIDJSON_UINT64_C2(0x3549FA07, 0x2B5D89B1),
+        RAPIDJSON_UINT64_C2(0x447E798B, 0xF91120F1), RAPIDJSON_UINT64_C2(0x1107FB38, 0xEF7E07C1),
+        RAPIDJSON_UINT64_C2(0x6D9728DF, 0xF4E834B5), RAPIDJSON_UINT64_C2(0x01A65EC1, 0x7F300C68),
+        RAPIDJSON_UINT64_C2(0x57AC20B3, 0x2A535D5D), RAPIDJSON_UINT64_C2(0x4E1EB234, 0x65C009ED),
+        RAPIDJSON_UINT64_C2(0x46234D5C, 0x21DC4AB1), RAPIDJSON_UINT64_C2(0x24E55B5D, 0x1E333B24),
+        RAPIDJSON_UINT64_C2(0x70387BC6, 0x9C93AAB5), RAPIDJSON_UINT64_C2(0x216EF894, 0xFD1EC506),
+        RAPIDJSON_UINT64_C2(0x59C6C96B, 0xB076222A), RAPIDJSON_UINT64_C2(0x4DF26077, 0x30E56A6C),
+        RAPIDJSON_UINT64_C2(0x47D23ABC, 0x8D2B4E88), RAPIDJSON_UINT64_C2(0x3E5B805F, 0x5A5121F0),
+        RAPIDJSON_UINT64_C2(0x72E9F794, 0x15121740), RAPIDJSON_UINT64_C2(0x63C59A32, 0x2A1B697F),
+        RAPIDJSON_UINT64_C2(0x5BEE5FA9, 0xAA74DF67), RAPIDJSON_UINT64_C2(0x03047B5B, 0x54E2BACC),
+        RAPIDJSON_UINT64_C2(0x498B7FBA, 0xEEC3E5EC), RAPIDJSON_UINT64_C2(0x0269FC49, 0x10B5623D),
+        RAPIDJSON_UINT64_C2(0x75ABFF91, 0x7E063CAC), RAPIDJSON_UINT64_C2(0x6A432D41, 0xB45569FB),
+        RAPIDJSON_UINT64_C2(0x5E2332DA, 0xCB38308A), RAPIDJSON_UINT64_C2(0x21CF5767, 0xC37787FC),
+        RAPIDJSON_UINT64_C2(0x4B4F5BE2, 0x3C2CF3A1), RAPIDJSON_UINT64_C2(0x67D912B9, 0x692C6CCA),
+        RAPIDJSON_UINT64_C2(0x787EF969, 0xF9E185CF), RAPIDJSON_UINT64_C2(0x595B5128, 0xA8471476),
+        RAPIDJSON_UINT64_C2(0x60659454, 0xC7E79E3F), RAPIDJSON_UINT64_C2(0x6115DA86, 0xED05A9F8),
+        RAPIDJSON_UINT64_C2(0x4D1E1043, 0xD31FB1CC), RAPIDJSON_UINT64_C2(0x4DAB1538, 0xBD9E2193),
+        RAPIDJSON_UINT64_C2(0x7B634D39, 0x51CC4FAD), RAPIDJSON_UINT64_C2(0x62AB5527, 0x95C9CF52),
+        RAPIDJSON_UINT64_C2(0x62B5D761, 0x0E3D0C8B), RAPIDJSON_UINT64_C2(0x0222AA86, 0x116E3F75),
+        RAPIDJSON_UINT64_C2(0x4EF7DF80, 0xD830D6D5), RAPIDJSON_UINT64_C2(0x4E822204, 0xDABE992A),
+        RAPIDJSON_UINT64_C2(0x7E59659A, 0xF38157BC), RAPIDJSON_UINT64_C2(0x17369CD4, 0x9130F510),
+        RAPIDJSON_UINT64_C2(0x65145148, 0xC2CDDFC9), RAPIDJSON_UINT64_C2(0x5F5EE3DD, 0x40F3F740),
+        RAPIDJSON_UINT64_C2(0x50DD0DD3, 0xCF0B196E), RAPIDJSON_UINT64_C2(0x1918B64A, 0x9A5CC5CD),
+        RAPIDJSON_UINT64_C2(0x40B0D7DC, 0xA5A27ABE), RAPIDJSON_UINT64_C2(0x4746F83B, 0xAEB09E3E),
+        RAPIDJSON_UINT64_C2(0x67815961, 0x0903F797), RAPIDJSON_UINT64_C2(0x253E59F9, 0x1780FD2F),
+        RAPIDJSON_UINT64_C2(0x52CDE11A, 0x6D9CC612), RAPIDJSON_UINT64_C2(0x50FEAE60, 0xDF9A6426),
+        RAPIDJSON_UINT64_C2(0x423E4DAE, 0xBE1704DB), RAPIDJSON_UINT64_C2(0x5A65584D, 0x7FAEB685),
+        RAPIDJSON_UINT64_C2(0x69FD4917, 0x968B3AF9), RAPIDJSON_UINT64_C2(0x10A226E2, 0x65E4573B),
+        RAPIDJSON_UINT64_C2(0x54CAA0DF, 0xABA29594), RAPIDJSON_UINT64_C2(0x0D4E8581, 0xEB1D1295),
+        RAPIDJSON_UINT64_C2(0x43D54D7F, 0xBC821143), RAPIDJSON_UINT64_C2(0x243ED134, 0xBC174211),
+        RAPIDJSON_UINT64_C2(0x6C887BFF, 0x94034ED2), RAPIDJSON_UINT64_C2(0x06CAE854, 0x60253682),
+        RAPIDJSON_UINT64_C2(0x56D39666, 0x1002A574), RAPIDJSON_UINT64_C2(0x6BD586A9, 0xE6842B9B),
+        RAPIDJSON_UINT64_C2(0x457611EB, 0x40021DF7), RAPIDJSON_UINT64_C2(0x09779EEE, 0x52035616),
+        RAPIDJSON_UINT64_C2(0x6F234FDE, 0xCCD02FF1), RAPIDJSON_UINT64_C2(0x5BF297E3, 0xB66BBCEF),
+        RAPIDJSON_UINT64_C2(0x58E90CB2, 0x3D73598E), RAPIDJSON_UINT64_C2(0x165BACB6, 0x2B8963F3),
+        RAPIDJSON_UINT64_C2(0x4720D6F4, 0xFDF5E13E), RAPIDJSON_UINT64_C2(0x451623C4, 0xEFA11CC2),
+        RAPIDJSON_UINT64_C2(0x71CE24BB, 0x2FEFCECA), RAPIDJSON_UINT64_C2(0x3B569FA1, 0x7F682E03),
+        RAPIDJSON_UINT64_C2(0x5B0B5095, 0xBFF30BD5), RAPIDJSON_UINT64_C2(0x15DEE61A, 0xCC535803),
+        RAPIDJSON_UINT64_C2(0x48D5DA11, 0x665C0977), RAPIDJSON_UINT64_C2(0x2B18B815, 0x7042ACCF),
+        RAPIDJSON_UINT64_C2(0x74895CE8, 0xA3C6758B), RAPIDJSON_UINT64_C2(0x5E8DF355, 0x806AAE18),
+        RAPIDJSON_UINT64_C2(0x5D3AB0BA, 0x1C9EC46F), RAPIDJSON_UINT64_C2(0x653E5C44, 0x66BBBE7A),
+        RAPIDJSON_UINT64_C2(0x4A955A2E, 0x7D4BD059), RAPIDJSON_UINT64_C2(0x3765169D, 0x1EFC9861),
+        RAPIDJSON_UINT64_C2(0x77555D17, 0x2EDFB3C2), RAPIDJSON_UINT64_C2(0x256E8A94, 0xFE60F3CF),
+        RAPIDJSON_UINT64_C2(0x5F777DAC, 0x257FC301), RAPIDJSON_UINT64_C2(0x6ABED543, 0xFEB3F63F),
+        RAPIDJSON_UINT64_C2(0x4C5F97BC, 0xEACC9C01), RAPIDJSON_UINT64_C2(0x3BCBDDCF, 0xFEF65E99),
+        RAPIDJSON_UINT64_C2(0x7A328C61, 0x77ADC668), RAPIDJSON_UINT64_C2(0x5FAC9619, 0x97F0975B),
+        RAPIDJSON_UINT64_C2(0x61C209E7, 0x92F16B86), RAPIDJSON_UINT64_C2(0x7FBD44E1, 0x465A12AF),
+        RAPIDJSON_UINT64_C2(0x4E34D4B9, 0x425ABC6B), RAPIDJSON_UINT64_C2(0x7FCA9D81, 0x0514DBBF),
+        RAPIDJSON_UINT64_C2(0x7D21545B, 0x9D5DFA46), RAPIDJSON_UINT64_C2(0x32DDC8CE, 0x6E87C5FF),
+        RAPIDJSON_UINT64_C2(0x641AA9E2, 0xE44B2E9E), RAPIDJSON_UINT64_C2(0x5BE4A0A5, 0x25396B32),
+        RAPIDJSON_UINT64_C2(0x501554B5, 0x836F587E), RAPIDJSON_UINT64_C2(0x7CB6E6EA, 0x842DEF5C),
+        RAPIDJSON_UINT64_C2(0x40111091, 0x35F2AD32), RAPIDJSON_UINT64_C2(0x30925255, 0x368B25E3),
+        RAPIDJSON_UINT64_C2(0x6681B41B, 0x89844850), RAPIDJSON_UINT64_C2(0x4DB6EA21, 0xF0DEA304),
+        RAPIDJSON_UINT64_C2(0x52015CE2, 0xD469D373), RAPIDJSON_UINT64_C2(0x57C5881B, 0x2718826A),
+        RAPIDJSON_UINT64_C2(0x419AB0B5, 0x76BB0F8F), RAPIDJSON_UINT64_C2(0x5FD139AF, 0x527A01EF),
+        RAPIDJSON_UINT64_C2(0x68F78122, 0x5791B27F), RAPIDJSON_UINT64_C2(0x4C81F5E5, 0x50C3364A),
+        RAPIDJSON_UINT64_C2(0x53F9341B, 0x79415B99), RAPIDJSON_UINT64_C2(0x239B2B1D, 0xDA35C508),
+        RAPIDJSON_UINT64_C2(0x432DC349, 0x2DCDE2E1), RAPIDJSON_UINT64_C2(0x02E288E4, 0xAE916A6D),
+        RAPIDJSON_UINT64_C2(0x6B7C6BA8, 0x49496B01), RAPIDJSON_UINT64_C2(0x516A74A1, 0x174F10AE),
+        RAPIDJSON_UINT64_C2(0x55FD22ED, 0x076DEF34), RAPIDJSON_UINT64_C2(0x4121F6E7, 0x45D8DA25),
+        RAPIDJSON_UINT64_C2(0x44CA8257, 0x3924BF5D), RAPIDJSON_UINT64_C2(0x1A819252, 0x9E4714EB),
+        RAPIDJSON_UINT64_C2(0x6E10D08B, 0x8EA1322E), RAPIDJSON_UINT64_C2(0x5D9C1D50, 0xFD3E87DD),
+        RAPIDJSON_UINT64_C2(0x580D73A2, 0xD880F4F2), RAPIDJSON_UINT64_C2(0x17B01773, 0xFDCB9FE4),
+        RAPIDJSON_UINT64_C2(0x4671294F, 0x139A5D8E), RAPIDJSON_UINT64_C2(0x46267929, 0x97D61984),
+        RAPIDJSON_UINT64_C2(0x70B50EE4, 0xEC2A2F4A), RAPIDJSON_UINT64_C2(0x3D0A5B75, 0xBFBCF59F),
+        RAPIDJSON_UINT64_C2(0x5A2A7250, 0xBCEE8C3B), RAPIDJSON_UINT64_C2(0x4A6EAF91, 0x6630C47F),
+        RAPIDJSON_UINT64_C2(0x4821F50D, 0x63F209C9), RAPIDJSON_UINT64_C2(0x21F2260D, 0xEB5A36CC),
+        RAPIDJSON_UINT64_C2(0x73698815, 0x6CB6760E), RAPIDJSON_UINT64_C2(0x69837016, 0x455D247A),
+        RAPIDJSON_UINT64_C2(0x5C546CDD, 0xF091F80B), RAPIDJSON_UINT64_C2(0x6E02C011, 0xD1175062),
+        RAPIDJSON_UINT64_C2(0x49DD23E4, 0xC074C66F), RAPIDJSON_UINT64_C2(0x719BCCDB, 0x0DAC404E),
+        RAPIDJSON_UINT64_C2(0x762E9FD4, 0x67213D7F), RAPIDJSON_UINT64_C2(0x68F947C4, 0xE2AD33B0),
+        RAPIDJSON_UINT64_C2(0x5E8BB310, 0x5280FDFF), RAPIDJSON_UINT64_C2(0x6D94396A, 0x4EF0F627),
+        RAPIDJSON_UINT64_C2(0x4BA2F5A6, 0xA8673199), RAPIDJSON_UINT64_C2(0x3E102DEE, 0xA58D91B9),
+        RAPIDJSON_UINT64_C2(0x7904BC3D, 0xDA3EB5C2), RAPIDJSON_UINT64_C2(0x3019E317, 0x6F48E927),
+        RAPIDJSON_UINT64_C2(0x60D09697, 0xE1CBC49B), RAPIDJSON_UINT64_C2(0x4014B5AC, 0x590720EC),
+        RAPIDJSON_UINT64_C2(0x4D73ABAC, 0xB4A303AF), RAPIDJSON_UINT64_C2(0x4CDD5E23, 0x7A6C1A57),
+        RAPIDJSON_UINT64_C2(0x7BEC45E1, 0x2104D2B2), RAPIDJSON_UINT64_C2(0x47C8969F, 0x2A46908A),
+        RAPIDJSON_UINT64_C2(0x63236B1A, 0x80D0A88E), RAPIDJSON_UINT64_C2(0x6CA0787F, 0x5505406F),
+        RAPIDJSON_UINT64_C2(0x4F4F88E2, 0x00A6ED3F), RAPIDJSON_UINT64_C2(0x0A19F9FF, 0x773766BF),
+        RAPIDJSON_UINT64_C2(0x7EE5A7D0, 0x010B1531), RAPIDJSON_UINT64_C2(0x5CF65CCB, 0xF1F23DFE),
+        RAPIDJSON_UINT64_C2(0x65848640, 0x00D5AA8E), RAPIDJSON_UINT64_C2(0x172B7D6F, 0xF4C1CB32),
+        RAPIDJSON_UINT64_C2(0x5136D1CC, 0xCD77BBA4), RAPIDJSON_UINT64_C2(0x78EF978C, 0xC3CE3C28),
+        RAPIDJSON_UINT64_C2(0x40F8A7D7, 0x0AC62FB7), RAPIDJSON_UINT64_C2(0x13F2DFA3, 0xCFD83020),
+        RAPIDJSON_UINT64_C2(0x67F43FBE, 0x77A37F8B), RAPIDJSON_UINT64_C2(0x39849906, 0x1959E699),
+        RAPIDJSON_UINT64_C2(0x5329CC98, 0x5FB5FFA2), RAPIDJSON_UINT64_C2(0x6136E0D1, 0xADE18548),
+        RAPIDJSON_UINT64_C2(0x4287D6E0, 0x4C91994F), RAPIDJSON_UINT64_C2(0x00F8B3DA, 0xF181376D),
+        RAPIDJSON_UINT64_C2(0x6A72F166, 0xE0E8F54B), RAPIDJSON_UINT64_C2(0x1B27862B, 0x1C01F247),
+        RAPIDJSON_UINT64_C2(0x5528C11F, 0x1A53F76F), RAPIDJSON_UINT64_C2(0x2F52D1BC, 0x1667F506),
+        RAPIDJSON_UINT64_C2(0x44209A7F, 0x48432C59), RAPIDJSON_UINT64_C2(0x0C424163, 0x451FF738),
+        RAPIDJSON_UINT64_C2(0x6D00F732, 0x0D3846F4), RAPIDJSON_UINT64_C2(0x7A039BD2, 0x08332526),
+        RAPIDJSON_UINT64_C2(0x5733F8F4, 0xD76038C3), RAPIDJSON_UINT64_C2(0x7B361641, 0xA028EA85),
+        RAPIDJSON_UINT64_C2(0x45C32D90, 0xAC4CFA36), RAPIDJSON_UINT64_C2(0x2F5E7834, 0x8020BB9E),
+        RAPIDJSON_UINT64_C2(0x6F9EAF4D, 0xE07B29F0), RAPIDJSON_UINT64_C2(0x4BCA59ED, 0x99CDF8FC),
+        RAPIDJSON_UINT64_C2(0x594BBF71, 0x806287F3), RAPIDJSON_UINT64_C2(0x563B7B24, 0x7B0B2D96),
+        RAPIDJSON_UINT64_C2(0x476FCC5A, 0xCD1B9FF6), RAPIDJSON_UINT64_C2(0x11C92F50, 0x626F57AC),
+        RAPIDJSON_UINT64_C2(0x724C7A2A, 0xE1C5CCBD), RAPIDJSON_UINT64_C2(0x02DB7EE7, 0x03E55912),
+        RAPIDJSON_UINT64_C2(0x5B7061BB, 0xE7D17097), RAPIDJSON_UINT64_C2(0x1BE2CBEC, 0x031DE0DC),
+        RAPIDJSON_UINT64_C2(0x4926B496, 0x530DF3AC), RAPIDJSON_UINT64_C2(0x164F0989, 0x9C17E716),
+        RAPIDJSON_UINT64_C2(0x750ABA8A, 0x1E7CB913), RAPIDJSON_UINT64_C2(0x3D4B4275, 0xC68CA4F0),
+        RAPIDJSON_UINT64_C2(0x5DA22ED4, 0xE530940F), RAPIDJSON_UINT64_C2(0x4AA29B91, 0x6BA3B726),
+        RAPIDJSON_UINT64_C2(0x4AE82577, 0x1DC07672), RAPIDJSON_UINT64_C2(0x6EE87C74, 0x561C9285),
+        RAPIDJSON_UINT64_C2(0x77D9D58B, 0x62CD8A51), RAPIDJSON_UINT64_C2(0x3173FA53, 0xBCFA8408),
+        RAPIDJSON_UINT64_C2(0x5FE177A2, 0xB5713B74), RAPIDJSON_UINT64_C2(0x278FFB76, 0x30C869A0),
+        RAPIDJSON_UINT64_C2(0x4CB45FB5, 0x5DF42F90), RAPIDJSON_UINT64_C2(0x1FA662C4, 0xF3D387B3),
+        RAPIDJSON_UINT64_C2(0x7ABA32BB, 0xC986B280), RAPIDJSON_UINT64_C2(0x32A3D13B, 0x1FB8D91F),
+        RAPIDJSON_UINT64_C2(0x622E8EFC, 0xA1388ECD), RAPIDJSON_UINT64_C2(0x0EE9742F, 0x4C93E0E6),
+        RAPIDJSON_UINT64_C2(0x4E8BA596, 0xE760723D), RAPIDJSON_UINT64_C2(0x58BAC359, 0x0A0FE71E),
+        RAPIDJSON_UINT64_C2(0x7DAC3C24, 0xA5671D2F), RAPIDJSON_UINT64_C2(0x412AD228, 0x101971C9),
+        RAPIDJSON_UINT64_C2(0x6489C9B6, 0xEAB8E426), RAPIDJSON_UINT64_C2(0x00EF0E86, 0x73478E3B),
+        RAPIDJSON_UINT64_C2(0x506E3AF8, 0xBBC71CEB), RAPIDJSON_UINT64_C2(0x1A58D86B, 0x8F6C71C9),
+        RAPIDJSON_UINT64_C2(0x40582F2D, 0x6305B0BC), RAPIDJSON_UINT64_C2(0x1513E056, 0x0C56C16E),
+        RAPIDJSON_UINT64_C2(0x66F37EAF, 0x04D5E793), RAPIDJSON_UINT64_C2(0x3B530089, 0xAD579BE2),
+        RAPIDJSON_UINT64_C2(0x525C6558, 0xD0AB1FA9), RAPIDJSON_UINT64_C2(0x15DC006E, 0x2446164F),
+        RAPIDJSON_UINT64_C2(0x41E38447, 0x0D55B2ED), RAPIDJSON_UINT64_C2(0x5E4999F1, 0xB69E783F),
+        RAPIDJSON_UINT64_C2(0x696C06D8, 0x1555EB15), RAPIDJSON_UINT64_C2(0x7D428FE9, 0x2430C065),
+        RAPIDJSON_UINT64_C2(0x54566BE0, 0x111188DE), RAPIDJSON_UINT64_C2(0x31020CBA, 0x835A3384),
+        RAPIDJSON_UINT64_C2(0x4378564C, 0xDA746D7E), RAPIDJSON_UINT64_C2(0x5A680A2E, 0xCF7B5C69),
+        RAPIDJSON_UINT64_C2(0x6BF3BD47, 0xC3ED7BFD), RAPIDJSON_UINT64_C2(0x770CDD17, 0xB25EFA42),
+        RAPIDJSON_UINT64_C2(0x565C976C, 0x9CBDFCCB), RAPIDJSON_UINT64_C2(0x1270B0DF, 0xC1E59502),
+        RAPIDJSON_UINT64_C2(0x4516DF8A, 0x16FE63D5), RAPIDJSON_UINT64_C2(0x5B8D5A4C, 0x9B1E10CE),
+        RAPIDJSON_UINT64_C2(0x6E8AFF43, 0x57FD6C89), RAPIDJSON_UINT64_C2(0x127BC3AD, 0xC4FCE7B0),
+        RAPIDJSON_UINT64_C2(0x586F329C, 0x466456D4), RAPIDJSON_UINT64_C2(0x0EC96957, 0xD0CA52F3),
+        RAPIDJSON_UINT64_C2(0x46BF5BB0, 0x38504576), RAPIDJSON_UINT64_C2(0x3F078779, 0x73D50F29),
+        RAPIDJSON_UINT64_C2(0x71322C4D, 0x26E6D58A), RAPIDJSON_UINT64_C2(0x31A5A58F, 0x1FBB4B75),
+        RAPIDJSON_UINT64_C2(0x5A8E89D7, 0x5252446E), RAPIDJSON_UINT64_C2(0x5AEAEAD8, 0xE62F6F91),
+        RAPIDJSON_UINT64_C2(0x487207DF, 0x750E9D25), RAPIDJSON_UINT64_C2(0x2F22557A, 0x51BF8C74),
+        RAPIDJSON_UINT64_C2(0x73E9A632, 0x54E42EA2), RAPIDJSON_UINT64_C2(0x1836EF2A, 0x1C65AD86),
+        RAPIDJSON_UINT64_C2(0x5CBAEB5B, 0x771CF21B), RAPIDJSON_UINT64_C2(0x2CF8BF54, 0xE3848AD2),
+        RAPIDJSON_UINT64_C2(0x4A2F22AF, 0x927D8E7C), RAPIDJSON_UINT64_C2(0x23FA32AA, 0x4F9D3BDB),
+        RAPIDJSON_UINT64_C2(0x76B1D118, 0xEA627D93), RAPIDJSON_UINT64_C2(0x5329EAAA, 0x18FB92F8),
+        RAPIDJSON_UINT64_C2(0x5EF4A747, 0x21E86476), RAPIDJSON_UINT64_C2(0x0F54BBBB, 0x472FA8C6),
+        RAPIDJSON_UINT64_C2(0x4BF6EC38, 0xE7ED1D2B), RAPIDJSON_UINT64_C2(0x25DD62FC, 0x38F2ED6C),
+        RAPIDJSON_UINT64_C2(0x798B138E, 0x3FE1C845), RAPIDJSON_UINT64_C2(0x22FBD193, 0x8E517BDF),
+        RAPIDJSON_UINT64_C2(0x613C0FA4, 0xFFE7D36A), RAPIDJSON_UINT64_C2(0x4F2FDADC, 0x71DAC97F),
+        RAPIDJSON_UINT64_C2(0x4DC9A61D, 0x998642BB), RAPIDJSON_UINT64_C2(0x58F3157D, 0x27E23ACC),
+        RAPIDJSON_UINT64_C2(0x7C75D695, 0xC2706AC5), RAPIDJSON_UINT64_C2(0x74B82261, 0xD969F7AD),
+        RAPIDJSON_UINT64_C2(0x63917877, 0xCEC0556B), RAPIDJSON_UINT64_C2(0x10934EB4, 0xADEE5FBE),
+        RAPIDJSON_UINT64_C2(0x4FA79393, 0x0BCD1122), RAPIDJSON_UINT64_C2(0x4075D890, 0x8B251965),
+        RAPIDJSON_UINT64_C2(0x7F7285B8, 0x12E1B504), RAPIDJSON_UINT64_C2(0x00BC8DB4, 0x11D4F56E),
+        RAPIDJSON_UINT64_C2(0x65F537C6, 0x75815D9C), RAPIDJSON_UINT64_C2(0x66FD3E29, 0xA7DD9125),
+        RAPIDJSON_UINT64_C2(0x5190F96B, 0x91344AE3), RAPIDJSON_UINT64_C2(0x6BFDCB54, 0x864ADA84),
+        RAPIDJSON_UINT64_C2(0x4140C789, 0x40F6A24F), RAPIDJSON_UINT64_C2(0x6FFE3C43, 0x9EA2486A),
+        RAPIDJSON_UINT64_C2(0x6867A5A8, 0x67F103B2), RAPIDJSON_UINT64_C2(0x7FFD2D38, 0xFDD073DC),
+        RAPIDJSON_UINT64_C2(0x53861E20, 0x53273628), RAPIDJSON_UINT64_C2(0x6664242D, 0x97D9F64A),
+        RAPIDJSON_UINT64_C2(0x42D1B1B3, 0x75B8F820), RAPIDJSON_UINT64_C2(0x51E9B68A, 0xDFE191D5),
+        RAPIDJSON_UINT64_C2(0x6AE91C52, 0x55F4C034), RAPIDJSON_UINT64_C2(0x1CA92411, 0x6635B621),
+        RAPIDJSON_UINT64_C2(0x558749DB, 0x77F70029), RAPIDJSON_UINT64_C2(0x63BA8341, 0x1E915E81),
+        RAPIDJSON_UINT64_C2(0x446C3B15, 0xF9926687), RAPIDJSON_UINT64_C2(0x6962029A, 0x7EDAB201),
+        RAPIDJSON_UINT64_C2(0x6D79F823, 0x28EA3DA6), RAPIDJSON_UINT64_C2(0x0F03375D, 0x97C45001),
+        RAPIDJSON_UINT64_C2(0x5794C682, 0x8721CAEB), RAPIDJSON_UINT64_C2(0x259C2C4A, 0xDFD04001),
+        RAPIDJSON_UINT64_C2(0x46109ECE, 0xD2816F22), RAPIDJSON_UINT64_C2(0x5149BD08, 0xB30D0001),
+        RAPIDJSON_UINT64_C2(0x701A97B1, 0x50CF1837), RAPIDJSON_UINT64_C2(0x3542C80D, 0xEB480001),
+        RAPIDJSON_UINT64_C2(0x59AEDFC1, 0x0D7279C5), RAPIDJSON_UINT64_C2(0x7768A00B, 0x22A00001),
+        RAPIDJSON_UINT64_C2(0x47BF1967, 0x3DF52E37), RAPIDJSON_UINT64_C2(0x79208008, 0xE8800001),
+        RAPIDJSON_UINT64_C2(0x72CB5BD8, 0x6321E38C), RAPIDJSON_UINT64_C2(0x5B673341, 0x74000001),
+        RAPIDJSON_UINT64_C2(0x5BD5E313, 0x828182D6), RAPIDJSON_UINT64_C2(0x7C528F67, 0x90000001),
+        RAPIDJSON_UINT64_C2(0x4977E8DC, 0x68679BDF), RAPIDJSON_UINT64_C2(0x16A872B9, 0x40000001),
+        RAPIDJSON_UINT64_C2(0x758CA7C7, 0x0D7292FE), RAPIDJSON_UINT64_C2(0x5773EAC2, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x5E0A1FD2, 0x71287598), RAPIDJSON_UINT64_C2(0x45F65568, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4B3B4CA8, 0x5A86C47A), RAPIDJSON_UINT64_C2(0x04C51120, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x785EE10D, 0x5DA46D90), RAPIDJSON_UINT64_C2(0x07A1B500, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x604BE73D, 0xE4838AD9), RAPIDJSON_UINT64_C2(0x52E7C400, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4D0985CB, 0x1D3608AE), RAPIDJSON_UINT64_C2(0x0F1FD000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x7B426FAB, 0x61F00DE3), RAPIDJSON_UINT64_C2(0x31CC8000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x629B8C89, 0x1B267182), RAPIDJSON_UINT64_C2(0x5B0A0000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4EE2D6D4, 0x15B85ACE), RAPIDJSON_UINT64_C2(0x7C080000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x7E37BE20, 0x22C0914B), RAPIDJSON_UINT64_C2(0x13400000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x64F964E6, 0x8233A76F), RAPIDJSON_UINT64_C2(0x29000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x50C783EB, 0x9B5C85F2), RAPIDJSON_UINT64_C2(0x54000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x409F9CBC, 0x7C4A04C2), RAPIDJSON_UINT64_C2(0x10000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x6765C793, 0xFA10079D), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x52B7D2DC, 0xC80CD2E4), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x422CA8B0, 0xA00A4250), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x69E10DE7, 0x6676D080), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x54B40B1F, 0x852BDA00), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x43C33C19, 0x37564800), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x6C6B935B, 0x8BBD4000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x56BC75E2, 0xD6310000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x45639182, 0x44F40000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x6F05B59D, 0x3B200000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x58D15E17, 0x62800000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x470DE4DF, 0x82000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x71AFD498, 0xD0000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x5AF3107A, 0x40000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x48C27395, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x746A5288, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x5D21DBA0, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4A817C80, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x77359400, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x5F5E1000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4C4B4000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x7A120000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x61A80000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x4E200000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x7D000000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x64000000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x50000000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x40000000, 0x00000000), RAPIDJSON_UINT64_C2(0x00000000, 0x00000001),
+        RAPIDJSON_UINT64_C2(0x66666666, 0x66666666), RAPIDJSON_UINT64_C2(0x33333333, 0x33333334),
+        RAPIDJSON_UINT64_C2(0x51EB851E, 0xB851EB85), RAPIDJSON_UINT64_C2(0x0F5C28F5, 0xC28F5C29),
+        RAPIDJSON_UINT64_C2(0x4189374B, 0xC6A7EF9D), RAPIDJSON_UINT64_C2(0x5916872B, 0x020C49BB),
+        RAPIDJSON_UINT64_C2(0x68DB8BAC, 0x710CB295), RAPIDJSON_UINT64_C2(0x74F0D844, 0xD013A92B),
+        RAPIDJSON_UINT64_C2(0x53E2D623, 0x8DA3C211), RAPIDJSON_UINT64_C2(0x43F3E037, 0x0CDC8755),
+        RAPIDJSON_UINT64_C2(0x431BDE82, 0xD7B634DA), RAPIDJSON_UINT64_C2(0x698FE692, 0x70B06C44),
+        RAPIDJSON_UINT64_C2(0x6B5FCA6A, 0xF2BD215E), RAPIDJSON_UINT64_C2(0x0F4CA41D, 0x811A46D4),
+        RAPIDJSON_UINT64_C2(0x55E63B88, 0xC230E77E), RAPIDJSON_UINT64_C2(0x3F70834A, 0xCDAE9F10),
+        RAPIDJSON_UINT64_C2(0x44B82FA0, 0x9B5A52CB), RAPIDJSON_UINT64_C2(0x4C5A02A2, 0x3E254C0D),
+        RAPIDJSON_UINT64_C2(0x6DF37F67, 0x5EF6EADF), RAPIDJSON_UINT64_C2(0x2D5CD103, 0x96A21347),
+        RAPIDJSON_UINT64_C2(0x57F5FF85, 0xE592557F), RAPIDJSON_UINT64_C2(0x3DE3DA69, 0x454E75D3),
+        RAPIDJSON_UINT64_C2(0x465E6604, 0xB7A84465), RAPIDJSON_UINT64_C2(0x7E4FE1ED, 0xD10B9175),
+        RAPIDJSON_UINT64_C2(0x709709A1, 0x25DA0709), RAPIDJSON_UINT64_C2(0x4A19697C, 0x81AC1BEF),
+        RAPIDJSON_UINT64_C2(0x5A126E1A, 0x84AE6C07), RAPIDJSON_UINT64_C2(0x54E12130, 0x67BCE326),
+        RAPIDJSON_UINT64_C2(0x480EBE7B, 0x9D58566C), RAPIDJSON_UINT64_C2(0x43E74DC0, 0x52FD8285),
+        RAPIDJSON_UINT64_C2(0x734ACA5F, 0x6226F0AD), RAPIDJSON_UINT64_C2(0x530BAF9A, 0x1E626A6D),
+        RAPIDJSON_UINT64_C2(0x5C3BD519, 0x1B525A24), RAPIDJSON_UINT64_C2(0x426FBFAE, 0x7EB521F1),
+        RAPIDJSON_UINT64_C2(0x49C97747, 0x490EAE83), RAPIDJSON_UINT64_C2(0x4EBFCC8B, 0x9890E7F4),
+        RAPIDJSON_UINT64_C2(0x760F253E, 0xDB4AB0D2), RAPIDJSON_UINT64_C2(0x4ACC7A78, 0xF41B0CBA),
+        RAPIDJSON_UINT64_C2(0x5E728432, 0x49088D75), RAPIDJSON_UINT64_C2(0x223D2EC7, 0x29AF3D62),
+        RAPIDJSON_UINT64_C2(0x4B8ED028, 0x3A6D3DF7), RAPIDJSON_UINT64_C2(0x34FDBF05, 0xBAF29781),
+        RAPIDJSON_UINT64_C2(0x78E48040, 0x5D7B9658), RAPIDJSON_UINT64_C2(0x54C931A2, 0xC4B758CF),
+        RAPIDJSON_UINT64_C2(0x60B6CD00, 0x4AC94513), RAPIDJSON_UINT64_C2(0x5D6DC14F, 0x03C5E0A5),
+        RAPIDJSON_UINT64_C2(0x4D5F0A66, 0xA23A9DA9), RAPIDJSON_UINT64_C2(0x31249AA5, 0x9C9E4D51),
+        RAPIDJSON_UINT64_C2(0x7BCB43D7, 0x69F762A8), RAPIDJSON_UINT64_C2(0x4EA0F76F, 0x60FD4882),
+        RAPIDJSON_UINT64_C2(0x63090312, 0xBB2C4EED), RAPIDJSON_UINT64_C2(0x254D92BF, 0x80CAA068),
+        RAPIDJSON_UINT64_C2(0x4F3A68DB, 0xC8F03F24), RAPIDJSON_UINT64_C2(0x1DD7A899, 0x33D54D20),
+        RAPIDJSON_UINT64_C2(0x7EC3DAF9, 0x41806506), RAPIDJSON_UINT64_C2(0x62F2A75B, 0x86221500),
+        RAPIDJSON_UINT64_C2(0x65697BFA, 0x9ACD1D9F), RAPIDJSON_UINT64_C2(0x025BB916, 0x04E810CD),
+        RAPIDJSON_UINT64_C2(0x51212FFB, 0xAF0A7E18), RAPIDJSON_UINT64_C2(0x684960DE, 0x6A5340A4),
+        RAPIDJSON_UINT64_C2(0x40E75996, 0x25A1FE7A), RAPIDJSON_UINT64_C2(0x203AB3E5, 0x21DC33B6),
+        RAPIDJSON_UINT64_C2(0x67D88F56, 0xA29CCA5D), RAPIDJSON_UINT64_C2(0x19F7863B, 0x696052BD),
+        RAPIDJSON_UINT64_C2(0x5313A5DE, 0xE87D6EB0), RAPIDJSON_UINT64_C2(0x7B2C6B62, 0xBAB37564),
+        RAPIDJSON_UINT64_C2(0x42761E4B, 0xED31255A), RAPIDJSON_UINT64_C2(0x2F56BC4E, 0xFBC2C450),
+        RAPIDJSON_UINT64_C2(0x6A5696DF, 0xE1E83BC3), RAPIDJSON_UINT64_C2(0x655793B1, 0x92D13A1A),
+        RAPIDJSON_UINT64_C2(0x5512124C, 0xB4B9C969), RAPIDJSON_UINT64_C2(0x377942F4, 0x75742E7B),
+        RAPIDJSON_UINT64_C2(0x440E750A, 0x2A2E3ABA), RAPIDJSON_UINT64_C2(0x5F943590, 0x5DF68B96),
+        RAPIDJSON_UINT64_C2(0x6CE3EE76, 0xA9E3912A), RAPIDJSON_UINT64_C2(0x65B9EF4D, 0x63241289),
+        RAPIDJSON_UINT64_C2(0x571CBEC5, 0x54B60DBB), RAPIDJSON_UINT64_C2(0x6AFB25D7, 0x82834207),
+        RAPIDJSON_UINT64_C2(0x45B0989D, 0xDD5E7163), RAPIDJSON_UINT64_C2(0x08C8EB12, 0xCECF6806),
+        RAPIDJSON_UINT64_C2(0x6F80F42F, 0xC8971BD1), RAPIDJSON_UINT64_C2(0x5ADB11B7, 0xB14BD9A3),
+        RAPIDJSON_UINT64_C2(0x5933F68C, 0xA078E30E), RAPIDJSON_UINT64_C2(0x157C0E2C, 0x8DD647B5),
+        RAPIDJSON_UINT64_C2(0x475CC53D, 0x4D2D8271), RAPIDJSON_UINT64_C2(0x5DFCD823, 0xA4AB6C91),
+        RAPIDJSON_UINT64_C2(0x722E0862, 0x15159D82), RAPIDJSON_UINT64_C2(0x632E269F, 0x6DDF141B),
+        RAPIDJSON_UINT64_C2(0x5B5806B4, 0xDDAAE468), RAPIDJSON_UINT64_C2(0x4F581EE5, 0xF17F4349),
+        RAPIDJSON_UINT64_C2(0x49133890, 0xB1558386), RAPIDJSON_UINT64_C2(0x72ACE584, 0xC1329C3B),
+        RAPIDJSON_UINT64_C2(0x74EB8DB4, 0x4EEF38D7), RAPIDJSON_UINT64_C2(0x6AAE3C07, 0x9B842D2A),
+        RAPIDJSON_UINT64_C2(0x5D893E29, 0xD8BF60AC), RAPIDJSON_UINT64_C2(0x55583006, 0x16035755),
+        RAPIDJSON_UINT64_C2(0x4AD431BB, 0x13CC4D56), RAPIDJSON_UINT64_C2(0x7779C004, 0xDE6912AB),
+        RAPIDJSON_UINT64_C2(0x77B9E92B, 0x52E07BBE), RAPIDJSON_UINT64_C2(0x258F99A1, 0x63DB5111),
+        RAPIDJSON_UINT64_C2(0x5FC7EDBC, 0x424D2FCB), RAPIDJSON_UINT64_C2(0x37A61481, 0x1CAF740D),
+        RAPIDJSON_UINT64_C2(0x4C9FF163, 0x683DBFD5), RAPIDJSON_UINT64_C2(0x7951AA00, 0xE3BF900B),
+        RAPIDJSON_UINT64_C2(0x7A998238, 0xA6C932EF), RAPIDJSON_UINT64_C2(0x754F7667, 0xD2CC19AB),
+        RAPIDJSON_UINT64_C2(0x6214682D, 0x523A8F26), RAPIDJSON_UINT64_C2(0x2AA5F853, 0x0F09AE22),
+        RAPIDJSON_UINT64_C2(0x4E76B9BD, 0xDB620C1E), RAPIDJSON_UINT64_C2(0x55519375, 0xA5A1581B),
+        RAPIDJSON_UINT64_C2(0x7D8AC2C9, 0x5F034697), RAPIDJSON_UINT64_C2(0x3BB5B8BC, 0x3C3559C5),
+        RAPIDJSON_UINT64_C2(0x646F023A, 0xB2690545), RAPIDJSON_UINT64_C2(0x7C916096, 0x9691149E),
+        RAPIDJSON_UINT64_C2(0x5058CE95, 0x5B87376B), RAPIDJSON_UINT64_C2(0x16DAB3AB, 0xABA743B2),
+        RAPIDJSON_UINT64_C2(0x40470BAA, 0xAF9F5F88), RAPIDJSON_UINT64_C2(0x78AEF622, 0xEFB902F5),
+        RAPIDJSON_UINT64_C2(0x66D812AA, 0xB29898DB), RAPIDJSON_UINT64_C2(0x0DE4BD04, 0xB2C19E54),
+        RAPIDJSON_UINT64_C2(0x52467555, 0x5BAD4715), RAPIDJSON_UINT64_C2(0x57EA30D0, 0x8F014B76),
+        RAPIDJSON_UINT64_C2(0x41D1F777, 0x7C8A9F44), RAPIDJSON_UINT64_C2(0x4654F3DA, 0x0C01092C),
+        RAPIDJSON_UINT64_C2(0x694FF258, 0xC7443207), RAPIDJSON_UINT64_C2(0x23BB1FC3, 0x46680EAC),
+        RAPIDJSON_UINT64_C2(0x543FF513, 0xD29CF4D2), RAPIDJSON_UINT64_C2(0x4FC8E635, 0xD1ECD88A),
+        RAPIDJSON_UINT64_C2(0x43665DA9, 0x754A5D75), RAPIDJSON_UINT64_C2(0x263A51C4, 0xA7F0AD3B),
+        RAPIDJSON_UINT64_C2(0x6BD6FC42, 0x5543C8BB), RAPIDJSON_UINT64_C2(0x56C3B607, 0x731AAEC4),
+        RAPIDJSON_UINT64_C2(0x5645969B, 0x77696D62), RAPIDJSON_UINT64_C2(0x789C919F, 0x8F488BD0),
+        RAPIDJSON_UINT64_C2(0x4504787C, 0x5F878AB5), RAPIDJSON_UINT64_C2(0x46E3A7B2, 0xD906D640),
+        RAPIDJSON_UINT64_C2(0x6E6D8D93, 0xCC0C1122), RAPIDJSON_UINT64_C2(0x3E390C51, 0x5B3E239A),
+        RAPIDJSON_UINT64_C2(0x5857A476, 0x3CD6741B), RAPIDJSON_UINT64_C2(0x4B60D6A7, 0x7C31B615),
+        RAPIDJSON_UINT64_C2(0x46AC8391, 0xCA4529AF), RAPIDJSON_UINT64_C2(0x55E7121F, 0x968E2B44),
+        RAPIDJSON_UINT64_C2(0x711405B6, 0x106EA919), RAPIDJSON_UINT64_C2(0x0971B698, 0xF0E3786D),
+        RAPIDJSON_UINT64_C2(0x5A766AF8, 0x0D255414), RAPIDJSON_UINT64_C2(0x078E2BAD, 0x8D82C6BD),
+        RAPIDJSON_UINT64_C2(0x485EBBF9, 0xA41DDCDC), RAPIDJSON_UINT64_C2(0x6C71BC8A, 0xD79BD231),
+        RAPIDJSON_UINT64_C2(0x73CAC65C, 0x39C96161), RAPIDJSON_UINT64_C2(0x2D82C744, 0x8C2C8382),
+        RAPIDJSON_UINT64_C2(0x5CA23849, 0xC7D44DE7), RAPIDJSON_UINT64_C2(0x3E023903, 0xA356CF9B),
+        RAPIDJSON_UINT64_C2(0x4A1B603B, 0x06437185), RAPIDJSON_UINT64_C2(0x7E682D9C, 0x82ABD949),
+        RAPIDJSON_UINT64_C2(0x76923391, 0xA39F1C09), RAPIDJSON_UINT64_C2(0x4A4048FA, 0x6AAC8EDB),
+        RAPIDJSON_UINT64_C2(0x5EDB5C74, 0x82E5B007), RAPIDJSON_UINT64_C2(0x55003A61, 0xEEF07249),
+        RAPIDJSON_UINT64_C2(0x4BE2B05D, 0x35848CD2), RAPIDJSON_UINT64_C2(0x773361E7, 0xF259F507),
+        RAPIDJSON_UINT64_C2(0x796AB3C8, 0x55A0E151), RAPIDJSON_UINT64_C2(0x3EB89CA6, 0x508FEE71),
+        RAPIDJSON_UINT64_C2(0x6122296D, 0x114D810D), RAPIDJSON_UINT64_C2(0x7EFA16EB, 0x73A6585B),
+        RAPIDJSON_UINT64_C2(0x4DB4EDF0, 0xDAA4673E), RAPIDJSON_UINT64_C2(0x3261ABEF, 0x8FB846AF),
+        RAPIDJSON_UINT64_C2(0x7C54AFE7, 0xC43A3ECA), RAPIDJSON_UINT64_C2(0x1D691318, 0xE5F3A44B),
+        RAPIDJSON_UINT64_C2(0x6376F31F, 0xD02E98A1), RAPIDJSON_UINT64_C2(0x64540F47, 0x1E5C836F),
+        RAPIDJSON_UINT64_C2(0x4F925C19, 0x73587A1B), RAPIDJSON_UINT64_C2(0x0376729F, 0x4B7D35F3),
+        RAPIDJSON_UINT64_C2(0x7F50935B, 0xEBC0C35E), RAPIDJSON_UINT64_C2(0x38BD8432, 0x1261EFEB),
+        RAPIDJSON_UINT64_C2(0x65DA0F7C, 0xBC9A35E5), RAPIDJSON_UINT64_C2(0x13CAD028, 0x0EB4BFEF),
+        RAPIDJSON_UINT64_C2(0x517B3F96, 0xFD482B1D), RAPIDJSON_UINT64_C2(0x5CA24020, 0x0BC3CCBF),
+        RAPIDJSON_UINT64_C2(0x412F6612, 0x6439BC17), RAPIDJSON_UINT64_C2(0x63B50019, 0xA3030A33),
+        RAPIDJSON_UINT64_C2(0x684BD683, 0xD38F9359), RAPIDJSON_UINT64_C2(0x1F880029, 0x04D1A9EA),
+        RAPIDJSON_UINT64_C2(0x536FDECF, 0xDC72DC47), RAPIDJSON_UINT64_C2(0x32D33354, 0x03DAEE55),
+        RAPIDJSON_UINT64_C2(0x42BFE573, 0x16C249D2), RAPIDJSON_UINT64_C2(0x5BDC2910, 0x03158B77),
+        RAPIDJSON_UINT64_C2(0x6ACCA251, 0xBE03A951), RAPIDJSON_UINT64_C2(0x12F9DB4C, 0xD1BC1258),
+        RAPIDJSON_UINT64_C2(0x557081DA, 0xFE695440), RAPIDJSON_UINT64_C2(0x7594AF70, 0xA7C9A847),
+        RAPIDJSON_UINT64_C2(0x445A017B, 0xFEBAA9CD), RAPIDJSON_UINT64_C2(0x4476F2C0, 0x863AED06),
+        RAPIDJSON_UINT64_C2(0x6D5CCF2C, 0xCAC442E2), RAPIDJSON_UINT64_C2(0x3A57EACD, 0xA3917B3C),
+        RAPIDJSON_UINT64_C2(0x577D728A, 0x3BD03581), RAPIDJSON_UINT64_C2(0x7B7988A4, 0x82DAC8FD),
+        RAPIDJSON_UINT64_C2(0x45FDF53B, 0x630CF79B), RAPIDJSON_UINT64_C2(0x15FAD3B6, 0xCF156D97),
+        RAPIDJSON_UINT64_C2(0x6FFCBB92, 0x3814BF5E), RAPIDJSON_UINT64_C2(0x565E1F8A, 0xE4EF15BE),
+        RAPIDJSON_UINT64_C2(0x5996FC74, 0xF9AA32B2), RAPIDJSON_UINT64_C2(0x11E4E608, 0xB725AAFF),
+        RAPIDJSON_UINT64_C2(0x47ABFD2A, 0x6154F55B), RAPIDJSON_UINT64_C2(0x27EA51A0, 0x928488CC),
+        RAPIDJSON_UINT64_C2(0x72ACC843, 0xCEEE555E), RAPIDJSON_UINT64_C2(0x7310829A, 0x84074146),
+        RAPIDJSON_UINT64_C2(0x5BBD6D03, 0x0BF1DDE5), RAPIDJSON_UINT64_C2(0x42739BAE, 0xD005CDD2),
+        RAPIDJSON_UINT64_C2(0x49645735, 0xA327E4B7), RAPIDJSON_UINT64_C2(0x4EC2E2F2, 0x4004A4A8),
+        RAPIDJSON_UINT64_C2(0x756D5855, 0xD1D96DF2), RAPIDJSON_UINT64_C2(0x4AD16B1D, 0x333AA10C),
+        RAPIDJSON_UINT64_C2(0x5DF11377, 0xDB1457F5), RAPIDJSON_UINT64_C2(0x2241227D, 0xC2954DA3),
+        RAPIDJSON_UINT64_C2(0x4B2742C6, 0x48DD132A), RAPIDJSON_UINT64_C2(0x4E9A81FE, 0x35443E1C),
+        RAPIDJSON_UINT64_C2(0x783ED13D, 0x4161B844), RAPIDJSON_UINT64_C2(0x175D9CC9, 0xEED39694),
+        RAPIDJSON_UINT64_C2(0x603240FD, 0xCDE7C69C), RAPIDJSON_UINT64_C2(0x7917B0A1, 0x8BDC7876),
+        RAPIDJSON_UINT64_C2(0x4CF500CB, 0x0B1FD217), RAPIDJSON_UINT64_C2(0x1412F3B4, 0x6FE39392),
+        RAPIDJSON_UINT64_C2(0x7B219ADE, 0x7832E9BE), RAPIDJSON_UINT64_C2(0x535185ED, 0x7FD285B6),
+        RAPIDJSON_UINT64_C2(0x628148B1, 0xF9C25498), RAPIDJSON_UINT64_C2(0x42A79E57, 0x997537C5),
+        RAPIDJSON_UINT64_C2(0x4ECDD3C1, 0x949B76E0), RAPIDJSON_UINT64_C2(0x3552E512, 0xE12A9304),
+        RAPIDJSON_UINT64_C2(0x7E161F9C, 0x20F8BE33), RAPIDJSON_UINT64_C2(0x6EEB081E, 0x3510EB39),
+        RAPIDJSON_UINT64_C2(0x64DE7FB0, 0x1A609829), RAPIDJSON_UINT64_C2(0x3F226CE4, 0xF740BC2E),
+        RAPIDJSON_UINT64_C2(0x50B1FFC0, 0x151A1354), RAPIDJSON_UINT64_C2(0x3281F0B7, 0x2C33C9BE),
+        RAPIDJSON_UINT64_C2(0x408E6633, 0x4414DC43), RAPIDJSON_UINT64_C2(0x42018D5F, 0x568FD498),
+        RAPIDJSON_UINT64_C2(0x674A3D1E, 0xD354939F), RAPIDJSON_UINT64_C2(0x1CCF4898, 0x8A7FBA8D),
+        RAPIDJSON_UINT64_C2(0x52A1CA7F, 0x0F76DC7F), RAPIDJSON_UINT64_C2(0x30A5D3AD, 0x3B99620B),
+        RAPIDJSON_UINT64_C2(0x421B0865, 0xA5F8B065), RAPIDJSON_UINT64_C2(0x73B7DC8A, 0x96144E6F),
+        RAPIDJSON_UINT64_C2(0x69C4DA3C, 0x3CC11A3C), RAPIDJSON_UINT64_C2(0x52BFC744, 0x2353B0B1),
+        RAPIDJSON_UINT64_C2(0x549D7B63, 0x63CDAE96), RAPIDJSON_UINT64_C2(0x75663903, 0x4F7626F4),
+        RAPIDJSON_UINT64_C2(0x43B12F82, 0xB63E2545), RAPIDJSON_UINT64_C2(0x4451C735, 0xD92B525D),
+        RAPIDJSON_UINT64_C2(0x6C4EB26A, 0xBD303BA2), RAPIDJSON_UINT64_C2(0x3A1C71EF, 0xC1DEEA2E),
+        RAPIDJSON_UINT64_C2(0x56A55B88, 0x9759C94E), RAPIDJSON_UINT64_C2(0x61B05B26, 0x34B254F2),
+        RAPIDJSON_UINT64_C2(0x45511606, 0xDF7B0772), RAPIDJSON_UINT64_C2(0x1AF37C1E, 0x908EAA5B),
+        RAPIDJSON_UINT64_C2(0x6EE8233E, 0x325E7250), RAPIDJSON_UINT64_C2(0x2B1F2CFD, 0xB41776F8),
+        RAPIDJSON_UINT64_C2(0x58B9B5CB, 0x5B7EC1D9), RAPIDJSON_UINT64_C2(0x6F4C23FE, 0x29AC5F2D),
+        RAPIDJSON_UINT64_C2(0x46FAF7D5, 0xE2CBCE47), RAPIDJSON_UINT64_C2(0x72A34FFE, 0x87BD18F1),
+        RAPIDJSON_UINT64_C2(0x71918C89, 0x6ADFB073), RAPIDJSON_UINT64_C2(0x04387FFD, 0xA5FB5B1B),
+        RAPIDJSON_UINT64_C2(0x5ADAD6D4, 0x557FC05C), RAPIDJSON_UINT64_C2(0x03606664, 0x84C915AF),
+        RAPIDJSON_UINT64_C2(0x48AF1243, 0x779966B0), RAPIDJSON_UINT64_C2(0x02B3851D, 0x3707448C),
+        RAPIDJSON_UINT64_C2(0x744B506B, 0xF28F0AB3), RAPIDJSON_UINT64_C2(0x1DEC082E, 0xBE720746),
+        RAPIDJSON_UINT64_C2(0x5D090D23, 0x28726EF5), RAPIDJSON_UINT64_C2(0x64BCD358, 0x985B3905),
+        RAPIDJSON_UINT64_C2(0x4A6DA41C, 0x205B8BF7), RAPIDJSON_UINT64_C2(0x6A30A913, 0xAD15C738),
+        RAPIDJSON_UINT64_C2(0x7715D360, 0x33C5ACBF), RAPIDJSON_UINT64_C2(0x5D1AA81F, 0x7B560B8C),
+        RAPIDJSON_UINT64_C2(0x5F44A919, 0xC3048A32), RAPIDJSON_UINT64_C2(0x7DAEECE5, 0xFC44D609),
+        RAPIDJSON_UINT64_C2(0x4C36EDAE, 0x359D3B5B), RAPIDJSON_UINT64_C2(0x7E258A51, 0x969D7808),
+        RAPIDJSON_UINT64_C2(0x79F17C49, 0xEF61F893), RAPIDJSON_UINT64_C2(0x16A276E8, 0xF0FBF33F),
+        RAPIDJSON_UINT64_C2(0x618DFD07, 0xF2B4C6DC), RAPIDJSON_UINT64_C2(0x121B9253, 0xF3FCC299),
+        RAPIDJSON_UINT64_C2(0x4E0B30D3, 0x28909F16), RAPIDJSON_UINT64_C2(0x41AFA843, 0x29970214),
+        RAPIDJSON_UINT64_C2(0x7CDEB485, 0x0DB431BD), RAPIDJSON_UINT64_C2(0x4F7F739E, 0xA8F19CED),
+        RAPIDJSON_UINT64_C2(0x63E55D37, 0x3E29C164), RAPIDJSON_UINT64_C2(0x3F99294B, 0xBA5AE3F1),
+        RAPIDJSON_UINT64_C2(0x4FEAB0F8, 0xFE87CDE9), RAPIDJSON_UINT64_C2(0x7FADBAA2, 0xFB7BE98D),
+        RAPIDJSON_UINT64_C2(0x7FDDE7F4, 0xCA72E30F), RAPIDJSON_UINT64_C2(0x7F7C5DD1, 0x925FDC15),
+        RAPIDJSON_UINT64_C2(0x664B1FF7, 0x085BE8D9), RAPIDJSON_UINT64_C2(0x4C637E41, 0x41E649AB),
+        RAPIDJSON_UINT64_C2(0x51D5B32C, 0x06AFED7A), RAPIDJSON_UINT64_C2(0x704F9834, 0x34B83AEF),
+        RAPIDJSON_UINT64_C2(0x4177C289, 0x9EF32462), RAPIDJSON_UINT64_C2(0x26A6135C, 0xF6F9C8BF),
+        RAPIDJSON_UINT64_C2(0x68BF9DA8, 0xFE51D3D0), RAPIDJSON_UINT64_C2(0x3DD68561, 0x8B294132),
+        RAPIDJSON_UINT64_C2(0x53CC7E20, 0xCB74A973), RAPIDJSON_UINT64_C2(0x4B12044E, 0x08EDCDC2),
+        RAPIDJSON_UINT64_C2(0x4309FE80, 0xA2C3BAC2), RAPIDJSON_UINT64_C2(0x6F419D0B, 0x3A57D7CE),
+        RAPIDJSON_UINT64_C2(0x6B4330CD, 0xD1392AD1), RAPIDJSON_UINT64_C2(0x320294DE, 0xC3BFBFB0),
+        RAPIDJSON_UINT64_C2(0x55CF5A3E, 0x40FA88A7), RAPIDJSON_UINT64_C2(0x419BAA4B, 0xCFCC995A),
+        RAPIDJSON_UINT64_C2(0x44A5E1CB, 0x672ED3B9), RAPIDJSON_UINT64_C2(0x1AE2EEA3, 0x0CA3ADE1),
+        RAPIDJSON_UINT64_C2(0x6DD63612, 0x3EB152C1), RAPIDJSON_UINT64_C2(0x77D17DD1, 0xADD2AFCF),
+        RAPIDJSON_UINT64_C2(0x57DE91A8, 0x32277567), RAPIDJSON_UINT64_C2(0x797464A7, 0xBE42263F),
+        RAPIDJSON_UINT64_C2(0x464BA7B9, 0xC1B92AB9), RAPIDJSON_UINT64_C2(0x47905086, 0x31CE84FF),
+        RAPIDJSON_UINT64_C2(0x70790C5C, 0x6928445C), RAPIDJSON_UINT64_C2(0x0C1A1A70, 0x4FB0D4CC),
+        RAPIDJSON_UINT64_C2(0x59FA7049, 0xEDB9D049), RAPIDJSON_UINT64_C2(0x567B4859, 0xD95A43D6),
+        RAPIDJSON_UINT64_C2(0x47FB8D07, 0xF161736E), RAPIDJSON_UINT64_C2(0x11FC39E1, 0x7AAE9CAB),
+        RAPIDJSON_UINT64_C2(0x732C14D9, 0x8235857D), RAPIDJSON_UINT64_C2(0x032D2968, 0xC44A9445),
+        RAPIDJSON_UINT64_C2(0x5C2343E1, 0x34F79DFD), RAPIDJSON_UINT64_C2(0x4F575453, 0xD03BA9D1),
+        RAPIDJSON_UINT64_C2(0x49B5CFE7, 0x5D92E4CA), RAPIDJSON_UINT64_C2(0x72AC4376, 0x402FBB0E),
+        RAPIDJSON_UINT64_C2(0x75EFB30B, 0xC8EB07AB), RAPIDJSON_UINT64_C2(0x0446D256, 0xCD192B49),
+        RAPIDJSON_UINT64_C2(0x5E595C09, 0x6D88D2EF), RAPIDJSON_UINT64_C2(0x1D057512, 0x3DADBC3A),
+        RAPIDJSON_UINT64_C2(0x4B7AB007, 0x8AD3DBF2), RAPIDJSON_UINT64_C2(0x4A6AC40E, 0x97BE302F),
+        RAPIDJSON_UINT64_C2(0x78C44CD8, 0xDE1FC650), RAPIDJSON_UINT64_C2(0x771139B0, 0xF2C9E6B1),
+        RAPIDJSON_UINT64_C2(0x609D0A47, 0x18196B73), RAPIDJSON_UINT64_C2(0x78DA948D, 0x8F07EBC1),
+        RAPIDJSON_UINT64_C2(0x4D4A6E9F, 0x467ABC5C), RAPIDJSON_UINT64_C2(0x60AEDD3E, 0x0C065634),
+        RAPIDJSON_UINT64_C2(0x7BAA4A98, 0x70C46094), RAPIDJSON_UINT64_C2(0x344AFB96, 0x79A3BD20),
+        RAPIDJSON_UINT64_C2(0x62EEA213, 0x8D69E6DD), RAPIDJSON_UINT64_C2(0x103BFC78, 0x614FCA80),
+        RAPIDJSON_UINT64_C2(0x4F254E76, 0x0ABB1F17), RAPIDJSON_UINT64_C2(0x26966393, 0x810CA200),
+        RAPIDJSON_UINT64_C2(0x7EA21723, 0x445E9825), RAPIDJSON_UINT64_C2(0x2423D285, 0x9B476999),
+        RAPIDJSON_UINT64_C2(0x654E78E9, 0x037EE01D), RAPIDJSON_UINT64_C2(0x69B64204, 0x7C392148),
+        RAPIDJSON_UINT64_C2(0x510B93ED, 0x9C658017), RAPIDJSON_UINT64_C2(0x6E2B6803, 0x96941AA0),
+        RAPIDJSON_UINT64_C2(0x40D60FF1, 0x49EACCDF), RAPIDJSON_UINT64_C2(0x71BC5336, 0x1210154D),
+        RAPIDJSON_UINT64_C2(0x67BCE64E, 0xDCAAE166), RAPIDJSON_UINT64_C2(0x1C608523, 0x5019BBAE),
+        RAPIDJSON_UINT64_C2(0x52FD850B, 0xE3BBE784), RAPIDJSON_UINT64_C2(0x7D1A041C, 0x40149625),
+        RAPIDJSON_UINT64_C2(0x42646A6F, 0xE9631F9D), RAPIDJSON_UINT64_C2(0x4A7B367D, 0x0010781D),
+        RAPIDJSON_UINT64_C2(0x6A3A43E6, 0x42383295), RAPIDJSON_UINT64_C2(0x5D91F0C8, 0x001A59C8),
+        RAPIDJSON_UINT64_C2(0x54FB6985, 0x01C68EDE), RAPIDJSON_UINT64_C2(0x17A7F3D3, 0x334847D4),
+        RAPIDJSON_UINT64_C2(0x43FC546A, 0x67D20BE4), RAPIDJSON_UINT64_C2(0x79532975, 0xC2A03976),
+        RAPIDJSON_UINT64_C2(0x6CC6ED77, 0x0C83463B), RAPIDJSON_UINT64_C2(0x0EEB7589, 0x3766C256),
+        RAPIDJSON_UINT64_C2(0x57058AC5, 0xA39C382F), RAPIDJSON_UINT64_C2(0x25892AD4, 0x2C523512),
+        RAPIDJSON_UINT64_C2(0x459E089E, 0x1C7CF9BF), RAPIDJSON_UINT64_C2(0x37A0EF10, 0x2374F742),
+        RAPIDJSON_UINT64_C2(0x6F6340FC, 0xFA618F98), RAPIDJSON_UINT64_C2(0x59017E80, 0x38BB2536),
+        RAPIDJSON_UINT64_C2(0x591C33FD, 0x951AD946), RAPIDJSON_UINT64_C2(0x7A679866, 0x93C8EA91),
+        RAPIDJSON_UINT64_C2(0x4749C331, 0x44157A9F), RAPIDJSON_UINT64_C2(0x151FAD1E, 0xDCA0BBA8),
+        RAPIDJSON_UINT64_C2(0x720F9EB5, 0x39BBF765), RAPIDJSON_UINT64_C2(0x0832AE97, 0xC76792A5),
+        RAPIDJSON_UINT64_C2(0x5B3FB22A, 0x94965F84), RAPIDJSON_UINT64_C2(0x068EF213, 0x05EC7551),
+        RAPIDJSON_UINT64_C2(0x48FFC1BB, 0xAA11E603), RAPIDJSON_UINT64_C2(0x1ED8C1A8, 0xD189F774),
+        RAPIDJSON_UINT64_C2(0x74CC692C, 0x434FD66B), RAPIDJSON_UINT64_C2(0x4AF4690E, 0x1C0FF253),
+        RAPIDJSON_UINT64_C2(0x5D705423, 0x690CAB89), RAPIDJSON_UINT64_C2(0x225D20D8, 0x16732843),
+        RAPIDJSON_UINT64_C2(0x4AC0434F, 0x873D5607), RAPIDJSON_UINT64_C2(0x35174D79, 0xAB8F5369),
+        RAPIDJSON_UINT64_C2(0x779A054C, 0x0B955672), RAPIDJSON_UINT64_C2(0x21BEE25C, 0x45B21F0E),
+        RAPIDJSON_UINT64_C2(0x5FAE6AA3, 0x3C77785B), RAPIDJSON_UINT64_C2(0x3498B516, 0x9E2818D8),
+        RAPIDJSON_UINT64_C2(0x4C8B8882, 0x96C5F9E2), RAPIDJSON_UINT64_C2(0x5D46F745, 0x4B534713),
+        RAPIDJSON_UINT64_C2(0x7A78DA6A, 0x8AD65C9D), RAPIDJSON_UINT64_C2(0x7BA4BED5, 0x45520B52),
+        RAPIDJSON_UINT64_C2(0x61FA4855, 0x3BDEB07E), RAPIDJSON_UINT64_C2(0x2FB6FF11, 0x0441A2A8),
+        RAPIDJSON_UINT64_C2(0x4E61D377, 0x63188D31), RAPIDJSON_UINT64_C2(0x72F8CC0D, 0x9D014EED),
+        RAPIDJSON_UINT64_C2(0x7D695258, 0x9E8DAEB6), RAPIDJSON_UINT64_C2(0x1E5AE015, 0xC80217E1),
+        RAPIDJSON_UINT64_C2(0x645441E0, 0x7ED7BEF8), RAPIDJSON_UINT64_C2(0x1848B344, 0xA001ACB4),
+        RAPIDJSON_UINT64_C2(0x504367E6, 0xCBDFCBF9), RAPIDJSON_UINT64_C2(0x603A2903, 0xB3348A2A),
+        RAPIDJSON_UINT64_C2(0x4035ECB8, 0xA3196FFB), RAPIDJSON_UINT64_C2(0x002E8736, 0x28F6D4EE),
+        RAPIDJSON_UINT64_C2(0x66BCADF4, 0x3828B32B), RAPIDJSON_UINT64_C2(0x19E40B89, 0xDB2487E3),
+        RAPIDJSON_UINT64_C2(0x52308B29, 0xC686F5BC), RAPIDJSON_UINT64_C2(0x14B66FA1, 0x7C1D3983),
+        RAPIDJSON_UINT64_C2(0x41C06F54, 0x9ED25E30), RAPIDJSON_UINT64_C2(0x1091F2E7, 0x967DC79C),
+        RAPIDJSON_UINT64_C2(0x6933E554, 0x315096B3), RAPIDJSON_UINT64_C2(0x341CB7D8, 0xF0C93F5F),
+        RAPIDJSON_UINT64_C2(0x54298443, 0x5AA6DEF5), RAPIDJSON_UINT64_C2(0x767D5FE0, 0xC0A0FF80),
+        RAPIDJSON_UINT64_C2(0x435469CF, 0x7BB8B25E), RAPIDJSON_UINT64_C2(0x2B977FE7, 0x0080CC66),
+        RAPIDJSON_UINT64_C2(0x6BBA42E5, 0x92C11D63), RAPIDJSON_UINT64_C2(0x5F58CCA4, 0xCD9AE0A3),
+        RAPIDJSON_UINT64_C2(0x562E9BEA, 0xDBCDB11C), RAPIDJSON_UINT64_C2(0x4C470A1D, 0x7148B3B6),
+        RAPIDJSON_UINT64_C2(0x44F21655, 0x7CA48DB0), RAPIDJSON_UINT64_C2(0x3D05A1B1, 0x276D5C92),
+        RAPIDJSON_UINT64_C2(0x6E5023BB, 0xFAA0E2B3), RAPIDJSON_UINT64_C2(0x7B3C35E8, 0x3F1560E9),
+        RAPIDJSON_UINT64_C2(0x58401C96, 0x621A4EF6), RAPIDJSON_UINT64_C2(0x2F635E53, 0x65AAB3ED),
+        RAPIDJSON_UINT64_C2(0x4699B078, 0x4E7B725E), RAPIDJSON_UINT64_C2(0x591C4B75, 0xEAEEF658),
+        RAPIDJSON_UINT64_C2(0x70F5E726, 0xE3F8B6FD), RAPIDJSON_UINT64_C2(0x74FA1256, 0x44B18A26),
+        RAPIDJSON_UINT64_C2(0x5A5E5285, 0x832D5F31), RAPIDJSON_UINT64_C2(0x43FB41DE, 0x9D5AD4EB),
+        RAPIDJSON_UINT64_C2(0x484B7537, 0x9C244C27), RAPIDJSON_UINT64_C2(0x4FFC34B2, 0x177BDD89),
+        RAPIDJSON_UINT64_C2(0x73ABEEBF, 0x603A1372), RAPIDJSON_UINT64_C2(0x4CC6BAB6, 0x8BF96274),
+        RAPIDJSON_UINT64_C2(0x5C898BCC, 0x4CFB42C2), RAPIDJSON_UINT64_C2(0x0A38955E, 0xD6611B90),
+        RAPIDJSON_UINT64_C2(0x4A07A309, 0xD72F689B), RAPIDJSON_UINT64_C2(0x21C6DDE5, 0x784DAFA7),
+        RAPIDJSON_UINT64_C2(0x76729E76, 0x2518A75E), RAPIDJSON_UINT64_C2(0x693E2FD5, 0x8D49190B),
+        RAPIDJSON_UINT64_C2(0x5EC2185E, 0x8413B918), RAPIDJSON_UINT64_C2(0x5431BFDE, 0x0AA0E0D5),
+        RAPIDJSON_UINT64_C2(0x4BCE79E5, 0x36762DAD), RAPIDJSON_UINT64_C2(0x29C1664B, 0x3BB3E711),
+        RAPIDJSON_UINT64_C2(0x794A5CA1, 0xF0BD15E2), RAPIDJSON_UINT64_C2(0x0F9BD6DE, 0xC5ECA4E8),
+        RAPIDJSON_UINT64_C2(0x61084A1B, 0x26FDAB1B), RAPIDJSON_UINT64_C2(0x2616457F, 0x04BD50BA),
+        RAPIDJSON_UINT64_C2(0x4DA03B48, 0xEBFE227C), RAPIDJSON_UINT64_C2(0x1E783798, 0xD09773C8),
+        RAPIDJSON_UINT64_C2(0x7C33920E, 0x46636A60), RAPIDJSON_UINT64_C2(0x30C058F4, 0x80F252D9),
+        RAPIDJSON_UINT64_C2(0x635C74D8, 0x384F884D), RAPIDJSON_UINT64_C2(0x0D66AD90, 0x67284247),
+        RAPIDJSON_UINT64_C2(0x4F7D2A46, 0x9372D370), RAPIDJSON_UINT64_C2(0x711EF140, 0x52869B6C),
+        RAPIDJSON_UINT64_C2(0x7F2EAA0A, 0x85848581), RAPIDJSON_UINT64_C2(0x34FE4ECD, 0x50D75F14),
+        RAPIDJSON_UINT64_C2(0x65BEEE6E, 0xD136D134), RAPIDJSON_UINT64_C2(0x2A650BD7, 0x73DF7F43),
+        RAPIDJSON_UINT64_C2(0x51658B8B, 0xDA9240F6), RAPIDJSON_UINT64_C2(0x551DA312, 0xC319329C),
+        RAPIDJSON_UINT64_C2(0x411E093C, 0xAEDB672B), RAPIDJSON_UINT64_C2(0x5DB14F42, 0x35ADC217),
+        RAPIDJSON_UINT64_C2(0x68300EC7, 0x7E2BD845), RAPIDJSON_UINT64_C2(0x7C4EE536, 0xBC49368A),
+        RAPIDJSON_UINT64_C2(0x5359A56C, 0x64EFE037), RAPIDJSON_UINT64_C2(0x7D0BEA92, 0x303A9208),
+        RAPIDJSON_UINT64_C2(0x42AE1DF0, 0x50BFE693), RAPIDJSON_UINT64_C2(0x173CBBA8, 0x269541A0),
+        RAPIDJSON_UINT64_C2(0x6AB02FE6, 0xE79970EB), RAPIDJSON_UINT64_C2(0x3EC792A6, 0xA422029A),
+        RAPIDJSON_UINT64_C2(0x5559BFEB, 0xEC7AC0BC), RAPIDJSON_UINT64_C2(0x3239421E, 0xE9B4CEE1),
+        RAPIDJSON_UINT64_C2(0x4447CCBC, 0xBD2F0096), RAPIDJSON_UINT64_C2(0x5B6101B2, 0x5490A581),
+        RAPIDJSON_UINT64_C2(0x6D3FADFA, 0xC84B3424), RAPIDJSON_UINT64_C2(0x2BCE691D, 0x541AA268),
+        RAPIDJSON_UINT64_C2(0x576624C8, 0xA03C29B6), RAPIDJSON_UINT64_C2(0x563EBA7D, 0xDCE21B87),
+        RAPIDJSON_UINT64_C2(0x45EB50A0, 0x8030215E), RAPIDJSON_UINT64_C2(0x78322ECB, 0x171B4939),
+        RAPIDJSON_UINT64_C2(0x6FDEE767, 0x33803564), RAPIDJSON_UINT64_C2(0x59E9E478, 0x24F87527),
+        RAPIDJSON_UINT64_C2(0x597F1F85, 0xC2CCF783), RAPIDJSON_UINT64_C2(0x6187E9F9, 0xB72D2A86),
+        RAPIDJSON_UINT64_C2(0x4798E604, 0x9BD72C69), RAPIDJSON_UINT64_C2(0x346CBB2E, 0x2C242205),
+        RAPIDJSON_UINT64_C2(0x728E3CD4, 0x2C8B7A42), RAPIDJSON_UINT64_C2(0x20ADF849, 0xE039D007),
+        RAPIDJSON_UINT64_C2(0x5BA4FD76, 0x8A092E9B), RAPIDJSON_UINT64_C2(0x33BE603B, 0x19C7D99F),
+        RAPIDJSON_UINT64_C2(0x4950CAC5, 0x3B3A8BAF), RAPIDJSON_UINT64_C2(0x42FEB362, 0x7B0647B3),
+        RAPIDJSON_UINT64_C2(0x754E113B, 0x91F745E5), RAPIDJSON_UINT64_C2(0x5197856A, 0x5E7072B8),
+        RAPIDJSON_UINT64_C2(0x5DD80DC9, 0x41929E51), RAPIDJSON_UINT64_C2(0x27AC6ABB, 0x7EC05BC6),
+        RAPIDJSON_UINT64_C2(0x4B133E3A, 0x9ADBB1DA), RAPIDJSON_UINT64_C2(0x52F05562, 0xCBCD1638),
+        RAPIDJSON_UINT64_C2(0x781EC9F7, 0x5E2C4FC4), RAPIDJSON_UINT64_C2(0x1E4D556A, 0xDFAE89F3),
+        RAPIDJSON_UINT64_C2(0x6018A192, 0xB1BD0C9C), RAPIDJSON_UINT64_C2(0x7EA44455, 0x7FBED4C3),
+        RAPIDJSON_UINT64_C2(0x4CE08142, 0x27CA707D), RAPIDJSON_UINT64_C2(0x4BB69D11, 0x32FF109C),
+        RAPIDJSON_UINT64_C2(0x7B00CED0, 0x3FAA4D95), RAPIDJSON_UINT64_C2(0x5F8A94E8, 0x51981A93),
+        RAPIDJSON_UINT64_C2(0x62670BD9, 0xCC883E11), RAPIDJSON_UINT64_C2(0x32D543ED, 0x0E134875),
+        RAPIDJSON_UINT64_C2(0x4EB8D647, 0xD6D364DA), RAPIDJSON_UINT64_C2(0x5BDDCFF0, 0xD80F6D2B),
+        RAPIDJSON_UINT64_C2(0x7DF48A0C, 0x8AEBD491), RAPIDJSON_UINT64_C2(0x12FC7FE7, 0xC018AEAB),
+        RAPIDJSON_UINT64_C2(0x64C3A1A3, 0xA25643A7), RAPIDJSON_UINT64_C2(0x28C9FFEC, 0x99AD5889),
+        RAPIDJSON_UINT64_C2(0x509C814F, 0xB511CFB9), RAPIDJSON_UINT64_C2(0x0707FFF0, 0x7AF113A1),
+        RAPIDJSON_UINT64_C2(0x407D343F, 0xC40E3FC7), RAPIDJSON_UINT64_C2(0x1F39998D, 0x2F2742E7),
+        RAPIDJSON_UINT64_C2(0x672EB9FF, 0xA016CC71), RAPIDJSON_UINT64_C2(0x7EC28F48, 0x4B7204A4),
+        RAPIDJSON_UINT64_C2(0x528BC7FF, 0xB345705B), RAPIDJSON_UINT64_C2(0x189BA5D3, 0x6F8E6A1D),
+        RAPIDJSON_UINT64_C2(0x42096CCC, 0x8F6AC048), RAPIDJSON_UINT64_C2(0x7A161E42, 0xBFA521B1),
+        RAPIDJSON_UINT64_C2(0x69A8AE14, 0x18AACD41), RAPIDJSON_UINT64_C2(0x435696D1, 0x32A1CF81),
+        RAPIDJSON_UINT64_C2(0x5486F1A9, 0xAD557101), RAPIDJSON_UINT64_C2(0x1C454574, 0x288172CE),
+        RAPIDJSON_UINT64_C2(0x439F27BA, 0xF1112734), RAPIDJSON_UINT64_C2(0x169DD129, 0xBA0128A5),
+        RAPIDJSON_UINT64_C2(0x6C31D92B, 0x1B4EA520), RAPIDJSON_UINT64_C2(0x242FB50F, 0x9001DAA1),
+        RAPIDJSON_UINT64_C2(0x568E4755, 0xAF721DB3), RAPIDJSON_UINT64_C2(0x368C90D9, 0x40017BB4),
+        RAPIDJSON_UINT64_C2(0x453E9F77, 0xBF8E7E29), RAPIDJSON_UINT64_C2(0x120A0D7A, 0x999AC95D),
+        RAPIDJSON_UINT64_C2(0x6ECA98BF, 0x98E3FD0E), RAPIDJSON_UINT64_C2(0x50101590, 0xF5C47561),
+        RAPIDJSON_UINT64_C2(0x58A213CC, 0x7A4FFDA5), RAPIDJSON_UINT64_C2(0x26734473, 0xF7D05DE8),
+        RAPIDJSON_UINT64_C2(0x46E80FD6, 0xC83FFE1D), RAPIDJSON_UINT64_C2(0x6B8F69F6, 0x5FD9E4B9),
+        RAPIDJSON_UINT64_C2(0x71734C8A, 0xD9FFFCFC), RAPIDJSON_UINT64_C2(0x45B24323, 0xCC8FD45C),
+        RAPIDJSON_UINT64_C2(0x5AC2A3A2, 0x47FFFD96), RAPIDJSON_UINT64_C2(0x6AF50283, 0x0A0CA9E3),
+        RAPIDJSON_UINT64_C2(0x489BB61B, 0x6CCCCADF), RAPIDJSON_UINT64_C2(0x08C40202, 0x6E7087E9),
+        RAPIDJSON_UINT64_C2(0x742C5692, 0x47AE1164), RAPIDJSON_UINT64_C2(0x746CD003, 0xE3E73FDB),
+        RAPIDJSON_UINT64_C2(0x5CF04541, 0xD2F1A783), RAPIDJSON_UINT64_C2(0x76BD7336, 0x4FEC3315),
+        RAPIDJSON_UINT64_C2(0x4A59D101, 0x758E1F9C), RAPIDJSON_UINT64_C2(0x5EFDF5C5, 0x0CBCF5AB),
+        RAPIDJSON_UINT64_C2(0x76F61B35, 0x88E365C7), RAPIDJSON_UINT64_C2(0x4B2FEFA1, 0xADFB22AB),
+        RAPIDJSON_UINT64_C2(0x5F2B48F7, 0xA0B5EB06), RAPIDJSON_UINT64_C2(0x08F3261A, 0xF195B555),
+        RAPIDJSON_UINT64_C2(0x4C22A0C6, 0x1A2B226B), RAPIDJSON_UINT64_C2(0x20C284E2, 0x5ADE2AAB),
+        RAPIDJSON_UINT64_C2(0x79D1013C, 0xF6AB6A45), RAPIDJSON_UINT64_C2(0x1AD0D49D, 0x5E304444),
+        RAPIDJSON_UINT64_C2(0x617400FD, 0x9222BB6A), RAPIDJSON_UINT64_C2(0x48A7107D, 0xE4F369D0),
+        RAPIDJSON_UINT64_C2(0x4DF66731, 0x41B562BB), RAPIDJSON_UINT64_C2(0x53B8D9FE, 0x50C2BB0D),
+        RAPIDJSON_UINT64_C2(0x7CBD71E8, 0x69223792), RAPIDJSON_UINT64_C2(0x52C15CCA, 0x1AD12B48),
+        RAPIDJSON_UINT64_C2(0x63CAC186, 0xBA81C60E), RAPIDJSON_UINT64_C2(0x75677D6E, 0x7BDA8906),
+        RAPIDJSON_UINT64_C2(0x4FD5679E, 0xFB9B04D8), RAPIDJSON_UINT64_C2(0x5DEC6458, 0x63153A6C),
+        RAPIDJSON_UINT64_C2(0x7FBBD8FE, 0x5F5E6E27), RAPIDJSON_UINT64_C2(0x497A3A27, 0x04EEC3DF)
+    };
+    RAPIDJSON_ASSERT(k >= -324 && k <= 292);
+    return &kPow10[2 * (k + 324)];
+}
+
+//! cp * g * 2^-127, rounded to odd.
+inline uint64_t SchubfachRoundToOdd(const uint64_t* g, uint64_t cp) {
+    const uint64_t kMask63 = RAPIDJSON_UINT64_C2(0x7FFFFFFF, 0xFFFFFFFF);
+    uint64_t x1, y1;
+    Multiply128(g[1], cp, &x1);
+    const uint64_t y0 = Multiply128(g[0], cp, &y1);
+    const uint64_t z = (y0 >> 1) + x1;
+    return (y1 + (z >> 63)) | (((z & kMask63) + kMask63) >> 63);
+}
+
+//! Shortest decimal digits of a positive double that round trip.
+/*! Among the shortest candidates, the one closest to \c value is chosen, which
+    Grisu2 does not guarantee.
+    \param value Positive finite number.
+    \param buffer Receives at most 17 digits, without trailing zeros.
+    \param length Number of digits written.
+    \param K Decimal exponent, value = digits * 10^K.
+*/
+inline void Schubfach(double value, char* buffer, int* length, int* K) {
+    const Double d(value);
+    RAPIDJSON_ASSERT(value > 0 && !d.IsNanOrInf());
+    const uint64_t c = d.IntegerSignificand();
+    const int q = d.IntegerExponent();
+    const uint64_t kHiddenBit = RAPIDJSON_UINT64_C2(0x00100000, 0x00000000);
+    const int kMinExponent = -1074;
+
+    uint64_t f;
+    int k;
+    if (q < 0 && q > -53 && (c & ((uint64_t(1) << -q) - 1)) == 0) {
+        // Integers in the range of the significand.
+        f = c >> -q;
+        k = 0;
+    }
+    else {
+        const uint64_t out = c & 1;
+        const uint64_t cb = c << 2;
+        const uint64_t cbr = cb + 2;
+        uint64_t cbl;
+        if (c != kHiddenBit || q == kMinExponent) {
+            cbl = cb - 2;
+            k = SchubfachFloorLog10Pow2(q);
+        }
+        else {
+            // The interval is narrower below powers of two.
+            cbl = cb - 1;
+            k = SchubfachFloorLog10ThreeQuartersPow2(q);
+        }
+        const int h = q + SchubfachFloorLog2Pow10(-k) + 2;
+        const uint64_t* g = SchubfachPow10(k);
+        const uint64_t vb = SchubfachRoundToOdd(g, cb << h);
+        const uint64_t vbl = SchubfachRoundToOdd(g, cbl << h) + out;
+        const uint64_t vbr = SchubfachRoundToOdd(g, cbr << h) - out;
+
+        const uint64_t s = vb >> 2;
+        bool done = false;
+        if (s >= 10) {
+            // Try one digit less first.
+            const uint64_t sp10 = s / 10 * 10;
+            const uint64_t tp10 = sp10 + 10;
+            const bool upin = vbl <= sp10 << 2;
+            const bool wpin = tp10 << 2 <= vbr;
+            if (upin != wpin) {
+                f = upin ? sp10 : tp10;
+                done = true;
+            }
+        }
+        if (!done) {
+            const uint64_t t = s + 1;
+            const bool uin = vbl <= s << 2;
+            const bool win = t << 2 <= vbr;
+            if (uin != win)
+                f = uin ? s : t;
+            else {
+                // Both lie in the interval: pick the closest, or the even one on a tie.
+                const uint64_t mid = (s + t) << 1;
+                f = vb < mid || (vb == mid && (s & 1) == 0) ? s : t;
+            }
+        }
+    }
+
+    // Remove trailing zeros, which short values have many of.
+    while (f % 100000000 == 0) {
+        f /= 100000000;
+        k += 8;
+    }
+    if (f % 10000 == 0) {
+        f /= 10000;
+        k += 4;
+    }
+    if (f % 100 == 0) {
+        f /= 100;
+        k += 2;
+    }
+    if (f % 10 == 0) {
+        f /= 10;
+        k++;
+    }
+    *length = static_cast<int>(u64toa(f, buffer) - buffer);
+    *K = k;
+}
+
+} // namespace internal
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_SCHUBFACH_
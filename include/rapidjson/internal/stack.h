@@ -37,7 +37,11 @@ class Stack {
 public:
     // Optimization note: Do not allocate memory for stack_ in constructor.
     // Do it lazily when first Push() -> Expand() -> Resize().
-    Stack(Allocator* allocator, size_t stackCapacity) : allocator_(allocator), ownAllocator_(0), stack_(0), stackTop_(0), stackEnd_(0), initialCapacity_(stackCapacity) {
+    Stack(Allocator* allocator, size_t stackCapacity) : allocator_(allocator), ownAllocator_(0), stack_(0), stackTop_(0), stackEnd_(0), initialCapacity_(stackCapacity)
+#if RAPIDJSON_ALLOCATION_STATS
+        , resizeCount_(0), resizeBytes_(0), peakSize_(0)
+#endif
+    {
     }
 
 #if RAPIDJSON_HAS_CXX11_RVALUE_REFS
@@ -48,6 +52,11 @@ public:
           stackTop_(rhs.stackTop_),
           stackEnd_(rhs.stackEnd_),
           initialCapacity_(rhs.initialCapacity_)
+#if RAPIDJSON_ALLOCATION_STATS
+        , resizeCount_(rhs.resizeCount_),
+          resizeBytes_(rhs.resizeBytes_),
+          peakSize_(rhs.peakSize_)
+#endif
     {
         rhs.allocator_ = 0;
         rhs.ownAllocator_ = 0;
@@ -74,6 +83,11 @@ public:
             stackTop_ = rhs.stackTop_;
             stackEnd_ = rhs.stackEnd_;
             initialCapacity_ = rhs.initialCapacity_;
+#if RAPIDJSON_ALLOCATION_STATS
+            resizeCount_ = rhs.resizeCount_;
+            resizeBytes_ = rhs.resizeBytes_;
+            peakSize_ = rhs.peakSize_;
+#endif
 
             rhs.allocator_ = 0;
             rhs.ownAllocator_ = 0;
@@ -93,9 +107,19 @@ public:
         internal::Swap(stackTop_, rhs.stackTop_);
         internal::Swap(stackEnd_, rhs.stackEnd_);
         internal::Swap(initialCapacity_, rhs.initialCapacity_);
+#if RAPIDJSON_ALLOCATION_STATS
+        internal::Swap(resizeCount_, rhs.resizeCount_);
+        internal::Swap(resizeBytes_, rhs.resizeBytes_);
+        internal::Swap(peakSize_, rhs.peakSize_);
+#endif
     }
 
-    void Clear() { stackTop_ = stack_; }
+    void Clear() {
+#if RAPIDJSON_ALLOCATION_STATS
+        UpdatePeakSize();
+#endif
+        stackTop_ = stack_;
+    }
 
     void ShrinkToFit() { 
         if (Empty()) {
@@ -135,6 +159,9 @@ public:
     template<typename T>
     T* Pop(size_t count) {
         RAPIDJSON_ASSERT(GetSize() >= count * sizeof(T));
+#if RAPIDJSON_ALLOCATION_STATS
+        UpdatePeakSize();
+#endif
         stackTop_ -= count * sizeof(T);
         return reinterpret_cast<T*>(stackTop_);
     }
@@ -176,6 +203,24 @@ public:
     size_t GetSize() const { return static_cast<size_t>(stackTop_ - stack_); }
     size_t GetCapacity() const { return static_cast<size_t>(stackEnd_ - stack_); }
 
+#if RAPIDJSON_ALLOCATION_STATS
+    //! Restarts counting, from the current size.
+    void ResetStats() {
+        resizeCount_ = 0;
+        resizeBytes_ = 0;
+        peakSize_ = GetSize();
+    }
+
+    //! Number of allocations and expansions.
+    size_t GetResizeCount() const { return resizeCount_; }
+
+    //! Bytes requested by the allocations and expansions.
+    size_t GetResizeBytes() const { return resizeBytes_; }
+
+    //! Largest size in bytes.
+    size_t GetPeakSize() const { return peakSize_ > GetSize() ? peakSize_ : GetSize(); }
+#endif
+
 private:
     template<typename T>
     void Expand(size_t count) {
@@ -198,11 +243,23 @@ private:
 
     void Resize(size_t newCapacity) {
         const size_t size = GetSize();  // Backup the current size
+#if RAPIDJSON_ALLOCATION_STATS
+        resizeCount_++;
+        resizeBytes_ += newCapacity;
+#endif
         stack_ = static_cast<char*>(allocator_->Realloc(stack_, GetCapacity(), newCapacity));
         stackTop_ = stack_ + size;
         stackEnd_ = stack_ + newCapacity;
     }
 
+#if RAPIDJSON_ALLOCATION_STATS
+    // The size only drops on Pop() and Clear(), so the peak is reached right before one of them.
+    void UpdatePeakSize() {
+        if (GetSize() > peakSize_)
+            peakSize_ = GetSize();
+    }
+#endif
+
     void Destroy() {
         Allocator::Free(stack_);
         RAPIDJSON_DELETE(ownAllocator_); // Only delete if it is owned by the stack
@@ -218,6 +275,11 @@ private:
     char *stackTop_;
     char *stackEnd_;
     size_t initialCapacity_;
+#if RAPIDJSON_ALLOCATION_STATS
+    size_t resizeCount_;    //!< Allocations and expansions since ResetStats().
+    size_t resizeBytes_;    //!< Bytes requested by these.
+    size_t peakSize_;       //!< Largest size before the last Pop() or Clear().
+#endif
 };
 
 } // namespace internal
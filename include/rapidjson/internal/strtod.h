@@ -19,6 +19,8 @@
 #include "biginteger.h"
 #include "diyfp.h"
 #include "pow10.h"
+#include "pow5.h"
+#include "digits.h"
 
 RAPIDJSON_NAMESPACE_BEGIN
 namespace internal {
@@ -125,6 +127,90 @@ inline bool StrtodFast(double d, int p, double* result) {
         return false;
 }
 
+//! Correctly rounded w * 10^q with the Eisel-Lemire algorithm.
+/*! The 64-bit significand is multiplied by a 128-bit approximation of 5^q,
+    which determines the nearest double unless the product is too close to a
+    halfway point between two doubles.
+    \return false if the result cannot be decided, or overflows.
+*/
+inline bool StrtodEiselLemire(uint64_t w, int q, double* result) {
+    static const uint64_t kHiddenBit = RAPIDJSON_UINT64_C2(0x00100000, 0x00000000);
+    static const uint64_t kSignificandMask = RAPIDJSON_UINT64_C2(0x000FFFFF, 0xFFFFFFFF);
+    static const int kSignificandSize = 52;
+
+    if (w == 0 || q < kPow5Significand128Min) { // w * 10^q < 2^64 * 10^-343 < 2^-1075
+        *result = 0.0;
+        return true;
+    }
+    if (q > kPow5Significand128Max)
+        return false;
+
+    const DiyFp v = DiyFp(w, 0).Normalize();
+    const int lz = -v.e;
+    w = v.f;
+
+    // The high word holds the 53 bits of the result plus round bits. The low
+    // half of 5^q is only needed when the bits below them may still carry.
+    const uint64_t* pow5 = Pow5Significand128(q);
+    uint64_t hi;
+    uint64_t lo = Multiply128(w, pow5[0], &hi);
+    const uint64_t kPrecisionMask = 0x1FF; // 64 - 52 - 3 bits
+    if ((hi & kPrecisionMask) == kPrecisionMask) {
+        uint64_t hi2;
+        Multiply128(w, pow5[1], &hi2);
+        lo += hi2;
+        if (hi2 > lo)
+            hi++;
+    }
+    if (lo == ~uint64_t(0) && (q < -27 || q > 55)) // product of the truncated table may be too low
+        return false;
+
+    const int upperBit = static_cast<int>(hi >> 63);
+    const int shift = upperBit + 64 - kSignificandSize - 3;
+    uint64_t mantissa = hi >> shift;
+    // floor(q * log2(10)) + 63, plus the exponent bias
+    int power2 = ((217706 * q) >> 16) + 63 + upperBit - lz + 0x3FF;
+
+    if (power2 <= 0) { // subnormal
+        if (-power2 + 1 >= 64) {
+            *result = 0.0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < kHiddenBit ? 0 : 1;
+    }
+    else {
+        // Exactly halfway: round to even. Only possible when 5^q is exact in the table.
+        if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi)
+            mantissa &= ~uint64_t(1);
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        if (mantissa >= (kHiddenBit << 1)) {
+            mantissa = kHiddenBit;
+            power2++;
+        }
+        if (power2 >= 0x7FF)
+            return false;
+    }
+
+    *result = Double((mantissa & kSignificandMask) | (static_cast<uint64_t>(power2) << kSignificandSize)).Value();
+    return true;
+}
+
+//! Value of at most 19 decimal digits.
+inline uint64_t ParseDecimal64(const char* decimals, size_t length) {
+    RAPIDJSON_ASSERT(length <= 19);
+    uint64_t r = 0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+        r = r * 100000000u + ParseEightDigits(decimals + i);
+    for (; i < length; i++)
+        r = r * 10u + static_cast<unsigned>(decimals[i] - '0');
+    return r;
+}
+
 // Compute an approximation and see if it is within 1/2 ULP
 inline bool StrtodDiyFp(const char* decimals, size_t length, size_t decimalPosition, int exp, double* result) {
     uint64_t significand = 0;
@@ -243,6 +329,10 @@ inline double StrtodFullPrecision(double d, int p, const char* decimals, size_t
         exp++;
     }
 
+    // Buffer only contains zeros
+    if (*decimals == '0')
+        return 0.0;
+
     // Trim right-most digits
     const int kMaxDecimalDigit = 780;
     if (static_cast<int>(length) > kMaxDecimalDigit) {
@@ -253,9 +343,26 @@ inline double StrtodFullPrecision(double d, int p, const char* decimals, size_t
     }
 
     // If too small, underflow to zero
-    if (int(length) + exp < -324)
+    if (static_cast<int>(decimalPosition) + exp <= -324)
         return 0.0;
 
+    // Eisel-Lemire on the first 19 digits, which are exact in 64 bits. With more
+    // digits, the value lies between the truncated significand and its successor:
+    // the result is decided if both round to the same double, and is one of the two otherwise.
+    const size_t n = length < 19 ? length : 19;
+    const uint64_t significand = ParseDecimal64(decimals, n);
+    const int q = static_cast<int>(decimalPosition) - static_cast<int>(n) + exp;
+    if (StrtodEiselLemire(significand, q, &result)) {
+        if (n == length)
+            return result;
+        double upper;
+        if (StrtodEiselLemire(significand + 1, q, &upper)) {
+            if (Double(upper).Uint64Value() == Double(result).Uint64Value())
+                return result;
+            return StrtodBigInteger(result, decimals, length, decimalPosition, exp);
+        }
+    }
+
     if (StrtodDiyFp(decimals, length, decimalPosition, exp, &result))
         return result;
 
@@ -263,6 +370,23 @@ inline double StrtodFullPrecision(double d, int p, const char* decimals, size_t
     return StrtodBigInteger(result, decimals, length, decimalPosition, exp);
 }
 
+//! Full precision conversion of significand * 10^p, with a significand of at most 19 digits.
+inline double StrtodFullPrecision(double d, int p, uint64_t significand) {
+    double result;
+    if (StrtodFast(d, p, &result) || StrtodEiselLemire(significand, p, &result))
+        return result;
+
+    // Rarely undecided, use the digits for the slower paths.
+    char buffer[20];
+    char* decimals = buffer + sizeof(buffer);
+    do {
+        *--decimals = static_cast<char>('0' + significand % 10);
+        significand /= 10;
+    } while (significand != 0);
+    const size_t length = static_cast<size_t>(buffer + sizeof(buffer) - decimals);
+    return StrtodFullPrecision(d, p, decimals, length, length, p);
+}
+
 } // namespace internal
 RAPIDJSON_NAMESPACE_END
 
@@ -0,0 +1,249 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_INTERNAL_STRUCTURALINDEX_H_
+#define RAPIDJSON_INTERNAL_STRUCTURALINDEX_H_
+
+#include "stack.h"
+#include "bitscan.h"
+#include <cstring>
+
+#ifdef RAPIDJSON_AVX2
+#include <immintrin.h>
+#elif defined(RAPIDJSON_SSE42)
+#include <nmmintrin.h>
+#elif defined(RAPIDJSON_SSE2)
+#include <emmintrin.h>
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+namespace internal {
+
+///////////////////////////////////////////////////////////////////////////////
+// StructuralIndexer
+
+//! First stage of \ref kParseStructuralIndexFlag parsing: classify UTF-8 JSON text 64 bytes at a time.
+/*! Each block is turned into bitmaps (bit i for byte i) of quotes, backslashes, whitespace
+    and structural characters (<tt>{}[],:</tt>), with AVX2, SSE2/SSE4.2 or plain C++.
+    Escaped characters and the extent of strings are then derived with carry-propagating
+    integer arithmetic, so no byte is examined twice. The resulting index holds
+    the offset of
+    \li every structural character outside strings,
+    \li every opening quote,
+    \li every other non-whitespace character outside strings which does not follow such a character (the start of a number or a literal).
+
+    A byte which is not in the index is either inside a token or whitespace, except for
+    bytes directly after the end of a token. This lets the second stage jump from token to
+    token and still detect all misplaced characters.
+*/
+class StructuralIndexer {
+public:
+    StructuralIndexer() : escapedCarry_(0), inStringCarry_(0), scalarCarry_(0) {}
+
+    //! Start in the middle of a text, after an escaping backslash and/or inside a string.
+    StructuralIndexer(bool escaped, bool inString) : escapedCarry_(escaped ? 1u : 0u), inStringCarry_(inString ? ~uint64_t(0) : 0), scalarCarry_(0) {}
+
+    //! Index a null-terminated text of \c length bytes.
+    /*! Pushes the offsets as \c uint32_t onto \c index, followed by \c length as a sentinel
+        for the terminator. The text must be shorter than 4GiB.
+        \return Whether the text ends inside a string.
+    */
+    template <typename Allocator>
+    static bool Build(const char* json, size_t length, Stack<Allocator>& index) {
+        RAPIDJSON_ASSERT(length < 0xFFFFFFFFu);
+        StructuralIndexer indexer;
+        size_t offset = 0;
+        for (; offset + 64 <= length; offset += 64)
+            Flatten(indexer.Next(json + offset), static_cast<uint32_t>(offset), index);
+        if (offset < length) {
+            // Pad the last block with whitespace, which never gets indexed.
+            char block[64];
+            std::memset(block, ' ', sizeof(block));
+            std::memcpy(block, json + offset, length - offset);
+            Flatten(indexer.Next(block), static_cast<uint32_t>(offset), index);
+        }
+        *index.template Push<uint32_t>() = static_cast<uint32_t>(length);
+        return indexer.InString();
+    }
+
+    //! Classify the next 64-byte block and return the bitmap of indexed positions.
+    uint64_t Next(const char* block) {
+        uint64_t quote, backslash, whitespace, open, close, separator;
+        Classify(block, quote, backslash, whitespace, open, close, separator);
+        uint64_t structural = open | close | separator;
+
+        quote &= ~Escaped(backslash);
+        const uint64_t inString = PrefixXor(quote) ^ inStringCarry_;  // Opening quote and content, not the closing quote
+        inStringCarry_ = 0 - (inString >> 63);
+
+        structural &= ~inString;
+        const uint64_t other = ~(structural | whitespace | quote | inString);
+        const uint64_t scalarStart = other & ~((other << 1) | scalarCarry_);
+        scalarCarry_ = other >> 63;
+
+        return structural | scalarStart | (quote & inString);
+    }
+
+    //! Classify the next block like Next(), but only find its brackets and separators.
+    /*! Lets a text be split between the elements of an array, see GenericParallelParser.
+        \param block 64 bytes of text.
+        \param open Receives the opening brackets, in strings or not.
+        \param close Receives the closing brackets, in strings or not.
+        \param separator Receives the commas and colons, in strings or not.
+        \return The positions inside strings.
+    */
+    uint64_t Scan(const char* block, uint64_t& open, uint64_t& close, uint64_t& separator) {
+        uint64_t quote, backslash, whitespace;
+        Classify(block, quote, backslash, whitespace, open, close, separator);
+
+        quote &= ~Escaped(backslash);
+        const uint64_t inString = PrefixXor(quote) ^ inStringCarry_;
+        inStringCarry_ = 0 - (inString >> 63);
+        return inString;
+    }
+
+    //! Whether the last block ended inside a string.
+    bool InString() const { return inStringCarry_ != 0; }
+
+private:
+    template <typename Allocator>
+    static RAPIDJSON_FORCEINLINE void Flatten(uint64_t bits, uint32_t offset, Stack<Allocator>& index) {
+        uint32_t* out = index.template Push<uint32_t>(64);
+        uint32_t* p = out;
+        while (bits) {
+            *p++ = offset + CountTrailingZero64(bits);
+            bits &= bits - 1;
+        }
+        index.template Pop<uint32_t>(static_cast<size_t>(out + 64 - p));
+    }
+
+    //! Characters preceded by an odd number of backslashes, including across blocks.
+    uint64_t Escaped(uint64_t backslash) {
+        if (!backslash) {
+            const uint64_t escaped = escapedCarry_;
+            escapedCarry_ = 0;
+            return escaped;
+        }
+        static const uint64_t kOddBits = RAPIDJSON_UINT64_C2(0xAAAAAAAA, 0xAAAAAAAA);
+        // A backslash which is itself escaped cannot start an escape sequence.
+        const uint64_t potentialEscape = backslash & ~escapedCarry_;
+        // Subtracting each run of backslashes from the odd bits flips the parity of the
+        // bit after the run, the character escaped by an odd run then differs from kOddBits.
+        const uint64_t escapeAndTerminal = (((potentialEscape << 1) | kOddBits) - potentialEscape) ^ kOddBits;
+        const uint64_t escaped = escapeAndTerminal ^ (backslash | escapedCarry_);
+        escapedCarry_ = (escapeAndTerminal & backslash) >> 63;
+        return escaped;
+    }
+
+    //! Bit i of the result is the xor of bits 0..i, i.e. whether position i lies between an odd and an even quote.
+    static RAPIDJSON_FORCEINLINE uint64_t PrefixXor(uint64_t bits) {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+#ifdef RAPIDJSON_AVX2
+    static RAPIDJSON_FORCEINLINE uint64_t Mask32(__m256i eq) {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+    }
+
+    static RAPIDJSON_FORCEINLINE void Classify32(const char* p, uint64_t& quote, uint64_t& backslash, uint64_t& whitespace, uint64_t& open, uint64_t& close, uint64_t& separator) {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        // '[' and ']' differ from '{' and '}' only in bit 5.
+        const __m256i lower = _mm256_or_si256(s, _mm256_set1_epi8(0x20));
+        quote = Mask32(_mm256_cmpeq_epi8(s, _mm256_set1_epi8('"')));
+        backslash = Mask32(_mm256_cmpeq_epi8(s, _mm256_set1_epi8('\\')));
+        whitespace = Mask32(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(s, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(s, _mm256_set1_epi8('\n'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(s, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(s, _mm256_set1_epi8('\t')))));
+        open = Mask32(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')));
+        close = Mask32(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}')));
+        separator = Mask32(_mm256_or_si256(_mm256_cmpeq_epi8(s, _mm256_set1_epi8(',')), _mm256_cmpeq_epi8(s, _mm256_set1_epi8(':'))));
+    }
+
+    static void Classify(const char* p, uint64_t& quote, uint64_t& backslash, uint64_t& whitespace, uint64_t& open, uint64_t& close, uint64_t& separator) {
+        uint64_t q, b, w, o, c, s;
+        Classify32(p, quote, backslash, whitespace, open, close, separator);
+        Classify32(p + 32, q, b, w, o, c, s);
+        quote |= q << 32;
+        backslash |= b << 32;
+        whitespace |= w << 32;
+        open |= o << 32;
+        close |= c << 32;
+        separator |= s << 32;
+    }
+#elif defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+    static RAPIDJSON_FORCEINLINE uint64_t Mask16(__m128i eq) {
+        return static_cast<uint16_t>(_mm_movemask_epi8(eq));
+    }
+
+    static void Classify(const char* p, uint64_t& quote, uint64_t& backslash, uint64_t& whitespace, uint64_t& open, uint64_t& close, uint64_t& separator) {
+        const __m128i dq = _mm_set1_epi8('"');
+        const __m128i bs = _mm_set1_epi8('\\');
+        const __m128i sp = _mm_set1_epi8(' ');
+        const __m128i nl = _mm_set1_epi8('\n');
+        const __m128i cr = _mm_set1_epi8('\r');
+        const __m128i ht = _mm_set1_epi8('\t');
+        const __m128i bit5 = _mm_set1_epi8(0x20);
+        const __m128i lb = _mm_set1_epi8('{');
+        const __m128i rb = _mm_set1_epi8('}');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i colon = _mm_set1_epi8(':');
+
+        quote = backslash = whitespace = open = close = separator = 0;
+        for (unsigned i = 0; i < 64; i += 16) {
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+            // '[' and ']' differ from '{' and '}' only in bit 5.
+            const __m128i lower = _mm_or_si128(s, bit5);
+            quote |= Mask16(_mm_cmpeq_epi8(s, dq)) << i;
+            backslash |= Mask16(_mm_cmpeq_epi8(s, bs)) << i;
+            whitespace |= Mask16(_mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(s, sp), _mm_cmpeq_epi8(s, nl)),
+                _mm_or_si128(_mm_cmpeq_epi8(s, cr), _mm_cmpeq_epi8(s, ht)))) << i;
+            open |= Mask16(_mm_cmpeq_epi8(lower, lb)) << i;
+            close |= Mask16(_mm_cmpeq_epi8(lower, rb)) << i;
+            separator |= Mask16(_mm_or_si128(_mm_cmpeq_epi8(s, comma), _mm_cmpeq_epi8(s, colon))) << i;
+        }
+    }
+#else
+    static void Classify(const char* p, uint64_t& quote, uint64_t& backslash, uint64_t& whitespace, uint64_t& open, uint64_t& close, uint64_t& separator) {
+        quote = backslash = whitespace = open = close = separator = 0;
+        for (unsigned i = 0; i < 64; i++) {
+            const uint64_t bit = uint64_t(1) << i;
+            switch (p[i]) {
+                case '"': quote |= bit; break;
+                case '\\': backslash |= bit; break;
+                case ' ': case '\n': case '\r': case '\t': whitespace |= bit; break;
+                case '{': case '[': open |= bit; break;
+                case '}': case ']': close |= bit; break;
+                case ',': case ':': separator |= bit; break;
+                default: break;
+            }
+        }
+    }
+#endif
+
+    uint64_t escapedCarry_;     //!< 1 if the first character of the next block is escaped.
+    uint64_t inStringCarry_;    //!< All ones if the next block starts inside a string.
+    uint64_t scalarCarry_;      //!< 1 if the last character of the block started or continued a number or literal.
+};
+
+} // namespace internal
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_INTERNAL_STRUCTURALINDEX_H_
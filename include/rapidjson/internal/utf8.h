@@ -0,0 +1,345 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_INTERNAL_UTF8_H_
+#define RAPIDJSON_INTERNAL_UTF8_H_
+
+#include "../rapidjson.h"
+#include <cstddef>
+#include <cstring>
+
+#ifdef RAPIDJSON_AVX2
+#include <immintrin.h>
+#elif defined(RAPIDJSON_SSE42)
+#include <nmmintrin.h>
+#elif defined(RAPIDJSON_SSE2)
+#include <emmintrin.h>
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+namespace internal {
+
+//! Decodes one UTF-8 code point.
+/*! Overlong forms, surrogates and code points above U+10FFFF are invalid,
+    as in UTF8::Validate(), and so is a sequence cut off by \c end.
+    \param[in,out] p Start of the sequence, moved past it if it is valid.
+    \return Whether the sequence is valid.
+*/
+inline bool DecodeUTF8(const char*& p, const char* end, unsigned* codepoint) {
+    const unsigned char c = static_cast<unsigned char>(*p);
+    if (c < 0x80) {
+        *codepoint = c;
+        p++;
+        return true;
+    }
+
+    // Number of continuation bytes, and the range of the first one (Unicode Table 3-7).
+    std::ptrdiff_t n;
+    unsigned char lo = 0x80, hi = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF)
+        n = 1;
+    else if (c >= 0xE0 && c <= 0xEF) {
+        n = 2;
+        if (c == 0xE0) lo = 0xA0;
+        else if (c == 0xED) hi = 0x9F;
+    }
+    else if (c >= 0xF0 && c <= 0xF4) {
+        n = 3;
+        if (c == 0xF0) lo = 0x90;
+        else if (c == 0xF4) hi = 0x8F;
+    }
+    else
+        return false;
+
+    if (end - p <= n)
+        return false;
+    const unsigned char c1 = static_cast<unsigned char>(p[1]);
+    if (c1 < lo || c1 > hi)
+        return false;
+    unsigned u = (c & (0x3Fu >> n)) << 6 | (c1 & 0x3Fu);
+    for (std::ptrdiff_t i = 2; i <= n; i++) {
+        const unsigned char ci = static_cast<unsigned char>(p[i]);
+        if ((ci & 0xC0) != 0x80)
+            return false;
+        u = u << 6 | (ci & 0x3Fu);
+    }
+    *codepoint = u;
+    p += n + 1;
+    return true;
+}
+
+//! Finds the first invalid UTF-8 sequence, one code point at a time.
+/*! \return Start of the first invalid sequence, or \c end.
+    \see DecodeUTF8()
+*/
+inline const char* FindInvalidUTF8Scalar(const char* p, const char* end) {
+    while (p != end) {
+        // Skip ASCII eight bytes at a time.
+        if (end - p >= 8) {
+            uint64_t w;
+            std::memcpy(&w, p, sizeof(w));
+            if ((w & RAPIDJSON_UINT64_C2(0x80808080, 0x80808080)) == 0) {
+                p += 8;
+                continue;
+            }
+        }
+        unsigned codepoint;
+        if (!DecodeUTF8(p, end, &codepoint))
+            break;
+    }
+    return p;
+}
+
+#ifdef RAPIDJSON_SSE42
+//! Vectorized UTF-8 validation with lookup tables.
+/*! Each byte is checked against the one to three bytes before it, 16 or 32 bytes
+    at a time, by looking up the high nibbles of two neighbouring bytes and the low
+    nibble of the first one in three 16-entry tables, whose entries are sets of the
+    errors a pair can be part of (Keiser and Lemire, "Validating UTF-8 in less than
+    one instruction per byte"). Blocks of ASCII are only checked for a sequence cut
+    off by the previous block.
+*/
+struct UTF8Lookup {
+    // Errors, as bits of the table entries.
+    enum {
+        kTooShort = 1 << 0,     // 11______ 0_______, or 11______ 11______
+        kTooLong = 1 << 1,      // 0_______ 10______
+        kOverlong3 = 1 << 2,    // 11100000 100_____
+        kTooLarge = 1 << 3,     // 11110100 1001____, 11110100 101_____ and above
+        kSurrogate = 1 << 4,    // 11101101 101_____
+        kOverlong2 = 1 << 5,    // 1100000_ 10______
+        kTooLarge1000 = 1 << 6, // 11110101 1000____ and above
+        kOverlong4 = 1 << 6,    // 11110000 1000____
+        kTwoConts = 1 << 7,     // 10______ 10______, unless a third or fourth byte
+        kCarry = kTooShort | kTooLong | kTwoConts
+    };
+
+    //! Table of the high nibble of the first byte.
+    static const unsigned char* Byte1High() {
+        static const unsigned char table[16] = {
+            kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+            kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+            kTooShort | kOverlong2,
+            kTooShort,
+            kTooShort | kOverlong3 | kSurrogate,
+            kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+        };
+        return table;
+    }
+
+    //! Table of the low nibble of the first byte.
+    static const unsigned char* Byte1Low() {
+        static const unsigned char table[16] = {
+            kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+            kCarry | kOverlong2,
+            kCarry,
+            kCarry,
+            kCarry | kTooLarge,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000
+        };
+        return table;
+    }
+
+    //! Table of the high nibble of the second byte.
+    static const unsigned char* Byte2High() {
+        static const unsigned char table[16] = {
+            kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+            kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+            kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+            kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+            kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+            kTooShort, kTooShort, kTooShort, kTooShort
+        };
+        return table;
+    }
+
+    //! Subtracted with saturation from the last bytes of a block, leaves non-zero where a sequence is cut off.
+    static const unsigned char* MaxValue() {
+        static const unsigned char table[32] = {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+        };
+        return table;
+    }
+
+    //! Resumes validation one code point at a time before a block with an error.
+    /*! Everything before \c block is valid, except maybe a sequence cut off by it,
+        so the result is the start of the code point which includes <tt>block[-3]</tt>,
+        or a later one.
+    */
+    static const char* Resume(const char* begin, const char* block) {
+        const char* p = block - begin > 3 ? block - 3 : begin;
+        while (p != block && (static_cast<unsigned char>(*p) & 0xC0) == 0x80)
+            p++;
+        return p;
+    }
+
+#ifdef RAPIDJSON_AVX2
+    static RAPIDJSON_FORCEINLINE __m256i Table(const unsigned char* table) {
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+    }
+
+    static RAPIDJSON_FORCEINLINE __m256i HighNibble(__m256i v) {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+    }
+
+    //! Errors of a non-ASCII block \c in, after the block \c prev.
+    static RAPIDJSON_FORCEINLINE __m256i CheckBlock(__m256i in, __m256i prev) {
+        // The bytes 1, 2 and 3 positions before each byte.
+        const __m256i carried = _mm256_permute2x128_si256(prev, in, 0x21);
+        const __m256i prev1 = _mm256_alignr_epi8(in, carried, 15);
+        const __m256i prev2 = _mm256_alignr_epi8(in, carried, 14);
+        const __m256i prev3 = _mm256_alignr_epi8(in, carried, 13);
+
+        const __m256i special = _mm256_and_si256(_mm256_and_si256(
+            _mm256_shuffle_epi8(Table(Byte1High()), HighNibble(prev1)),
+            _mm256_shuffle_epi8(Table(Byte1Low()), _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)))),
+            _mm256_shuffle_epi8(Table(Byte2High()), HighNibble(in)));
+
+        // Third and fourth bytes of a sequence must be continuations, which is where kTwoConts is expected.
+        const __m256i must23 = _mm256_or_si256(
+            _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+            _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+        return _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80))), special);
+    }
+
+    //! Validates whole blocks of 32 bytes, then the rest padded with zeros.
+    /*! \return \c end if valid, otherwise where to resume validation one code point at a time. */
+    static const char* Validate(const char* begin, const char* end) {
+        const __m256i maxValue = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(MaxValue()));
+        __m256i prev = _mm256_setzero_si256();
+        __m256i incomplete = _mm256_setzero_si256();
+        const char* p = begin;
+        for (;; p += 32) {
+            __m256i in;
+            const bool last = end - p < 32;
+            if (!last)
+                in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            else {
+                char buffer[32] = {};
+                std::memcpy(buffer, p, static_cast<size_t>(end - p));
+                in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer));
+            }
+
+            __m256i error;
+            if (_mm256_movemask_epi8(in) == 0) {
+                error = incomplete;
+                incomplete = _mm256_setzero_si256();
+            }
+            else {
+                error = CheckBlock(in, prev);
+                incomplete = _mm256_subs_epu8(in, maxValue);
+            }
+            if (RAPIDJSON_UNLIKELY(!_mm256_testz_si256(error, error)))
+                return Resume(begin, p);
+            if (last)
+                return end;
+            prev = in;
+        }
+    }
+#else
+    static RAPIDJSON_FORCEINLINE __m128i Table(const unsigned char* table) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+    }
+
+    static RAPIDJSON_FORCEINLINE __m128i HighNibble(__m128i v) {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+    }
+
+    //! Errors of a non-ASCII block \c in, after the block \c prev.
+    static RAPIDJSON_FORCEINLINE __m128i CheckBlock(__m128i in, __m128i prev) {
+        // The bytes 1, 2 and 3 positions before each byte.
+        const __m128i prev1 = _mm_alignr_epi8(in, prev, 15);
+        const __m128i prev2 = _mm_alignr_epi8(in, prev, 14);
+        const __m128i prev3 = _mm_alignr_epi8(in, prev, 13);
+
+        const __m128i special = _mm_and_si128(_mm_and_si128(
+            _mm_shuffle_epi8(Table(Byte1High()), HighNibble(prev1)),
+            _mm_shuffle_epi8(Table(Byte1Low()), _mm_and_si128(prev1, _mm_set1_epi8(0x0F)))),
+            _mm_shuffle_epi8(Table(Byte2High()), HighNibble(in)));
+
+        // Third and fourth bytes of a sequence must be continuations, which is where kTwoConts is expected.
+        const __m128i must23 = _mm_or_si128(
+            _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+            _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+        return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8(static_cast<char>(0x80))), special);
+    }
+
+    //! Validates whole blocks of 16 bytes, then the rest padded with zeros.
+    /*! \return \c end if valid, otherwise where to resume validation one code point at a time. */
+    static const char* Validate(const char* begin, const char* end) {
+        const __m128i maxValue = _mm_loadu_si128(reinterpret_cast<const __m128i *>(MaxValue() + 16));
+        __m128i prev = _mm_setzero_si128();
+        __m128i incomplete = _mm_setzero_si128();
+        const char* p = begin;
+        for (;; p += 16) {
+            __m128i in;
+            const bool last = end - p < 16;
+            if (!last)
+                in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            else {
+                char buffer[16] = {};
+                std::memcpy(buffer, p, static_cast<size_t>(end - p));
+                in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer));
+            }
+
+            __m128i error;
+            if (_mm_movemask_epi8(in) == 0) {
+                error = incomplete;
+                incomplete = _mm_setzero_si128();
+            }
+            else {
+                error = CheckBlock(in, prev);
+                incomplete = _mm_subs_epu8(in, maxValue);
+            }
+            if (RAPIDJSON_UNLIKELY(!_mm_testz_si128(error, error)))
+                return Resume(begin, p);
+            if (last)
+                return end;
+            prev = in;
+        }
+    }
+#endif
+};
+#endif // RAPIDJSON_SSE42
+
+//! Finds the first invalid UTF-8 sequence in a buffer.
+/*! With \c RAPIDJSON_SSE42 or \c RAPIDJSON_AVX2, the buffer is validated with
+    UTF8Lookup, and only the code points around the first error are decoded
+    one at a time to locate it. Otherwise ASCII is skipped eight bytes at a time.
+    \return Offset of the first invalid sequence, or \c length if the buffer is valid.
+*/
+inline size_t FindInvalidUTF8(const char* s, size_t length) {
+    const char* end = s + length;
+    const char* p = s;
+#ifdef RAPIDJSON_SSE42
+    p = UTF8Lookup::Validate(s, end);
+#endif
+    return static_cast<size_t>(FindInvalidUTF8Scalar(p, end) - s);
+}
+
+} // namespace internal
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_INTERNAL_UTF8_H_
@@ -0,0 +1,228 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_KEYSET_H_
+#define RAPIDJSON_KEYSET_H_
+
+/*! \file keyset.h */
+
+#include "document.h"
+#include "internal/stack.h"
+#include <cstring>
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericKeySet
+
+//! Fixed set of keys mapped to integer IDs with a perfect hash.
+/*!
+    Handlers which expect known member names can map the name of each
+    \c Key() event to the index of the name in a list, and switch on it:
+
+    \code
+    enum Field { kName, kAge, kFieldCount };
+    static const KeySet::StringRefType names[kFieldCount] = { "name", "age" };
+    static const KeySet keys(names);
+
+    bool Key(const char* str, SizeType length, bool) {
+        field_ = keys.Find(str, length);    // -1 if not found
+        return true;
+    }
+    \endcode
+
+    Build() searches a hash function and table size for which every key has
+    its own slot, so Find() hashes the key, reads one slot and compares one
+    string. The hash first only uses the length and three characters of each
+    key, which is enough for most key sets; otherwise all characters are hashed.
+    If no perfect hash is found, Find() compares the keys in order. So it does
+    for sets of one or two keys, where this is faster than hashing.
+
+    The keys are referenced, not copied, as \ref GenericStringRef.
+
+    \tparam CharType Character type of the keys.
+    \tparam Allocator Allocator for the keys and the hash table.
+*/
+template <typename CharType, typename Allocator = CrtAllocator>
+class GenericKeySet {
+public:
+    typedef CharType Ch;                                //!< Character type of the keys.
+    typedef GenericStringRef<CharType> StringRefType;   //!< Reference to a key.
+
+    //! Creates an empty set, for adding keys with Add().
+    explicit GenericKeySet(Allocator* allocator = 0) :
+        keys_(allocator, kDefaultCapacity * sizeof(Key)), slots_(allocator, kDefaultCapacity * 2 * sizeof(uint32_t)), seed_(), mask_(), mode_(kLinearMode) {}
+
+    //! Creates a set of the keys of an array, with their indices as IDs.
+    template <SizeType N>
+    explicit GenericKeySet(const StringRefType (&keys)[N], Allocator* allocator = 0) :
+        keys_(allocator, N * sizeof(Key)), slots_(allocator, N * 2 * sizeof(uint32_t)), seed_(), mask_(), mode_(kLinearMode)
+    {
+        for (SizeType i = 0; i < N; i++)
+            Add(keys[i]);
+        Build();
+    }
+
+    //! Creates a set of \c count keys, with their indices as IDs.
+    GenericKeySet(const StringRefType* keys, SizeType count, Allocator* allocator = 0) :
+        keys_(allocator, count * sizeof(Key)), slots_(allocator, count * 2 * sizeof(uint32_t)), seed_(), mask_(), mode_(kLinearMode)
+    {
+        for (SizeType i = 0; i < count; i++)
+            Add(keys[i]);
+        Build();
+    }
+
+    //! Adds a key, which must not be in the set yet.
+    /*! Find() compares the keys in order until Build() is called.
+        \return The ID of the key, which is the number of keys added before.
+    */
+    int Add(StringRefType key) {
+        RAPIDJSON_ASSERT(Find(key.s, key.length) < 0);
+        Key* k = keys_.template Push<Key>();
+        k->str = key.s;
+        k->length = key.length;
+        mode_ = kLinearMode;
+        return static_cast<int>(GetSize() - 1);
+    }
+
+    //! Builds the perfect hash of the keys added, if there are at least \c kMinHashSize.
+    void Build() {
+        const SizeType n = GetSize();
+        for (unsigned mode = kSampledMode; n >= kMinHashSize && mode <= kFullMode; mode++) {
+            SizeType size = 1;
+            while (size < n)
+                size *= 2;
+            for (; size <= kMaxLoad * (n ? n : 1); size *= 2)
+                for (uint32_t seed = 0; seed < kMaxSeed; seed++)
+                    if (TryBuild(static_cast<Mode>(mode), size, seed))
+                        return;
+        }
+        slots_.Clear();
+        mode_ = kLinearMode;
+    }
+
+    //! Get the ID of a key.
+    /*! \param str Key, not necessarily null-terminated.
+        \param length Length of the key.
+        \return The ID of the key, or -1 if the key is not in the set.
+    */
+    int Find(const Ch* str, SizeType length) const {
+        const Key* keys = keys_.template Bottom<Key>();
+        if (RAPIDJSON_LIKELY(mode_ != kLinearMode)) {
+            const uint32_t slot = slots_.template Bottom<uint32_t>()[Hash(mode_, str, length, seed_) & mask_];
+            if (slot != 0 && Equal(keys[slot - 1], str, length))
+                return static_cast<int>(slot - 1);
+            return -1;
+        }
+        for (SizeType i = 0; i < GetSize(); i++)
+            if (Equal(keys[i], str, length))
+                return static_cast<int>(i);
+        return -1;
+    }
+
+    //! Get the ID of a null-terminated key.
+    int Find(const Ch* str) const { return Find(str, internal::StrLen(str)); }
+
+    //! Get the ID of a key given as a GenericValue string.
+    template <typename Encoding, typename SourceAllocator>
+    int Find(const GenericValue<Encoding, SourceAllocator>& key) const {
+        RAPIDJSON_ASSERT(key.IsString());
+        return Find(key.GetString(), key.GetStringLength());
+    }
+
+    //! Number of keys.
+    SizeType GetSize() const { return static_cast<SizeType>(keys_.GetSize() / sizeof(Key)); }
+
+    //! Get the key of an ID.
+    StringRefType GetKey(int id) const {
+        RAPIDJSON_ASSERT(id >= 0 && static_cast<SizeType>(id) < GetSize());
+        const Key& k = keys_.template Bottom<Key>()[id];
+        return StringRefType(k.str, k.length);
+    }
+
+    //! Whether Find() uses a perfect hash, found by Build().
+    bool HasPerfectHash() const { return mode_ != kLinearMode; }
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericKeySet(const GenericKeySet&);
+    GenericKeySet& operator=(const GenericKeySet&);
+
+    struct Key {
+        const Ch* str;
+        SizeType length;
+    };
+
+    enum Mode {
+        kSampledMode,   //!< The hash of the length and three characters.
+        kFullMode,      //!< The hash of all characters.
+        kLinearMode     //!< No hash table.
+    };
+
+    static const SizeType kDefaultCapacity = 16;
+    static const SizeType kMinHashSize = 3;    //!< Fewer keys are compared in order, which is faster.
+    static const SizeType kMaxLoad = 64;    //!< Largest table size tried, per key.
+    static const uint32_t kMaxSeed = 64;    //!< Number of seeds tried per table size.
+
+    static RAPIDJSON_FORCEINLINE uint32_t Mix(uint32_t h, Ch c) {
+        return (h ^ static_cast<uint32_t>(c)) * 16777619u;   // FNV-1a
+    }
+
+    static RAPIDJSON_FORCEINLINE uint32_t Hash(Mode mode, const Ch* str, SizeType length, uint32_t seed) {
+        uint32_t h = (2166136261u ^ seed ^ length) * 16777619u;
+        if (mode == kSampledMode) {
+            if (length != 0)
+                h = Mix(Mix(Mix(h, str[0]), str[length / 2]), str[length - 1]);
+        }
+        else
+            for (SizeType i = 0; i < length; i++)
+                h = Mix(h, str[i]);
+        return h ^ (h >> 15);
+    }
+
+    static RAPIDJSON_FORCEINLINE bool Equal(const Key& key, const Ch* str, SizeType length) {
+        return key.length == length && std::memcmp(key.str, str, length * sizeof(Ch)) == 0;
+    }
+
+    //! Fills a table of the size, if the hash with the seed gives each key its own slot.
+    bool TryBuild(Mode mode, SizeType size, uint32_t seed) {
+        slots_.Clear();
+        uint32_t* slots = slots_.template Push<uint32_t>(size);
+        std::memset(slots, 0, size * sizeof(uint32_t));
+        const Key* keys = keys_.template Bottom<Key>();
+        for (SizeType i = 0; i < GetSize(); i++) {
+            uint32_t& slot = slots[Hash(mode, keys[i].str, keys[i].length, seed) & (size - 1)];
+            if (slot != 0)
+                return false;
+            slot = i + 1;
+        }
+        mode_ = mode;
+        seed_ = seed;
+        mask_ = size - 1;
+        return true;
+    }
+
+    internal::Stack<Allocator> keys_;   //!< Key of each ID.
+    internal::Stack<Allocator> slots_;  //!< ID plus one for each hash value, or zero.
+    uint32_t seed_;
+    uint32_t mask_;
+    Mode mode_;
+};
+
+//! GenericKeySet of \c char keys.
+typedef GenericKeySet<char> KeySet;
+
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_KEYSET_H_
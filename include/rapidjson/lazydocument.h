@@ -0,0 +1,732 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_LAZYDOCUMENT_H_
+#define RAPIDJSON_LAZYDOCUMENT_H_
+
+/*! \file lazydocument.h */
+
+#include "document.h"
+#include "internal/structuralindex.h"
+#include <new>      // placement new
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+template <typename Encoding, typename Allocator>
+class GenericLazyDocument;
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericLazyValue
+
+//! Value of a GenericLazyDocument, parsed when it is first accessed.
+/*!
+    A value starts as the position of its first token in the structural index
+    of the document. An object or array finds the positions of its members or
+    elements the first time they are accessed through Size(), operator[](),
+    FindMember() or iteration, which only visits the tokens of its own level.
+    A number, string or literal is parsed into a GenericValue by GenericReader
+    when its type or content is first queried.
+
+    FindMember() compares names without escapes to the raw text, so looking up
+    a member does not parse the names of the others.
+
+    The read API is the same as GenericValue, including Accept(). Values are
+    owned by their document and referenced, not copied.
+
+    \note Accessing a value modifies its document, even through a const
+        reference, so a document must not be read from several threads.
+    \tparam Encoding Encoding of the text and of the strings, with 8-bit code units.
+    \tparam Allocator Allocator of the document, for the members, elements and strings.
+*/
+template <typename Encoding, typename Allocator = MemoryPoolAllocator<> >
+class GenericLazyValue {
+public:
+    typedef typename Encoding::Ch Ch;                   //!< Character type derived from Encoding.
+    typedef GenericLazyValue ValueType;                 //!< Value type of itself.
+    typedef GenericValue<Encoding, Allocator> ScalarType;   //!< Type of parsed numbers, strings and literals.
+
+    //! Name-value pair of an object.
+    struct Member {
+        GenericLazyValue name;      //!< name of member (must be a string)
+        GenericLazyValue value;     //!< value of member.
+    };
+
+    typedef const GenericLazyValue* ConstValueIterator;     //!< Constant element iterator for arrays.
+    typedef const Member* ConstMemberIterator;              //!< Constant member iterator for objects.
+
+    //! Destructor.
+    ~GenericLazyValue() {
+        if (Allocator::kNeedFree)
+            Release();
+    }
+
+    //!@name Type
+    //!@{
+
+    Type GetType() const {
+        switch (kind_) {
+        case kObjectKind:   return kObjectType;
+        case kArrayKind:    return kArrayType;
+        default:            return Scalar().GetType();
+        }
+    }
+    bool IsNull()   const { return kind_ == kScalarKind && Scalar().IsNull(); }
+    bool IsFalse()  const { return kind_ == kScalarKind && Scalar().IsFalse(); }
+    bool IsTrue()   const { return kind_ == kScalarKind && Scalar().IsTrue(); }
+    bool IsBool()   const { return kind_ == kScalarKind && Scalar().IsBool(); }
+    bool IsObject() const { return kind_ == kObjectKind; }
+    bool IsArray()  const { return kind_ == kArrayKind; }
+    bool IsNumber() const { return kind_ == kScalarKind && Scalar().IsNumber(); }
+    bool IsInt()    const { return kind_ == kScalarKind && Scalar().IsInt(); }
+    bool IsUint()   const { return kind_ == kScalarKind && Scalar().IsUint(); }
+    bool IsInt64()  const { return kind_ == kScalarKind && Scalar().IsInt64(); }
+    bool IsUint64() const { return kind_ == kScalarKind && Scalar().IsUint64(); }
+    bool IsDouble() const { return kind_ == kScalarKind && Scalar().IsDouble(); }
+    bool IsString() const { return kind_ == kScalarKind && Scalar().IsString(); }
+
+    //!@}
+
+    //!@name Bool, number and string
+    //!@{
+
+    bool GetBool() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetBool(); }
+    int GetInt() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetInt(); }
+    unsigned GetUint() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetUint(); }
+    int64_t GetInt64() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetInt64(); }
+    uint64_t GetUint64() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetUint64(); }
+    double GetDouble() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetDouble(); }
+    const Ch* GetString() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetString(); }
+
+    //! Get the length of string, excluding the terminator.
+    SizeType GetStringLength() const { RAPIDJSON_ASSERT(kind_ == kScalarKind); return Scalar().GetStringLength(); }
+
+    //!@}
+
+    //!@name Array
+    //!@{
+
+    //! Get the number of elements in array.
+    SizeType Size() const { RAPIDJSON_ASSERT(IsArray()); return Count(); }
+
+    //! Check whether the array is empty.
+    bool Empty() const { RAPIDJSON_ASSERT(IsArray()); return Count() == 0; }
+
+    //! Get an element from array by index.
+    /*! \param index Zero-based index of element.
+        \note The value is only parsed when it is accessed in turn.
+    */
+    const GenericLazyValue& operator[](SizeType index) const {
+        RAPIDJSON_ASSERT(index < Size());
+        return Elements()[index];
+    }
+
+    ConstValueIterator Begin() const { RAPIDJSON_ASSERT(IsArray()); return Elements(); }
+    ConstValueIterator End() const { RAPIDJSON_ASSERT(IsArray()); return Elements() + Count(); }
+    //!@}
+
+    //!@name Object
+    //!@{
+
+    //! Get the number of members in the object.
+    SizeType MemberCount() const { RAPIDJSON_ASSERT(IsObject()); return Count(); }
+
+    //! Check whether the object is empty.
+    bool ObjectEmpty() const { RAPIDJSON_ASSERT(IsObject()); return Count() == 0; }
+
+    ConstMemberIterator MemberBegin() const { RAPIDJSON_ASSERT(IsObject()); return Members(); }
+    ConstMemberIterator MemberEnd() const { RAPIDJSON_ASSERT(IsObject()); return Members() + Count(); }
+
+    //! Find member by name.
+    /*! \return Iterator to member, if it exists, otherwise MemberEnd().
+        \note Members are compared in the order of the text.
+    */
+    ConstMemberIterator FindMember(const Ch* name) const {
+        return FindMember(name, internal::StrLen(name));
+    }
+
+    //! Find member by name, with the length of the name.
+    ConstMemberIterator FindMember(const Ch* name, SizeType length) const {
+        RAPIDJSON_ASSERT(IsObject());
+        RAPIDJSON_ASSERT(name != 0);
+        const ConstMemberIterator end = MemberEnd();
+        for (ConstMemberIterator m = MemberBegin(); m != end; ++m)
+            if (m->name.NameEquals(name, length))
+                return m;
+        return end;
+    }
+
+    //! Find member by name given as a GenericValue string.
+    template <typename SourceAllocator>
+    ConstMemberIterator FindMember(const GenericValue<Encoding, SourceAllocator>& name) const {
+        RAPIDJSON_ASSERT(name.IsString());
+        return FindMember(name.GetString(), name.GetStringLength());
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    //! Find member by string object name (with \c std::basic_string).
+    ConstMemberIterator FindMember(const std::basic_string<Ch>& name) const {
+        return FindMember(name.data(), static_cast<SizeType>(name.size()));
+    }
+#endif
+
+    bool HasMember(const Ch* name) const { return FindMember(name) != MemberEnd(); }
+
+#if RAPIDJSON_HAS_STDSTRING
+    bool HasMember(const std::basic_string<Ch>& name) const { return FindMember(name) != MemberEnd(); }
+#endif
+
+    //! Get a value from an object by name, or a null value if there is no such member.
+    /*! \tparam T Either \c Ch or \c const \c Ch (template used for disambiguation with \ref operator[](SizeType))
+    */
+    template <typename T>
+    RAPIDJSON_DISABLEIF_RETURN((internal::NotExpr<internal::IsSame<typename internal::RemoveConst<T>::Type, Ch> >),(const GenericLazyValue&)) operator[](T* name) const {
+        const ConstMemberIterator member = FindMember(name);
+        if (member != MemberEnd())
+            return member->value;
+        RAPIDJSON_ASSERT(false);    // see GenericValue::operator[]
+        static const GenericLazyValue nullValue;
+        return nullValue;
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    const GenericLazyValue& operator[](const std::basic_string<Ch>& name) const { return (*this)[name.c_str()]; }
+#endif
+    //!@}
+
+    //! Generate events of this value to a Handler.
+    /*! This function adopts the GoF visitor pattern, as GenericValue::Accept().
+        The whole value is parsed and kept in the document.
+        \tparam Handler type of handler.
+        \param handler An object implementing concept Handler.
+        \return \c false if the handler stopped or a part of the value is invalid.
+    */
+    template <typename Handler>
+    bool Accept(Handler& handler) const {
+        switch (kind_) {
+        case kObjectKind: {
+            const ConstMemberIterator end = MemberEnd();    // parses this level first
+            if (RAPIDJSON_UNLIKELY(state_ == kFailedState || !handler.StartObject()))
+                return false;
+            for (ConstMemberIterator m = MemberBegin(); m != end; ++m) {
+                const ScalarType& name = m->name.Scalar();
+                if (RAPIDJSON_UNLIKELY(m->name.state_ == kFailedState || !handler.Key(name.GetString(), name.GetStringLength(), false)))
+                    return false;
+                if (RAPIDJSON_UNLIKELY(!m->value.Accept(handler)))
+                    return false;
+            }
+            return handler.EndObject(count_);
+        }
+
+        case kArrayKind: {
+            const ConstValueIterator end = End();
+            if (RAPIDJSON_UNLIKELY(state_ == kFailedState || !handler.StartArray()))
+                return false;
+            for (ConstValueIterator v = Begin(); v != end; ++v)
+                if (RAPIDJSON_UNLIKELY(!v->Accept(handler)))
+                    return false;
+            return handler.EndArray(count_);
+        }
+
+        default: {
+            const ScalarType& scalar = Scalar();
+            return state_ != kFailedState && scalar.Accept(handler);
+        }
+        }
+    }
+
+protected:
+    template <typename, typename> friend class GenericLazyDocument;
+
+    typedef GenericReader<Encoding, Encoding, CrtAllocator> ReaderType;
+
+    // Builds the GenericValue of a scalar from the events of the reader.
+    struct ScalarHandler : BaseReaderHandler<Encoding, ScalarHandler> {
+        ScalarHandler(ScalarType& value, Allocator& allocator) : value_(value), allocator_(allocator) {}
+
+        bool Null() { value_.SetNull(); return true; }
+        bool Bool(bool b) { value_.SetBool(b); return true; }
+        bool Int(int i) { value_.SetInt(i); return true; }
+        bool Uint(unsigned u) { value_.SetUint(u); return true; }
+        bool Int64(int64_t i) { value_.SetInt64(i); return true; }
+        bool Uint64(uint64_t u) { value_.SetUint64(u); return true; }
+        bool Double(double d) { value_.SetDouble(d); return true; }
+        bool RawNumber(const Ch* str, SizeType length, bool copy) { return String(str, length, copy); }
+        bool String(const Ch* str, SizeType length, bool) { value_.SetString(str, length, allocator_); return true; }
+
+    private:
+        ScalarHandler(const ScalarHandler&);
+        ScalarHandler& operator=(const ScalarHandler&);
+
+        ScalarType& value_;
+        Allocator& allocator_;
+    };
+
+    typedef ParseResult (*ScalarParser)(ReaderType& reader, const Ch* str, ScalarHandler& handler, const Ch** end);
+
+    //! State shared by the values of a document.
+    struct Context {
+        const Ch* json;             //!< Parsed text.
+        const uint32_t* index;      //!< Offsets of the tokens, followed by the length of the text.
+        const uint32_t* match;      //!< Token of the end of the object or array starting at each token.
+        Allocator* allocator;
+        ReaderType* reader;
+        ScalarParser parseScalar;   //!< ParseScalarText() with the flags of the document.
+        bool trailingCommas;        //!< kParseTrailingCommasFlag
+        ParseResult parseResult;    //!< First error, found by parsing or later.
+    };
+
+    //! Kind of value, known from its first token.
+    enum Kind {
+        kScalarKind,
+        kObjectKind,
+        kArrayKind
+    };
+
+    //! What may follow a value, for the error of an unexpected character after it.
+    enum Parent {
+        kRootParent,
+        kObjectParent,
+        kArrayParent,
+        kNameParent
+    };
+
+    enum State {
+        kLazyState,     //!< Not parsed yet.
+        kParsedState,
+        kFailedState    //!< Invalid, parsed as null, or empty.
+    };
+
+    // Flags ignored when a scalar is parsed alone.
+    static const unsigned kScalarIgnoredFlags = kParseIterativeFlag | kParseSkipValueFlag | kParseStructuralIndexFlag;
+
+    //! Null value, as the root of a document before parsing or after an error.
+    GenericLazyValue() : ctx_(), children_(), value_(), token_(), count_(), kind_(kScalarKind), parent_(kRootParent), state_(kParsedState) {}
+
+    GenericLazyValue(Context* ctx, uint32_t token, Parent parent) :
+        ctx_(ctx), children_(), value_(), token_(token), count_(), kind_(KindOf(ctx->json[ctx->index[token]])), parent_(parent), state_(kLazyState) {}
+
+    //! Parse a scalar at str, which ends at *end.
+    template <unsigned parseFlags>
+    static ParseResult ParseScalarText(ReaderType& reader, const Ch* str, ScalarHandler& handler, const Ch** end) {
+        GenericStringStream<Encoding> s(str);
+        const ParseResult result = reader.template Parse<(parseFlags & ~kScalarIgnoredFlags) | kParseStopWhenDoneFlag>(s, handler);
+        *end = s.src_;
+        return result;
+    }
+
+    static Kind KindOf(Ch c) {
+        return c == '{' ? kObjectKind : c == '[' ? kArrayKind : kScalarKind;
+    }
+
+    static bool IsWhitespace(Ch c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+    //! Frees the members or elements, and the string.
+    void Release() {
+        if (children_) {
+            if (kind_ == kObjectKind) {
+                Member* m = static_cast<Member*>(children_);
+                for (SizeType i = 0; i < count_; i++) {
+                    m[i].name.~GenericLazyValue();
+                    m[i].value.~GenericLazyValue();
+                }
+            }
+            else {
+                GenericLazyValue* e = static_cast<GenericLazyValue*>(children_);
+                for (SizeType i = 0; i < count_; i++)
+                    e[i].~GenericLazyValue();
+            }
+            Allocator::Free(children_);
+        }
+        children_ = 0;
+        count_ = 0;
+        value_.SetNull();
+    }
+
+    //! Turns the value back into the null value of the default constructor.
+    void Reset() {
+        Release();
+        ctx_ = 0;
+        token_ = 0;
+        kind_ = kScalarKind;
+        parent_ = kRootParent;
+        state_ = kParsedState;
+    }
+
+    //! Makes the value the root of a parsed document.
+    void Reset(Context* ctx) {
+        Reset();
+        ctx_ = ctx;
+        kind_ = KindOf(ctx->json[ctx->index[0]]);
+        state_ = kLazyState;
+    }
+
+    //! Marks the value invalid and records the error in the document, if it is the first one.
+    void Fail(ParseErrorCode code, size_t offset) const {
+        state_ = kFailedState;
+        if (!ctx_->parseResult.IsError())
+            ctx_->parseResult.Set(code, offset);
+    }
+
+    const ScalarType& Scalar() const {
+        RAPIDJSON_ASSERT(kind_ == kScalarKind);
+        if (state_ == kLazyState)
+            ParseScalar();
+        return value_;
+    }
+
+    void ParseScalar() const {
+        state_ = kParsedState;
+        const Ch* json = ctx_->json;
+        const Ch* str = json + ctx_->index[token_];
+        const Ch* end;
+        ScalarHandler handler(value_, *ctx_->allocator);
+        const ParseResult result = ctx_->parseScalar(*ctx_->reader, str, handler, &end);
+        if (RAPIDJSON_UNLIKELY(!result))
+            Fail(result.Code(), static_cast<size_t>(str - json) + result.Offset());
+        else if (RAPIDJSON_UNLIKELY(end != json + ctx_->index[token_ + 1] && !IsWhitespace(*end))) {
+            // A character directly after a token is not indexed.
+            static const ParseErrorCode codes[] = {
+                kParseErrorDocumentRootNotSingular,
+                kParseErrorObjectMissCommaOrCurlyBracket,
+                kParseErrorArrayMissCommaOrSquareBracket,
+                kParseErrorObjectMissColon
+            };
+            value_.SetNull();
+            Fail(codes[parent_], static_cast<size_t>(end - json));
+        }
+    }
+
+    //! Whether the value is a string equal to name.
+    bool NameEquals(const Ch* name, SizeType length) const {
+        if (state_ == kLazyState) {
+            // Compare the raw text until an escape is found.
+            const Ch* s = ctx_->json + ctx_->index[token_] + 1;
+            for (SizeType i = 0; i < length; i++, s++) {
+                if (*s == '\\')
+                    break;
+                if (*s != name[i] || *s == '"')
+                    return false;
+            }
+            if (*s != '\\')
+                return *s == '"';
+        }
+        const ScalarType& s = Scalar();
+        return state_ != kFailedState && s.GetStringLength() == length && std::memcmp(s.GetString(), name, length * sizeof(Ch)) == 0;
+    }
+
+    SizeType Count() const {
+        if (state_ == kLazyState)
+            ParseContainer();
+        return count_;
+    }
+
+    const GenericLazyValue* Elements() const {
+        RAPIDJSON_ASSERT(kind_ == kArrayKind);
+        if (state_ == kLazyState)
+            ParseContainer();
+        return static_cast<const GenericLazyValue*>(children_);
+    }
+
+    const Member* Members() const {
+        RAPIDJSON_ASSERT(kind_ == kObjectKind);
+        if (state_ == kLazyState)
+            ParseContainer();
+        return static_cast<const Member*>(children_);
+    }
+
+    //! Finds the members or elements of an object or array, skipping over nested ones.
+    void ParseContainer() const {
+        const Ch* json = ctx_->json;
+        const uint32_t* index = ctx_->index;
+        const uint32_t* match = ctx_->match;
+        const bool isObject = kind_ == kObjectKind;
+        const uint32_t end = match[token_];
+        state_ = kParsedState;
+
+        // Check the separators and count the values, as the brackets are known to match.
+        SizeType n = 0;
+        for (uint32_t t = token_ + 1; t != end; ) {
+            if (isObject) {
+                if (RAPIDJSON_UNLIKELY(json[index[t]] != '"'))
+                    return Fail(kParseErrorObjectMissName, index[t]);
+                if (RAPIDJSON_UNLIKELY(json[index[++t]] != ':'))
+                    return Fail(kParseErrorObjectMissColon, index[t]);
+                ++t;
+            }
+            const Ch c = json[index[t]];
+            if (RAPIDJSON_UNLIKELY(c == ',' || c == ':' || c == '}' || c == ']'))
+                return Fail(kParseErrorValueInvalid, index[t]);
+            t = (c == '{' || c == '[') ? match[t] + 1 : t + 1;
+            n++;
+            if (t == end)
+                break;
+            if (RAPIDJSON_UNLIKELY(json[index[t]] != ','))
+                return Fail(isObject ? kParseErrorObjectMissCommaOrCurlyBracket : kParseErrorArrayMissCommaOrSquareBracket, index[t]);
+            if (++t == end && !ctx_->trailingCommas)
+                return Fail(isObject ? kParseErrorObjectMissName : kParseErrorValueInvalid, index[t]);
+        }
+        if (n == 0)
+            return;
+
+        // Create the values, which are only positions for now.
+        children_ = ctx_->allocator->Malloc(n * (isObject ? sizeof(Member) : sizeof(GenericLazyValue)));
+        uint32_t t = token_ + 1;
+        for (SizeType i = 0; i < n; i++) {
+            GenericLazyValue* v;
+            if (isObject) {
+                Member* m = static_cast<Member*>(children_) + i;
+                new (&m->name) GenericLazyValue(ctx_, t, kNameParent);
+                v = &m->value;
+                t += 2;
+            }
+            else
+                v = static_cast<GenericLazyValue*>(children_) + i;
+            new (v) GenericLazyValue(ctx_, t, isObject ? kObjectParent : kArrayParent);
+            t = (v->kind_ != kScalarKind ? match[t] : t) + 2;
+        }
+        count_ = n;
+    }
+
+    Context* ctx_;
+    mutable void* children_;    //!< Members or elements.
+    mutable ScalarType value_;  //!< Parsed number, string or literal.
+    uint32_t token_;            //!< First token in the index.
+    mutable SizeType count_;    //!< Number of members or elements.
+    unsigned char kind_;
+    unsigned char parent_;
+    mutable unsigned char state_;
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericLazyValue(const GenericLazyValue&);
+    GenericLazyValue& operator=(const GenericLazyValue&);
+};
+
+//! GenericLazyValue with UTF8 encoding
+typedef GenericLazyValue<UTF8<> > LazyValue;
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericLazyDocument
+
+//! A read-only document which parses its values when they are accessed.
+/*!
+    Parsing only builds the structural index of the text (see
+    \ref kParseStructuralIndexFlag) and matches the brackets of objects and
+    arrays. Values are parsed from the text when they are accessed, see
+    GenericLazyValue, so reading a few members of a large text costs little
+    more than indexing it.
+
+    \code
+    LazyDocument d;
+    d.Parse(json);
+    if (!d.HasParseError() && d.IsObject() && d.HasMember("id"))
+        printf("%d\n", d["id"].GetInt());
+    \endcode
+
+    The text must stay unchanged as long as the document is used. Parse()
+    checks the structure as far as the brackets go; the rest of the syntax is
+    checked when the values are accessed. An invalid value then reads as null,
+    or as an empty object or array, and the error is kept as the parse error of
+    the document, if it is the first one. Accept() on the root finds all errors.
+
+    Comments (\ref kParseCommentsFlag) and \ref kParseInsituFlag are not supported.
+
+    \tparam Encoding Encoding of the text and of the strings, with 8-bit code units.
+    \tparam Allocator Allocator for the members, elements and strings.
+*/
+template <typename Encoding, typename Allocator = MemoryPoolAllocator<> >
+class GenericLazyDocument : public GenericLazyValue<Encoding, Allocator> {
+public:
+    typedef typename Encoding::Ch Ch;                       //!< Character type derived from Encoding.
+    typedef GenericLazyValue<Encoding, Allocator> ValueType; //!< Value type of the document.
+    typedef Allocator AllocatorType;                        //!< Allocator type from template parameter.
+
+    //! Constructor
+    /*! Creates an empty document which type is Null.
+        \param allocator    Optional allocator for the values. If it is null, the document creates its own.
+    */
+    explicit GenericLazyDocument(Allocator* allocator = 0) :
+        allocator_(allocator), ownAllocator_(0), index_(0, kDefaultIndexCapacity), match_(0, kDefaultIndexCapacity), stack_(0, kDefaultStackCapacity), reader_(), context_()
+    {
+        if (!allocator_)
+            ownAllocator_ = allocator_ = RAPIDJSON_NEW(Allocator)();
+    }
+
+    //! Destructor.
+    ~GenericLazyDocument() {
+        ValueType::Release();
+        RAPIDJSON_DELETE(ownAllocator_);
+    }
+
+    //!@name Parse from read-only string
+    //!@{
+
+    //! Parse JSON text from a read-only string.
+    /*! \tparam parseFlags Combination of \ref ParseFlag, without \ref kParseInsituFlag
+            and \ref kParseCommentsFlag.
+        \param str Zero-terminated string to be parsed, shorter than 4GiB. It must
+            outlive the document, or the next parsing.
+    */
+    template <unsigned parseFlags>
+    GenericLazyDocument& Parse(const Ch* str) {
+        RAPIDJSON_STATIC_ASSERT(sizeof(Ch) == 1);
+        RAPIDJSON_STATIC_ASSERT(!(parseFlags & (kParseInsituFlag | kParseCommentsFlag)));
+        RAPIDJSON_ASSERT(str != 0);
+
+        ValueType::Reset();
+        index_.Clear();
+        match_.Clear();
+        context_.parseResult.Clear();
+
+        const size_t length = internal::StrLen(str);
+        RAPIDJSON_ASSERT(length < 0xFFFFFFFFu);
+        const bool unclosedString = internal::StructuralIndexer::Build(reinterpret_cast<const char*>(str), length, index_);
+        const uint32_t* index = index_.template Bottom<uint32_t>();
+        uint32_t* match = match_.template Push<uint32_t>(index_.GetSize() / sizeof(uint32_t));
+        if (MatchBrackets(str, index, match, unclosedString)) {
+            context_.json = str;
+            context_.index = index;
+            context_.match = match;
+            context_.allocator = allocator_;
+            context_.reader = &reader_;
+            context_.parseScalar = &ValueType::template ParseScalarText<parseFlags>;
+            context_.trailingCommas = (parseFlags & kParseTrailingCommasFlag) != 0;
+            ValueType::Reset(&context_);
+        }
+        return *this;
+    }
+
+    //! Parse JSON text from a read-only string (with \ref kParseDefaultFlags)
+    GenericLazyDocument& Parse(const Ch* str) {
+        return Parse<kParseDefaultFlags>(str);
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    //! Parse JSON text from a string, which must outlive the document.
+    template <unsigned parseFlags>
+    GenericLazyDocument& Parse(const std::basic_string<Ch>& str) {
+        return Parse<parseFlags>(str.c_str());
+    }
+
+    GenericLazyDocument& Parse(const std::basic_string<Ch>& str) {
+        return Parse<kParseDefaultFlags>(str);
+    }
+#endif // RAPIDJSON_HAS_STDSTRING
+    //!@}
+
+    //!@name Handling parse errors
+    //!@{
+
+    //! Whether a parse error has occured in the last parsing, or in the values accessed since.
+    bool HasParseError() const { return context_.parseResult.IsError(); }
+
+    //! Get the \ref ParseErrorCode of the first parse error.
+    ParseErrorCode GetParseError() const { return context_.parseResult.Code(); }
+
+    //! Get the position of the first parse error in input, 0 otherwise.
+    size_t GetErrorOffset() const { return context_.parseResult.Offset(); }
+
+    //! Implicit conversion to get the parse result
+    operator ParseResult() const { return context_.parseResult; }
+    //!@}
+
+    //! Get the allocator of this document.
+    Allocator& GetAllocator() {
+        RAPIDJSON_ASSERT(allocator_);
+        return *allocator_;
+    }
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericLazyDocument(const GenericLazyDocument&);
+    GenericLazyDocument& operator=(const GenericLazyDocument&);
+
+    //! Error of an object or array which ends at a bracket of the wrong kind, or at the end of the text.
+    static ParseErrorCode ContainerError(bool isObject, Ch previous) {
+        if (previous == '{' || previous == '[' || previous == ',')
+            return isObject ? kParseErrorObjectMissName : kParseErrorValueInvalid;
+        if (previous == ':')
+            return kParseErrorValueInvalid;
+        return isObject ? kParseErrorObjectMissCommaOrCurlyBracket : kParseErrorArrayMissCommaOrSquareBracket;
+    }
+
+    //! Sets match[t] for the tokens which start an object or array, and checks that the root is singular.
+    bool MatchBrackets(const Ch* json, const uint32_t* index, uint32_t* match, bool unclosedString) {
+        if (RAPIDJSON_UNLIKELY(json[index[0]] == '\0'))
+            return Fail(kParseErrorDocumentEmpty, index[0]);
+
+        uint32_t t = 0;
+        switch (json[index[0]]) {
+        case ',': case ':': case '}': case ']':
+            return Fail(kParseErrorValueInvalid, index[0]);
+        case '{': case '[':
+            *stack_.template Push<uint32_t>() = 0;
+            while (!stack_.Empty()) {
+                const Ch c = json[index[++t]];
+                if (c == '{' || c == '[')
+                    *stack_.template Push<uint32_t>() = t;
+                else if (c == '}' || c == ']' || c == '\0') {
+                    const uint32_t open = *stack_.template Pop<uint32_t>(1);
+                    const bool isObject = json[index[open]] == '{';
+                    if (RAPIDJSON_UNLIKELY(c == '\0' && unclosedString))
+                        return Fail(kParseErrorStringMissQuotationMark, index[t]);
+                    if (RAPIDJSON_UNLIKELY(c != (isObject ? '}' : ']')))
+                        return Fail(ContainerError(isObject, json[index[t - 1]]), index[t]);
+                    match[open] = t;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (RAPIDJSON_UNLIKELY(json[index[++t]] != '\0'))
+            return Fail(kParseErrorDocumentRootNotSingular, index[t]);
+        if (RAPIDJSON_UNLIKELY(unclosedString))
+            return Fail(kParseErrorStringMissQuotationMark, index[t]);
+        return true;
+    }
+
+    bool Fail(ParseErrorCode code, size_t offset) {
+        stack_.Clear();
+        context_.parseResult.Set(code, offset);
+        return false;
+    }
+
+    static const size_t kDefaultIndexCapacity = 1024;
+    static const size_t kDefaultStackCapacity = 256;
+    Allocator* allocator_;
+    Allocator* ownAllocator_;
+    internal::Stack<CrtAllocator> index_;   //!< Offsets of the tokens.
+    internal::Stack<CrtAllocator> match_;   //!< Token of the end of each object or array.
+    internal::Stack<CrtAllocator> stack_;   //!< Open objects and arrays while matching.
+    typename ValueType::ReaderType reader_; //!< Reader for scalars, which keeps its stack.
+    typename ValueType::Context context_;
+};
+
+//! GenericLazyDocument with UTF8 encoding
+typedef GenericLazyDocument<UTF8<> > LazyDocument;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_LAZYDOCUMENT_H_
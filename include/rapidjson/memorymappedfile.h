@@ -0,0 +1,241 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_MEMORYMAPPEDFILE_H_
+#define RAPIDJSON_MEMORYMAPPEDFILE_H_
+
+#include "stream.h"
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#ifdef __clang__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(padded)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+//! Read-only or copy-on-write memory mapping of a whole file.
+/*!
+    The file content is exposed as one contiguous null-terminated buffer, so it
+    can be parsed through StringStream or InsituStringStream and take all their
+    fast paths (SIMD whitespace skipping and string scanning, structural index
+    parsing), which do not apply to FileReadStream.
+
+    With \c kCopyOnWrite, pages are copied privately when written, so the
+    buffer can be parsed in situ while the file on disk is left unchanged.
+
+    \code
+    MemoryMappedFile file("data.json");
+    Document d;
+    if (file.IsOpen())
+        d.Parse(file.GetString());
+
+    MemoryMappedFile cow("data.json", MemoryMappedFile::kCopyOnWrite);
+    d.ParseInsitu(cow.GetInsituString());       // the file is not modified
+    \endcode
+
+    \note The mapping is invalid if the file is truncated by another process meanwhile.
+*/
+class MemoryMappedFile {
+public:
+    //! Access to the mapped content.
+    enum Mode {
+        kReadOnly,      //!< Read-only mapping, for GetString() and GetStream().
+        kCopyOnWrite    //!< Writable private mapping, which also allows GetInsituString() and GetInsituStream().
+    };
+
+    //! Constructor.
+    /*!
+        \param filename Path of the file to map.
+        \param mode Access to the mapped content.
+        \note Check IsOpen() for failure.
+    */
+    explicit MemoryMappedFile(const char* filename, Mode mode = kReadOnly) : data_(empty_), size_(0), mapping_(0), mappingSize_(0), mode_(mode), open_(false), empty_() {
+        Open(filename);
+    }
+
+    //! Destructor, unmaps the file.
+    ~MemoryMappedFile() {
+        if (!mapping_)
+            return;
+#ifdef _WIN32
+        if (mappingSize_ == 0)
+            UnmapViewOfFile(mapping_);
+        else
+            std::free(mapping_);
+#else
+        munmap(mapping_, mappingSize_);
+#endif
+    }
+
+    //! Whether the file was opened and mapped successfully.
+    bool IsOpen() const { return open_; }
+
+    //! Access mode of the mapping.
+    Mode GetMode() const { return mode_; }
+
+    //! Size of the file in bytes.
+    size_t GetSize() const { return size_; }
+
+    //! Content of the file, followed by a null character.
+    /*! An empty string if the file could not be mapped. */
+    const char* GetString() const { return data_; }
+
+    //! Writable content of the file, followed by a null character.
+    /*! \pre GetMode() == kCopyOnWrite */
+    char* GetInsituString() {
+        RAPIDJSON_ASSERT(mode_ == kCopyOnWrite);
+        return data_;
+    }
+
+    //! Read stream over the whole file.
+    StringStream GetStream() const { return StringStream(data_); }
+
+    //! Insitu stream over the whole file.
+    /*! \pre GetMode() == kCopyOnWrite */
+    InsituStringStream GetInsituStream() { return InsituStringStream(GetInsituString()); }
+
+private:
+    MemoryMappedFile(const MemoryMappedFile&);
+    MemoryMappedFile& operator=(const MemoryMappedFile&);
+
+#ifdef _WIN32
+    void Open(const char* filename) {
+        HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && static_cast<unsigned long long>(size.QuadPart) < static_cast<size_t>(-1)) {
+            size_ = static_cast<size_t>(size.QuadPart);
+            if (size_ == 0)
+                open_ = true;
+            else
+                Map(file);
+        }
+        CloseHandle(file);
+
+        if (!open_)
+            size_ = 0;
+    }
+
+    void Map(HANDLE file) {
+        // The view is zero-filled up to a page boundary. When the file ends exactly
+        // on a page, there is no room for the terminator, so read a copy instead.
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        if (size_ % info.dwPageSize == 0) {
+            char* buffer = static_cast<char*>(std::malloc(size_ + 1));
+            DWORD readSize = 0;
+            if (buffer && size_ <= 0xFFFFFFFFu && ReadFile(file, buffer, static_cast<DWORD>(size_), &readSize, 0) && readSize == size_) {
+                buffer[size_] = '\0';
+                data_ = buffer;
+                mapping_ = buffer;
+                mappingSize_ = size_ + 1;
+                open_ = true;
+            }
+            else
+                std::free(buffer);
+            return;
+        }
+
+        HANDLE fileMapping = CreateFileMappingA(file, 0, mode_ == kCopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, 0);
+        if (!fileMapping)
+            return;
+        void* view = MapViewOfFile(fileMapping, mode_ == kCopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(fileMapping);
+        if (view) {
+            data_ = static_cast<char*>(view);
+            mapping_ = view;
+            open_ = true;
+        }
+    }
+#else
+    void Open(const char* filename) {
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && static_cast<unsigned long long>(st.st_size) < static_cast<size_t>(-1)) {
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ == 0)
+                open_ = true;
+            else
+                Map(fd);
+        }
+        close(fd);
+
+        if (!open_)
+            size_ = 0;
+    }
+
+    void Map(int fd) {
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const int prot = mode_ == kCopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* p;
+        if (size_ % pageSize != 0) {
+            // The rest of the last page is zero-filled, which terminates the string.
+            mappingSize_ = size_;
+            p = mmap(0, mappingSize_, prot, MAP_PRIVATE, fd, 0);
+        }
+        else {
+            // Reserve one more zero page for the terminator and map the file over the others.
+            mappingSize_ = size_ + pageSize;
+            p = mmap(0, mappingSize_, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p != MAP_FAILED && mmap(p, size_, prot, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                munmap(p, mappingSize_);
+                p = MAP_FAILED;
+            }
+        }
+        if (p == MAP_FAILED) {
+            mappingSize_ = 0;
+            return;
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise(p, mappingSize_, MADV_SEQUENTIAL);
+#endif
+        data_ = static_cast<char*>(p);
+        mapping_ = p;
+        open_ = true;
+    }
+#endif
+
+    char* data_;            //!< Null-terminated content.
+    size_t size_;           //!< File size in bytes.
+    void* mapping_;         //!< Start of the mapping, 0 if nothing is mapped.
+    size_t mappingSize_;    //!< Size of the mapping (POSIX), or of the copy in place of a view (Windows).
+    Mode mode_;
+    bool open_;
+    char empty_[1];         //!< Content of empty files and of files which could not be mapped.
+};
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __clang__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_MEMORYMAPPEDFILE_H_
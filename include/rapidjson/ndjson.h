@@ -0,0 +1,357 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_NDJSON_H_
+#define RAPIDJSON_NDJSON_H_
+
+#include "document.h"
+
+#if !RAPIDJSON_HAS_CXX11_THREAD
+#error "rapidjson/ndjson.h requires C++11 threads (RAPIDJSON_HAS_CXX11_THREAD)"
+#endif
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstring> // std::memchr
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericNDJsonParser
+
+//! Parses newline-delimited JSON (NDJSON) on a pool of worker threads.
+/*!
+    The input is a memory buffer holding one JSON text per line. It is split
+    into batches of roughly \c batchSize code units, always ending on a
+    newline, and the batches are handed out to the workers. Each worker parses
+    its batch record by record into its own \c Allocator, so the workers never
+    share an allocator. The records are then delivered to the caller on the
+    calling thread, in input order.
+
+    Lines containing only whitespace are ignored. A record may not span
+    several lines.
+
+    A record is only valid during the call which delivers it: the memory is
+    reclaimed when the worker moves on to another batch. Use
+    GenericValue::CopyFrom() to keep a record.
+
+    \tparam Encoding Encoding of the input and of the records. NDJSON is UTF-8,
+        so the code unit must be a single byte.
+    \tparam Allocator Allocator of the records. It must provide \c Clear()
+        like MemoryPoolAllocator, which releases all records of a batch at once.
+    \tparam StackAllocator Allocator for the parsing stacks of each worker. A
+        MemoryPoolAllocator is reset before each record, so that the stacks
+        reuse its memory instead of allocating it again for every record.
+    \note Requires C++11 threads (\ref RAPIDJSON_HAS_CXX11_THREAD).
+*/
+template <typename Encoding, typename Allocator = MemoryPoolAllocator<>, typename StackAllocator = MemoryPoolAllocator<> >
+class GenericNDJsonParser {
+    RAPIDJSON_STATIC_ASSERT(sizeof(typename Encoding::Ch) == 1);
+public:
+    typedef typename Encoding::Ch Ch;                                   //!< Character type derived from Encoding.
+    typedef GenericValue<Encoding, Allocator> ValueType;                //!< Type of the records.
+    typedef GenericDocument<Encoding, Allocator, StackAllocator> DocumentType; //!< Document type used by the workers.
+
+    //! Default size of a batch in code units.
+    static const size_t kDefaultBatchSize = 64 * 1024;
+
+    //! Constructor.
+    /*!
+        \param threadCount Number of worker threads. 0 uses \c std::thread::hardware_concurrency().
+        \param batchSize Minimum number of code units handed to a worker at once.
+    */
+    explicit GenericNDJsonParser(unsigned threadCount = 0, size_t batchSize = kDefaultBatchSize) :
+        workers_(), mutex_(), produced_(), consumed_(),
+        json_(), length_(), next_(), batchCount_(), stop_(), batchSize_(batchSize), recordCount_()
+    {
+        if (threadCount == 0)
+            threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0)
+            threadCount = 1;
+        if (batchSize_ == 0)
+            batchSize_ = 1;
+        workers_.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; i++)
+            workers_.push_back(RAPIDJSON_NEW(Worker)());
+    }
+
+    //! Destructor.
+    ~GenericNDJsonParser() {
+        for (size_t i = 0; i < workers_.size(); i++)
+            RAPIDJSON_DELETE(workers_[i]);
+    }
+
+    //! Parses all records and delivers them in input order.
+    /*!
+        \tparam parseFlags Combination of \ref ParseFlag, applied to every record.
+            \c kParseInsituFlag is not supported.
+        \tparam RecordHandler Functor with <tt>bool f(const ValueType& record, size_t index)</tt>
+            prototype, where \c index is the zero-based number of the record.
+            Returning \c false stops parsing with \c kParseErrorTermination.
+        \param json Buffer of NDJSON text, need not be null-terminated.
+        \param length Length of \c json in code units.
+        \param handler Receives the records, on the calling thread.
+        \return Result of the first failing record, with the offset into \c json.
+            The records before it have all been delivered.
+    */
+    template <unsigned parseFlags, typename RecordHandler>
+    ParseResult Parse(const Ch* json, size_t length, RecordHandler& handler) {
+        RAPIDJSON_STATIC_ASSERT(!(parseFlags & kParseInsituFlag));
+        RAPIDJSON_ASSERT(json != 0 || length == 0);
+
+        json_ = json;
+        length_ = length;
+        next_ = 0;
+        batchCount_ = 0;
+        stop_ = false;
+        recordCount_ = 0;
+        for (size_t i = 0; i < workers_.size(); i++)
+            workers_[i]->ready = false;
+
+        ThreadJoiner joiner(*this);
+        for (size_t i = 0; i < workers_.size(); i++)
+            joiner.threads.push_back(std::thread(&GenericNDJsonParser::template Work<parseFlags>, this, workers_[i]));
+
+        ParseResult result;
+        for (size_t batch = 0; !result.IsError(); batch++) {
+            Worker* w = WaitBatch(batch);
+            if (!w)
+                break;
+
+            for (SizeType i = 0; i < w->records.Size(); i++, recordCount_++)
+                if (!handler(static_cast<const ValueType&>(w->records[i]), recordCount_)) {
+                    result.Set(kParseErrorTermination, w->offsets.template Bottom<size_t>()[i]);
+                    break;
+                }
+            if (!result.IsError())
+                result = w->result;
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            w->ready = false;
+            if (result.IsError())
+                stop_ = true;
+            consumed_.notify_all();
+        }
+        return result;
+    }
+
+    //! Parses all records with default flags (\c kParseDefaultFlags).
+    template <typename RecordHandler>
+    ParseResult Parse(const Ch* json, size_t length, RecordHandler& handler) {
+        return Parse<kParseDefaultFlags>(json, length, handler);
+    }
+
+    //! Parses all records and replays them to a SAX handler in input order.
+    /*!
+        Each record produces a complete sequence of events, as if it were
+        parsed alone.
+        \tparam parseFlags Combination of \ref ParseFlag.
+        \tparam Handler Type of the SAX handler, see \ref Handler.
+    */
+    template <unsigned parseFlags, typename Handler>
+    ParseResult ParseEvents(const Ch* json, size_t length, Handler& handler) {
+        EventForwarder<Handler> forwarder(handler);
+        return Parse<parseFlags>(json, length, forwarder);
+    }
+
+    //! Parses all records with default flags and replays them to a SAX handler.
+    template <typename Handler>
+    ParseResult ParseEvents(const Ch* json, size_t length, Handler& handler) {
+        return ParseEvents<kParseDefaultFlags>(json, length, handler);
+    }
+
+    //! Number of worker threads.
+    unsigned GetThreadCount() const { return static_cast<unsigned>(workers_.size()); }
+
+    //! Size of a batch in code units.
+    size_t GetBatchSize() const { return batchSize_; }
+
+    //! Number of records delivered by the last call to Parse().
+    /*! On error this is also the index of the failing record. */
+    size_t GetRecordCount() const { return recordCount_; }
+
+private:
+    GenericNDJsonParser(const GenericNDJsonParser&);
+    GenericNDJsonParser& operator=(const GenericNDJsonParser&);
+
+    //! State of one worker, which owns the records of the batch it parsed last.
+    struct Worker {
+        Worker() : allocator(), stackAllocator(), document(&allocator, kDefaultStackCapacity, &stackAllocator), records(kArrayType), offsets(0, 16 * sizeof(size_t)), result(), batch(), ready() {}
+
+        Allocator allocator;
+        StackAllocator stackAllocator;      //!< Parsing stacks of document, free between records.
+        DocumentType document;              //!< Parsing target, reused for all records.
+        ValueType records;                  //!< Records of the batch, in allocator.
+        internal::Stack<StackAllocator> offsets; //!< Offset of each record in the input.
+        ParseResult result;                 //!< Error of the record following the last one in records.
+        size_t batch;
+        bool ready;                         //!< Batch is parsed and not yet delivered.
+
+    private:
+        Worker(const Worker&);
+        Worker& operator=(const Worker&);
+    };
+
+    //! Stops and joins the workers, also when the record handler throws.
+    struct ThreadJoiner {
+        explicit ThreadJoiner(GenericNDJsonParser& parser) : parser_(parser), threads() {}
+        ~ThreadJoiner() {
+            {
+                std::unique_lock<std::mutex> lock(parser_.mutex_);
+                parser_.stop_ = true;
+                parser_.consumed_.notify_all();
+            }
+            for (size_t i = 0; i < threads.size(); i++)
+                threads[i].join();
+        }
+
+        GenericNDJsonParser& parser_;
+        std::vector<std::thread> threads;
+    };
+
+    template <typename Handler>
+    struct EventForwarder {
+        explicit EventForwarder(Handler& handler) : handler_(handler) {}
+        bool operator()(const ValueType& record, size_t) { return record.Accept(handler_); }
+        Handler& handler_;
+    };
+
+    //! Claims the next batch of the input, returns false when there is none left.
+    bool ClaimBatch(size_t& begin, size_t& end, size_t& batch) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stop_ || next_ >= length_)
+            return false;
+        begin = next_;
+        end = length_;
+        if (length_ - begin > batchSize_) {
+            const Ch* newline = FindNewline(json_ + begin + batchSize_, json_ + length_);
+            if (newline != json_ + length_)
+                end = static_cast<size_t>(newline - json_) + 1;
+        }
+        next_ = end;
+        batch = batchCount_++;
+        return true;
+    }
+
+    //! Waits until the given batch is parsed, returns 0 when the input is exhausted.
+    Worker* WaitBatch(size_t batch) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            for (size_t i = 0; i < workers_.size(); i++)
+                if (workers_[i]->ready && workers_[i]->batch == batch)
+                    return workers_[i];
+            if (next_ >= length_ && batchCount_ <= batch)
+                return 0;
+            produced_.wait(lock);
+        }
+    }
+
+    template <unsigned parseFlags>
+    void Work(Worker* w) {
+        size_t begin, end, batch;
+        while (ClaimBatch(begin, end, batch)) {
+            ParseBatch<parseFlags>(*w, begin, end);
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            w->batch = batch;
+            w->ready = true;
+            produced_.notify_all();
+            while (w->ready && !stop_)
+                consumed_.wait(lock);
+        }
+    }
+
+    template <unsigned parseFlags>
+    void ParseBatch(Worker& w, size_t begin, size_t end) {
+        w.records.SetArray();
+        w.document.SetNull();
+        w.allocator.Clear();
+        w.offsets.Clear();
+        w.result.Clear();
+
+        const Ch* p = json_ + begin;
+        const Ch* batchEnd = json_ + end;
+        while (p < batchEnd) {
+            const Ch* lineEnd = FindNewline(p, batchEnd);
+            if (!IsBlank(p, lineEnd)) {
+                const size_t offset = static_cast<size_t>(p - json_);
+                ResetStackAllocator(w.stackAllocator);
+                w.document.template Parse<parseFlags>(p, static_cast<size_t>(lineEnd - p));
+                if (w.document.HasParseError()) {
+                    w.result.Set(w.document.GetParseError(), offset + w.document.GetErrorOffset());
+                    return;
+                }
+                w.records.PushBack(static_cast<ValueType&>(w.document), w.allocator);
+                *w.offsets.template Push<size_t>() = offset;
+            }
+            p = lineEnd + (lineEnd < batchEnd ? 1 : 0);
+        }
+    }
+
+    template <typename A>
+    static void ResetStackAllocator(A&) {}
+
+    template <typename BaseAllocator>
+    static void ResetStackAllocator(MemoryPoolAllocator<BaseAllocator>& a) { a.Reset(); }
+
+    template <typename T>
+    static const T* FindNewline(const T* p, const T* end) {
+        while (p != end && *p != '\n')
+            ++p;
+        return p;
+    }
+
+    static const char* FindNewline(const char* p, const char* end) {
+        const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+        return newline ? static_cast<const char*>(newline) : end;
+    }
+
+    static bool IsBlank(const Ch* p, const Ch* end) {
+        for (; p != end; ++p)
+            if (*p != ' ' && *p != '\t' && *p != '\r')
+                return false;
+        return true;
+    }
+
+    static const size_t kDefaultStackCapacity = 1024;
+    std::vector<Worker*> workers_;
+    std::mutex mutex_;
+    std::condition_variable produced_;  //!< Signaled when a worker has parsed a batch.
+    std::condition_variable consumed_;  //!< Signaled when a batch is delivered or parsing stops.
+    const Ch* json_;
+    size_t length_;
+    size_t next_;           //!< Offset of the first unclaimed code unit.
+    size_t batchCount_;     //!< Number of claimed batches.
+    bool stop_;
+    size_t batchSize_;
+    size_t recordCount_;
+};
+
+//! GenericNDJsonParser with UTF8 encoding and the default allocators.
+typedef GenericNDJsonParser<UTF8<> > NDJsonParser;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_NDJSON_H_
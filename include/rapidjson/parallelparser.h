@@ -0,0 +1,390 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_PARALLELPARSER_H_
+#define RAPIDJSON_PARALLELPARSER_H_
+
+#include "document.h"
+#include "internal/structuralindex.h"
+
+#if !RAPIDJSON_HAS_CXX11_THREAD
+#error "rapidjson/parallelparser.h requires C++11 threads (RAPIDJSON_HAS_CXX11_THREAD)"
+#endif
+
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericParallelParser
+
+//! Parses a large JSON array in memory on several threads into one document.
+/*!
+    Documents like a GeoJSON FeatureCollection hold most of their content in
+    one big array. When the root of the text is an array, the text is cut
+    into one chunk per thread, and each thread parses the elements which
+    start in its chunk:
+    -# Each thread counts the unescaped quotes of its chunk and the change of
+       bracket depth, both assuming that the chunk starts outside a string and
+       that it starts inside one. The chunk is classified 64 bytes at a time
+       like for \ref kParseStructuralIndexFlag, with SIMD if enabled.
+    -# Chaining these gives whether each chunk starts in a string and at which
+       depth, so each thread finds the first comma of the root array in its
+       chunk, and parses the elements from there into its own \c Allocator,
+       until it passes the end of its chunk.
+    -# The elements are moved into the root array of the document, in order,
+       and the document's allocator adopts the memory of the threads.
+
+    Every element is checked by the reader, and where a thread stopped must be
+    where the next one started; otherwise (e.g. with comments containing
+    quotes), and on any parse error, the text is parsed again sequentially,
+    which gives the same document or error as GenericDocument::Parse().
+    Other texts, and those shorter than two chunks (2 MB by default), are
+    only parsed sequentially. So are all texts with the default thread count
+    when \c std::thread::hardware_concurrency() reports a single hardware
+    thread: the threads would then only add the cost of the first step to
+    GenericDocument::Parse(). An explicit thread count is always used.
+
+    \code
+    ParallelParser parser;  // std::thread::hardware_concurrency() threads
+    Document d;
+    ParseResult ok = parser.Parse(d, json, length);
+    \endcode
+
+    The root array is never packed by \ref kParsePackNumberArraysFlag.
+
+    \tparam Encoding Encoding of the text and of the document, with single byte
+        code units like UTF-8.
+    \tparam Allocator Allocator of the document. It must provide \c Adopt()
+        like MemoryPoolAllocator, which takes over the memory of the threads.
+    \tparam StackAllocator Allocator for the parsing stack of each thread.
+    \note Requires C++11 threads (\ref RAPIDJSON_HAS_CXX11_THREAD).
+*/
+template <typename Encoding, typename Allocator = MemoryPoolAllocator<>, typename StackAllocator = CrtAllocator>
+class GenericParallelParser {
+    RAPIDJSON_STATIC_ASSERT(sizeof(typename Encoding::Ch) == 1);
+public:
+    typedef typename Encoding::Ch Ch;                                   //!< Character type derived from Encoding.
+    typedef GenericValue<Encoding, Allocator> ValueType;                //!< Type of the elements.
+    typedef GenericDocument<Encoding, Allocator, StackAllocator> DocumentType; //!< Type of the parsed document.
+
+    //! Default minimum size of a chunk in code units.
+    static const size_t kDefaultMinChunkSize = 1024 * 1024;
+
+    //! Constructor.
+    /*!
+        \param threadCount Number of threads, including the calling one. 0 uses \c std::thread::hardware_concurrency().
+            On a single hardware thread, 0 parses sequentially.
+        \param minChunkSize Minimum number of code units parsed by a thread,
+            fewer threads are used for shorter texts.
+    */
+    explicit GenericParallelParser(unsigned threadCount = 0, size_t minChunkSize = kDefaultMinChunkSize) :
+        workers_(), json_(), length_(), minChunkSize_(minChunkSize), parallel_()
+    {
+        if (threadCount == 0)
+            threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0)
+            threadCount = 1;
+        if (minChunkSize_ == 0)
+            minChunkSize_ = 1;
+        workers_.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; i++)
+            workers_.push_back(RAPIDJSON_NEW(Worker)());
+    }
+
+    //! Destructor.
+    ~GenericParallelParser() {
+        for (size_t i = 0; i < workers_.size(); i++)
+            RAPIDJSON_DELETE(workers_[i]);
+    }
+
+    //! Parses a JSON text into a document.
+    /*!
+        \tparam parseFlags Combination of \ref ParseFlag. \c kParseInsituFlag is not supported.
+        \param document Document receiving the value, and the parse result.
+        \param json Text, need not be null-terminated.
+        \param length Length of \c json in code units.
+        \return The parse result, also held by \c document.
+    */
+    template <unsigned parseFlags>
+    ParseResult Parse(DocumentType& document, const Ch* json, size_t length) {
+        RAPIDJSON_STATIC_ASSERT(!(parseFlags & kParseInsituFlag));
+        RAPIDJSON_ASSERT(json != 0 || length == 0);
+
+        json_ = json;
+        length_ = length;
+        parallel_ = ParseParallel<parseFlags>(document);
+        if (!parallel_)
+            document.template Parse<parseFlags>(json, length);
+        return document.parseResult_;
+    }
+
+    //! Parses a JSON text into a document with default flags (\c kParseDefaultFlags).
+    ParseResult Parse(DocumentType& document, const Ch* json, size_t length) {
+        return Parse<kParseDefaultFlags>(document, json, length);
+    }
+
+    //! Maximum number of threads.
+    unsigned GetThreadCount() const { return static_cast<unsigned>(workers_.size()); }
+
+    //! Minimum size of a chunk in code units.
+    size_t GetMinChunkSize() const { return minChunkSize_; }
+
+    //! Whether the last call to Parse() was done in parallel, without parsing sequentially.
+    bool IsParallel() const { return parallel_; }
+
+private:
+    GenericParallelParser(const GenericParallelParser&);
+    GenericParallelParser& operator=(const GenericParallelParser&);
+
+    static const size_t kNoSeparator = ~static_cast<size_t>(0);
+
+    //! State of one thread, which owns the elements of its chunk until they are moved into the document.
+    struct Worker {
+        Worker() : allocator(), document(&allocator), begin(), end(), escaped(), quoteParity(), depthOutside(), depthInside(),
+            inString(), depth(), firstSeparator(), endSeparator(), closed(), failed() {}
+
+        Allocator allocator;
+        DocumentType document;              //!< Holds the parsed elements on its stack.
+        size_t begin;                       //!< Chunk of the text.
+        size_t end;
+        bool escaped;                       //!< Whether the chunk starts after an odd number of backslashes.
+        bool quoteParity;                   //!< Whether the chunk has an odd number of unescaped quotes.
+        ptrdiff_t depthOutside;             //!< Depth change of the chunk if it starts outside a string.
+        ptrdiff_t depthInside;              //!< Depth change of the chunk if it starts in a string.
+        bool inString;                      //!< Whether the chunk starts in a string.
+        ptrdiff_t depth;                    //!< Depth at the start of the chunk, 1 in the root array.
+        size_t firstSeparator;              //!< Offset of the bracket or comma before the first element, or kNoSeparator.
+        size_t endSeparator;                //!< Offset of the comma or bracket after the last element.
+        bool closed;                        //!< endSeparator closes the root array.
+        bool failed;
+
+    private:
+        Worker(const Worker&);
+        Worker& operator=(const Worker&);
+    };
+
+    //! Joins the threads, also when the calling thread throws.
+    struct ThreadJoiner {
+        ThreadJoiner() : threads() {}
+        ~ThreadJoiner() {
+            for (size_t i = 0; i < threads.size(); i++)
+                threads[i].join();
+        }
+        std::vector<std::thread> threads;
+    };
+
+    //! Runs a step on the first \c count workers, the first one on the calling thread.
+    void Run(void (GenericParallelParser::*step)(Worker*), size_t count) {
+        ThreadJoiner joiner;
+        joiner.threads.reserve(count - 1);
+        for (size_t i = 1; i < count; i++)
+            joiner.threads.push_back(std::thread(step, this, workers_[i]));
+        (this->*step)(workers_[0]);
+    }
+
+    //! Parses the root array on the workers, returns false to parse sequentially.
+    template <unsigned parseFlags>
+    bool ParseParallel(DocumentType& document) {
+        const size_t bracket = SkipWhitespace(0);
+        if (bracket == length_ || json_[bracket] != '[')
+            return false;
+        size_t count = (length_ - bracket) / minChunkSize_;
+        if (count > workers_.size())
+            count = workers_.size();
+        if (count < 2)
+            return false;
+
+        const size_t chunkSize = (length_ - bracket) / count;
+        for (size_t i = 0; i < count; i++) {
+            workers_[i]->begin = bracket + i * chunkSize;
+            workers_[i]->end = i + 1 < count ? workers_[i]->begin + chunkSize : length_;
+        }
+        Run(&GenericParallelParser::ScanChunk, count);
+
+        bool inString = false;
+        ptrdiff_t depth = 0;
+        for (size_t i = 0; i < count; i++) {
+            Worker& w = *workers_[i];
+            w.inString = inString;
+            w.depth = depth;
+            depth += inString ? w.depthInside : w.depthOutside;
+            inString = inString != w.quoteParity;
+        }
+        Run(&GenericParallelParser::template ParseChunk<parseFlags>, count);
+
+        // Each worker must start where the previous one stopped.
+        size_t next = bracket, elementCount = 0;
+        bool closed = false, consistent = true;
+        for (size_t i = 0; i < count && consistent; i++) {
+            const Worker& w = *workers_[i];
+            if (w.failed)
+                consistent = false;
+            else if (w.firstSeparator == kNoSeparator)
+                consistent = closed || next >= w.end;
+            else if (closed || w.firstSeparator != next)
+                consistent = false;
+            else {
+                next = w.endSeparator;
+                closed = w.closed;
+                elementCount += w.document.stack_.GetSize() / sizeof(ValueType);
+            }
+        }
+        if (!consistent || !closed || (!(parseFlags & kParseStopWhenDoneFlag) && SkipWhitespace(next + 1) != length_)) {
+            for (size_t i = 0; i < count; i++)
+                Discard(*workers_[i]);
+            return false;
+        }
+
+        ValueType& root = document;
+        root.SetArray().Reserve(static_cast<SizeType>(elementCount), document.GetAllocator());
+        for (size_t i = 0; i < count; i++) {
+            Worker& w = *workers_[i];
+            ValueType* elements = w.document.stack_.template Bottom<ValueType>();
+            const size_t n = w.document.stack_.GetSize() / sizeof(ValueType);
+            for (size_t j = 0; j < n; j++)
+                root.PushBack(elements[j], document.GetAllocator());
+            w.document.ClearStack();
+            document.GetAllocator().Adopt(w.allocator);
+        }
+        document.parseResult_.Clear();
+        return true;
+    }
+
+    //! Counts the quotes and the brackets of a chunk, for both starting states.
+    void ScanChunk(Worker* w) {
+        // Backslashes are only valid in strings, so a run of them before the chunk escapes its first character.
+        bool escaped = false;
+        for (size_t i = w->begin; i > 0 && json_[i - 1] == '\\'; i--)
+            escaped = !escaped;
+        w->escaped = escaped;
+
+        internal::StructuralIndexer indexer(escaped, false);
+        ptrdiff_t depthOutside = 0, depthInside = 0;
+        char padded[64];
+        for (size_t offset = w->begin; offset < w->end; offset += 64) {
+            uint64_t open, close, separator;
+            const uint64_t inString = indexer.Scan(Block(offset, w->end, padded), open, close, separator);
+            depthOutside += Count(open & ~inString) - Count(close & ~inString);
+            depthInside += Count(open & inString) - Count(close & inString);
+        }
+        w->quoteParity = indexer.InString();
+        w->depthOutside = depthOutside;
+        w->depthInside = depthInside;
+    }
+
+    //! Parses the elements after the separators in the chunk of a worker.
+    /*! The document of the worker is the handler of all elements, which pile up on its stack. */
+    template <unsigned parseFlags>
+    void ParseChunk(Worker* w) {
+        w->endSeparator = kNoSeparator;
+        w->closed = false;
+        w->failed = false;
+        size_t separator = w->firstSeparator = (w == workers_[0]) ? w->begin : FindSeparator(*w);
+        if (separator == kNoSeparator)
+            return;
+
+        GenericReader<Encoding, Encoding, StackAllocator> reader;
+        w->document.packNumberArrays_ = (parseFlags & kParsePackNumberArraysFlag) != 0;
+        for (;;) {
+            MemoryStream ms(reinterpret_cast<const char*>(json_ + separator + 1), length_ - separator - 1);
+            if (reader.template Parse<parseFlags | kParseStopWhenDoneFlag>(ms, w->document).IsError()) {
+                w->failed = true;
+                return;
+            }
+
+            const size_t p = SkipWhitespace(separator + 1 + ms.Tell());
+            if (p == length_ || (json_[p] != ',' && json_[p] != ']')) {
+                w->failed = true;
+                return;
+            }
+            separator = p;
+            if (json_[p] == ']' || p >= w->end) {
+                w->endSeparator = p;
+                w->closed = json_[p] == ']';
+                return;
+            }
+        }
+    }
+
+    //! Finds the first comma of the root array in the chunk of a worker.
+    size_t FindSeparator(const Worker& w) const {
+        internal::StructuralIndexer indexer(w.escaped, w.inString);
+        ptrdiff_t depth = w.depth;
+        char padded[64];
+        for (size_t offset = w.begin; offset < w.end; offset += 64) {
+            uint64_t open, close, separator;
+            const uint64_t inString = indexer.Scan(Block(offset, w.end, padded), open, close, separator);
+            for (uint64_t bits = (open | close | separator) & ~inString; bits; bits &= bits - 1) {
+                const size_t i = offset + internal::CountTrailingZero64(bits);
+                const uint64_t bit = bits & (0 - bits);
+                if (open & bit)
+                    depth++;
+                else if (close & bit)
+                    depth--;
+                else if (depth == 1 && json_[i] == ',')
+                    return i;
+            }
+        }
+        return kNoSeparator;
+    }
+
+    //! The 64 code units of the text at an offset, padded with whitespace from \c end.
+    const char* Block(size_t offset, size_t end, char* padded) const {
+        const char* block = reinterpret_cast<const char*>(json_ + offset);
+        if (end - offset >= 64)
+            return block;
+        std::memset(padded, ' ', 64);
+        std::memcpy(padded, block, end - offset);
+        return padded;
+    }
+
+    static ptrdiff_t Count(uint64_t bits) { return static_cast<ptrdiff_t>(internal::PopCount64(bits)); }
+
+    //! Releases the elements of a worker which are not used.
+    static void Discard(Worker& w) {
+        w.document.ClearStack();
+        w.allocator.Clear();
+    }
+
+    size_t SkipWhitespace(size_t i) const {
+        while (i < length_ && (json_[i] == ' ' || json_[i] == '\n' || json_[i] == '\r' || json_[i] == '\t'))
+            i++;
+        return i;
+    }
+
+    std::vector<Worker*> workers_;
+    const Ch* json_;
+    size_t length_;
+    size_t minChunkSize_;
+    bool parallel_;
+};
+
+//! GenericParallelParser with UTF8 encoding and the default allocators.
+typedef GenericParallelParser<UTF8<> > ParallelParser;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_PARALLELPARSER_H_
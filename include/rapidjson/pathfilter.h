@@ -0,0 +1,539 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_PATHFILTER_H_
+#define RAPIDJSON_PATHFILTER_H_
+
+#include "reader.h"
+#include "internal/stack.h"
+#include "internal/strfunc.h"
+#include <cstring> // std::memcmp
+
+#ifdef _MSC_VER
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(4512) // assignment operator could not be generated
+#endif
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericPathFilter
+
+//! A set of path patterns selecting which parts of a JSON text are kept.
+/*!
+    Each pattern is either a JSON Pointer (RFC 6901) such as \c "/features/0/geometry",
+    or a dot separated key path such as \c "features.0.geometry". A pattern
+    beginning with '/' is interpreted as a JSON Pointer, otherwise as a key path.
+    The token \c "*" matches any member name and any array index.
+
+    Patterns are added either as exclusions or inclusions:
+    \li A value whose path matches an exclusion is dropped together with its subtree
+        (the member, or the array element, does not appear in the output at all).
+    \li If at least one inclusion exists, only values whose path matches an inclusion
+        are kept, together with their subtrees. Objects and arrays on the way to
+        an inclusion are kept as containers of the selected values.
+    \li The root value is always kept.
+
+    A filter is used with GenericFilteredHandler, which wraps a SAX handler, or
+    directly with GenericDocument::ParseStream(InputStream&, const PathFilterType&).
+
+    \code
+    PathFilter filter;
+    filter.Exclude("features.*.geometry.coordinates");
+    Document d;
+    d.Parse(json, filter);
+    \endcode
+
+    \tparam Encoding Encoding of member names (must be the target encoding of the reader).
+    \tparam Allocator Allocator for storing the patterns.
+    \note Member names are compared with the target encoding, after unescaping.
+*/
+template <typename Encoding, typename Allocator = CrtAllocator>
+class GenericPathFilter {
+public:
+    typedef typename Encoding::Ch Ch;   //!< Character type from encoding.
+    typedef Allocator AllocatorType;    //!< Allocator type from template parameter.
+
+    //! Constructor.
+    /*! \param allocator Optional allocator for storing the patterns.
+    */
+    explicit GenericPathFilter(Allocator* allocator = 0) :
+        patterns_(allocator, kDefaultPatternCapacity * sizeof(Pattern)),
+        tokens_(allocator, kDefaultPatternCapacity * sizeof(Token)),
+        names_(allocator, kDefaultNameCapacity * sizeof(Ch)),
+        includeCount_() {}
+
+    //! Add an exclusion pattern.
+    /*! \param path Null-terminated JSON Pointer or key path.
+        \return false if \c path is a malformed JSON Pointer, in which case the pattern is not added.
+    */
+    bool Exclude(const Ch* path) { return AddPattern(path, internal::StrLen(path), false); }
+
+    //! Add an exclusion pattern with explicit length.
+    bool Exclude(const Ch* path, SizeType length) { return AddPattern(path, length, false); }
+
+    //! Add an inclusion pattern.
+    /*! \param path Null-terminated JSON Pointer or key path.
+        \return false if \c path is a malformed JSON Pointer, in which case the pattern is not added.
+    */
+    bool Include(const Ch* path) { return AddPattern(path, internal::StrLen(path), true); }
+
+    //! Add an inclusion pattern with explicit length.
+    bool Include(const Ch* path, SizeType length) { return AddPattern(path, length, true); }
+
+    //! Remove all patterns.
+    void Clear() {
+        patterns_.Clear();
+        tokens_.Clear();
+        names_.Clear();
+        includeCount_ = 0;
+    }
+
+    //! Number of patterns added.
+    SizeType GetPatternCount() const { return static_cast<SizeType>(patterns_.GetSize() / sizeof(Pattern)); }
+
+    //! Whether any inclusion pattern has been added.
+    bool HasInclusion() const { return includeCount_ != 0; }
+
+    //!@name Matching (used by GenericFilteredHandler)
+    //!@{
+
+    //! Whether the pattern is an inclusion pattern.
+    bool IsInclusion(SizeType pattern) const { return GetPattern(pattern).include; }
+
+    //! Number of tokens in the pattern.
+    SizeType GetTokenCount(SizeType pattern) const { return GetPattern(pattern).tokenCount; }
+
+    //! Whether token \c depth of the pattern matches a member name.
+    bool MatchName(SizeType pattern, SizeType depth, const Ch* name, SizeType length) const {
+        const Token& t = GetToken(pattern, depth);
+        return t.wildcard || (t.length == length && (length == 0 || std::memcmp(names_.template Bottom<Ch>() + t.offset, name, length * sizeof(Ch)) == 0));
+    }
+
+    //! Whether token \c depth of the pattern matches an array index.
+    bool MatchIndex(SizeType pattern, SizeType depth, SizeType index) const {
+        const Token& t = GetToken(pattern, depth);
+        return t.wildcard || t.index == index;
+    }
+    //!@}
+
+private:
+    struct Pattern {
+        SizeType tokenBegin;    //!< Index of the first token in tokens_.
+        SizeType tokenCount;    //!< Number of tokens.
+        bool include;           //!< Inclusion or exclusion.
+    };
+
+    struct Token {
+        SizeType offset;        //!< Offset of the name in names_, in characters.
+        SizeType length;        //!< Length of the name.
+        SizeType index;         //!< Array index, or kInvalidIndex if the name is not an index.
+        bool wildcard;          //!< Token "*".
+    };
+
+    static const SizeType kInvalidIndex = ~SizeType(0);
+    static const size_t kDefaultPatternCapacity = 8;
+    static const size_t kDefaultNameCapacity = 256;
+
+    const Pattern& GetPattern(SizeType pattern) const {
+        RAPIDJSON_ASSERT(pattern < GetPatternCount());
+        return patterns_.template Bottom<Pattern>()[pattern];
+    }
+
+    const Token& GetToken(SizeType pattern, SizeType depth) const {
+        const Pattern& p = GetPattern(pattern);
+        RAPIDJSON_ASSERT(depth < p.tokenCount);
+        return tokens_.template Bottom<Token>()[p.tokenBegin + depth];
+    }
+
+    bool AddPattern(const Ch* path, SizeType length, bool include) {
+        RAPIDJSON_ASSERT(path != 0 || length == 0);
+        const size_t tokenSize = tokens_.GetSize();
+        const size_t nameSize = names_.GetSize();
+        const SizeType tokenBegin = static_cast<SizeType>(tokenSize / sizeof(Token));
+
+        const bool pointer = length > 0 && path[0] == '/';
+        SizeType i = pointer ? 1 : 0;
+        if (length > 0) {
+            for (;;) {
+                Token* t = tokens_.template Push<Token>();
+                t->offset = static_cast<SizeType>(names_.GetSize() / sizeof(Ch));
+                t->length = 0;
+                while (i < length && path[i] != (pointer ? '/' : '.')) {
+                    Ch c = path[i++];
+                    if (pointer && c == '~') {
+                        if (i < length && path[i] == '0')
+                            c = '~';
+                        else if (i < length && path[i] == '1')
+                            c = '/';
+                        else {
+                            tokens_.template Pop<char>(tokens_.GetSize() - tokenSize);
+                            names_.template Pop<char>(names_.GetSize() - nameSize);
+                            return false;
+                        }
+                        i++;
+                    }
+                    *names_.template Push<Ch>() = c;
+                    t->length++;
+                }
+                SetIndex(*t);
+                if (i == length)
+                    break;
+                i++; // skip separator
+            }
+        }
+
+        Pattern* p = patterns_.template Push<Pattern>();
+        p->tokenBegin = tokenBegin;
+        p->tokenCount = static_cast<SizeType>((tokens_.GetSize() - tokenSize) / sizeof(Token));
+        p->include = include;
+        if (include)
+            includeCount_++;
+        return true;
+    }
+
+    void SetIndex(Token& t) const {
+        const Ch* name = names_.template Bottom<Ch>() + t.offset;
+        t.wildcard = t.length == 1 && name[0] == '*';
+        t.index = kInvalidIndex;
+        // Same rule as GenericPointer: no leading zero and must fit in SizeType.
+        if (t.length == 0 || t.length > 9 || (t.length > 1 && name[0] == '0'))
+            return;
+        SizeType n = 0;
+        for (SizeType j = 0; j < t.length; j++) {
+            if (name[j] < '0' || name[j] > '9')
+                return;
+            n = n * 10 + static_cast<SizeType>(name[j] - '0');
+        }
+        t.index = n;
+    }
+
+    internal::Stack<Allocator> patterns_;
+    internal::Stack<Allocator> tokens_;
+    internal::Stack<Allocator> names_;
+    SizeType includeCount_;
+};
+
+//! GenericPathFilter with UTF8 encoding and default allocator.
+typedef GenericPathFilter<UTF8<> > PathFilter;
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericFilteredHandler
+
+//! SAX handler adapter which forwards only the values selected by a GenericPathFilter.
+/*!
+    Events of dropped values never reach the output handler, and the member and
+    element counts passed to \c EndObject() and \c EndArray() only count forwarded
+    values. This is how GenericDocument builds a DOM without pushing skipped
+    subtrees onto its stack or allocating them.
+
+    Parsing with \ref kParseSkipValueFlag lets the reader skip dropped subtrees
+    structurally instead of sending their events to this handler.
+
+    \tparam PathFilterType Type of the path filter, e.g. GenericPathFilter<UTF8<> >.
+    \tparam OutputHandler Type of the handler receiving the selected events.
+    \tparam StateAllocator Allocator for the path-matching state.
+    \note implements Handler concept
+*/
+template <typename PathFilterType, typename OutputHandler, typename StateAllocator = CrtAllocator>
+class GenericFilteredHandler {
+public:
+    typedef typename PathFilterType::Ch Ch;    //!< Character type.
+
+    //! Constructor.
+    /*! \param filter Path filter. It must not be modified while parsing.
+        \param handler Handler receiving the selected events.
+        \param allocator Optional allocator for the matching state.
+    */
+    GenericFilteredHandler(const PathFilterType& filter, OutputHandler& handler, StateAllocator* allocator = 0) :
+        filter_(filter), handler_(handler),
+        frames_(allocator, kDefaultDepth * sizeof(Frame)),
+        alive_(allocator, kDefaultDepth * sizeof(SizeType)),
+        keyBuffer_(allocator, 0),
+        key_(), keyLength_(), keyCopy_(), keyPending_(),
+        pendingAliveCount_(), skipDepth_(), next_(kRoot), nextIncluded_(), skipRequest_(), skippedCount_() {}
+
+    //! Number of values dropped so far (a dropped subtree counts as one).
+    size_t GetSkippedCount() const { return skippedCount_; }
+
+    // Implementation of Handler
+    bool Null()             { return BeginValue(false) ? handler_.Null() : true; }
+    bool Bool(bool b)       { return BeginValue(false) ? handler_.Bool(b) : true; }
+    bool Int(int i)         { return BeginValue(false) ? handler_.Int(i) : true; }
+    bool Uint(unsigned u)   { return BeginValue(false) ? handler_.Uint(u) : true; }
+    bool Int64(int64_t i)   { return BeginValue(false) ? handler_.Int64(i) : true; }
+    bool Uint64(uint64_t u) { return BeginValue(false) ? handler_.Uint64(u) : true; }
+    bool Double(double d)   { return BeginValue(false) ? handler_.Double(d) : true; }
+    bool Doubles(const double* values, SizeType count) { return Numbers(values, count); }
+    bool Int64s(const int64_t* values, SizeType count) { return Numbers(values, count); }
+    bool RawNumber(const Ch* str, SizeType length, bool copy) { return BeginValue(false) ? handler_.RawNumber(str, length, copy) : true; }
+    bool String(const Ch* str, SizeType length, bool copy) { return BeginValue(false) ? handler_.String(str, length, copy) : true; }
+
+    bool StartObject() {
+        if (!BeginValue(true))
+            return true;
+        return ForwardPendingKey() && handler_.StartObject() && PushFrame(false);
+    }
+
+    bool Key(const Ch* str, SizeType length, bool copy) {
+        skipRequest_ = false;
+        if (skipDepth_ > 0)
+            return true;
+        const Frame& f = *frames_.template Top<Frame>();
+        const SizeType depth = GetDepth();
+        bool fullInclude = false, fullExclude = false, partialInclude = false;
+        for (SizeType i = 0; i < f.aliveCount; i++) {
+            const SizeType pattern = alive_.template Bottom<SizeType>()[f.aliveBegin + i];
+            if (filter_.MatchName(pattern, depth, str, length))
+                Match(pattern, depth, fullInclude, fullExclude, partialInclude);
+        }
+        Decide(f, fullInclude, fullExclude, partialInclude);
+
+        if (next_ == kSkip)
+            skipRequest_ = true;
+        else if (next_ == kKeep)
+            return handler_.Key(str, length, copy);
+        else {
+            // Hold the name back until the value turns out to be an object or array.
+            if (copy) {
+                // The reader reuses its buffer for the next string, so keep a copy.
+                keyBuffer_.Clear();
+                Ch* buffer = keyBuffer_.template Push<Ch>(length);
+                std::memcpy(buffer, str, length * sizeof(Ch));
+                str = buffer;
+            }
+            key_ = str;
+            keyLength_ = length;
+            keyCopy_ = copy;
+            keyPending_ = true;
+        }
+        return true;
+    }
+
+    bool EndObject(SizeType) { return EndContainer() ? handler_.EndObject(PopFrame()) : true; }
+
+    bool StartArray() {
+        if (!BeginValue(true))
+            return true;
+        return ForwardPendingKey() && handler_.StartArray() && PushFrame(true);
+    }
+
+    bool EndArray(SizeType) { return EndContainer() ? handler_.EndArray(PopFrame()) : true; }
+
+    //! Whether the value just started, or following the key just received, is dropped.
+    /*! With \ref kParseSkipValueFlag, the reader then skips it without sending any
+        event, nor converting numbers or decoding strings.
+    */
+    bool SkipValue() {
+        if (!skipRequest_)
+            return false;
+        skipRequest_ = false;
+        if (skipDepth_ > 0)
+            skipDepth_ = 0;             // object/array just started, its end is not reported
+        else {
+            DropPendingAlive();         // member value after Key()
+            skippedCount_++;
+        }
+        return true;
+    }
+
+private:
+    //! Decision about the next value, made by Key() for members and by BeginValue() for elements.
+    enum Next {
+        kRoot,              //!< The root value, always kept.
+        kKeep,              //!< Keep the value.
+        kKeepIfContainer,   //!< Keep the value only if it is an object or array, as it leads to an inclusion.
+        kSkip               //!< Drop the value.
+    };
+
+    struct Frame {
+        SizeType aliveBegin;    //!< Offset in alive_ of the patterns still matching this path.
+        SizeType aliveCount;    //!< Number of patterns still matching this path.
+        SizeType count;         //!< Number of members/elements forwarded.
+        SizeType index;         //!< Index of the next element in the input, for arrays.
+        bool isArray;
+        bool included;          //!< Everything below is kept unless excluded.
+    };
+
+    static const size_t kDefaultDepth = 32;
+
+    GenericFilteredHandler(const GenericFilteredHandler&);
+    GenericFilteredHandler& operator=(const GenericFilteredHandler&);
+
+    SizeType GetDepth() const { return static_cast<SizeType>(frames_.GetSize() / sizeof(Frame) - 1); }
+
+    void Match(SizeType pattern, SizeType depth, bool& fullInclude, bool& fullExclude, bool& partialInclude) {
+        const bool include = filter_.IsInclusion(pattern);
+        if (filter_.GetTokenCount(pattern) == depth + 1)
+            (include ? fullInclude : fullExclude) = true;
+        else {
+            // Keep the pattern for matching the children of the value.
+            *alive_.template Push<SizeType>() = pattern;
+            pendingAliveCount_++;
+            if (include)
+                partialInclude = true;
+        }
+    }
+
+    void Decide(const Frame& f, bool fullInclude, bool fullExclude, bool partialInclude) {
+        nextIncluded_ = f.included || fullInclude;
+        if (fullExclude)
+            next_ = kSkip;
+        else if (nextIncluded_)
+            next_ = kKeep;
+        else if (partialInclude)
+            next_ = kKeepIfContainer;
+        else
+            next_ = kSkip;
+    }
+
+    void DropPendingAlive() {
+        alive_.template Pop<SizeType>(pendingAliveCount_);
+        pendingAliveCount_ = 0;
+    }
+
+    //! Decide whether the value being started is forwarded.
+    bool BeginValue(bool container) {
+        skipRequest_ = false;
+        if (skipDepth_ > 0) {
+            if (container)
+                skipDepth_++;
+            return false;
+        }
+
+        if (next_ == kRoot) {
+            nextIncluded_ = !filter_.HasInclusion();
+            for (SizeType p = 0; p < filter_.GetPatternCount(); p++) {
+                if (filter_.GetTokenCount(p) > 0) {
+                    *alive_.template Push<SizeType>() = p;
+                    pendingAliveCount_++;
+                }
+                else if (filter_.IsInclusion(p))
+                    nextIncluded_ = true;
+            }
+            next_ = kKeep;
+        }
+        else if (frames_.template Top<Frame>()->isArray) {
+            Frame& f = *frames_.template Top<Frame>();
+            const SizeType depth = GetDepth();
+            const SizeType index = f.index++;
+            bool fullInclude = false, fullExclude = false, partialInclude = false;
+            for (SizeType i = 0; i < f.aliveCount; i++) {
+                const SizeType pattern = alive_.template Bottom<SizeType>()[f.aliveBegin + i];
+                if (filter_.MatchIndex(pattern, depth, index))
+                    Match(pattern, depth, fullInclude, fullExclude, partialInclude);
+            }
+            Decide(f, fullInclude, fullExclude, partialInclude);
+        }
+
+        if (next_ == kSkip || (next_ == kKeepIfContainer && !container)) {
+            DropPendingAlive();
+            keyPending_ = false;
+            skippedCount_++;
+            if (container) {
+                skipDepth_ = 1;
+                skipRequest_ = true;
+            }
+            return false;
+        }
+
+        if (!container)
+            DropPendingAlive();
+        if (!frames_.Empty())
+            frames_.template Top<Frame>()->count++;
+        return true;
+    }
+
+    //! Forwards the kept numbers of a run, as runs of consecutive kept numbers.
+    template <typename T>
+    bool Numbers(const T* values, SizeType count) {
+        SizeType begin = 0;
+        for (SizeType i = 0; i < count; i++)
+            if (!BeginValue(false)) {
+                if (!ForwardNumbers(values + begin, i - begin))
+                    return false;
+                begin = i + 1;
+            }
+        return ForwardNumbers(values + begin, count - begin);
+    }
+
+    bool ForwardNumbers(const double* values, SizeType count) { return count == 0 || handler_.Doubles(values, count); }
+    bool ForwardNumbers(const int64_t* values, SizeType count) { return count == 0 || handler_.Int64s(values, count); }
+
+    bool ForwardPendingKey() {
+        if (!keyPending_)
+            return true;
+        keyPending_ = false;
+        return handler_.Key(key_, keyLength_, keyCopy_);
+    }
+
+    bool PushFrame(bool isArray) {
+        Frame* f = frames_.template Push<Frame>();
+        f->aliveBegin = static_cast<SizeType>(alive_.GetSize() / sizeof(SizeType)) - pendingAliveCount_;
+        f->aliveCount = pendingAliveCount_;
+        f->count = 0;
+        f->index = 0;
+        f->isArray = isArray;
+        f->included = nextIncluded_;
+        pendingAliveCount_ = 0;
+        return true;
+    }
+
+    bool EndContainer() {
+        if (skipDepth_ > 0) {
+            skipDepth_--;
+            return false;
+        }
+        return true;
+    }
+
+    SizeType PopFrame() {
+        Frame* f = frames_.template Pop<Frame>(1);
+        alive_.template Pop<SizeType>(f->aliveCount);
+        return f->count;
+    }
+
+    const PathFilterType& filter_;
+    OutputHandler& handler_;
+    internal::Stack<StateAllocator> frames_;
+    internal::Stack<StateAllocator> alive_;
+    internal::Stack<StateAllocator> keyBuffer_;
+    const Ch* key_;
+    SizeType keyLength_;
+    bool keyCopy_;
+    bool keyPending_;
+    SizeType pendingAliveCount_;
+    unsigned skipDepth_;
+    Next next_;
+    bool nextIncluded_;
+    bool skipRequest_;
+    size_t skippedCount_;
+};
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#ifdef _MSC_VER
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_PATHFILTER_H_
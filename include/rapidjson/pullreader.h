@@ -0,0 +1,284 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_PULLREADER_H_
+#define RAPIDJSON_PULLREADER_H_
+
+#include "reader.h"
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// PullToken
+
+//! Type of the current token of a GenericPullReader.
+enum PullToken {
+    kPullTokenNone = 0,     //!< No token: before the first one, at the end of the text, after an error or a skip.
+    kPullTokenNull,         //!< null
+    kPullTokenFalse,        //!< false
+    kPullTokenTrue,         //!< true
+    kPullTokenNumber,       //!< Number, see GenericPullReader::IsInt() and others.
+    kPullTokenString,       //!< String value.
+    kPullTokenKey,          //!< Name of a member.
+    kPullTokenStartObject,  //!< Beginning of an object.
+    kPullTokenEndObject,    //!< End of an object.
+    kPullTokenStartArray,   //!< Beginning of an array.
+    kPullTokenEndArray      //!< End of an array.
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericPullReader
+
+//! Pull parser returning the tokens of a JSON text one at a time.
+/*!
+    Instead of pushing events to a handler, the caller asks for each token
+    with Next() and reads it from the pull reader. It is built on
+    GenericReader::IterativeParseNext(), so nesting depth only costs memory
+    of the reader's stack, and it can stop anywhere in the text.
+
+    Skip() passes over the rest of an object or array just started, or over
+    the value of a member after its name, without decoding it.
+
+    \code
+    StringStream s(json);
+    PullReader r(s);
+    while (r.Next())
+        if (r.GetToken() == kPullTokenKey && std::strcmp(r.GetString(), "wanted") != 0)
+            r.Skip();
+    \endcode
+
+    With \ref kParseInsituFlag, strings and names point into the parsed
+    buffer and stay valid as long as it does. Otherwise they are decoded into
+    the stack of the reader and only valid until the next call to Next().
+    With \ref kParseNumbersAsStringsFlag, numbers are returned as strings.
+
+    \tparam SourceEncoding Encoding of the input stream.
+    \tparam TargetEncoding Encoding of the strings returned.
+    \tparam InputStream Type of input stream, implementing Stream concept.
+    \tparam parseFlags Combination of \ref ParseFlag. \ref kParseSkipValueFlag
+        and \ref kParseStructuralIndexFlag are ignored.
+    \tparam StackAllocator Allocator type for the stack of the reader.
+*/
+template <typename SourceEncoding, typename TargetEncoding, typename InputStream, unsigned parseFlags = kParseDefaultFlags, typename StackAllocator = CrtAllocator>
+class GenericPullReader {
+public:
+    typedef typename TargetEncoding::Ch Ch; //!< Character type of the strings returned.
+    typedef GenericReader<SourceEncoding, TargetEncoding, StackAllocator> ReaderType; //!< Reader type used for parsing.
+
+    //! Constructor.
+    /*! \param is Input stream to be parsed, must outlive the pull reader.
+        \param stackAllocator Optional allocator for allocating stack memory.
+        \param stackCapacity Initial capacity of the stack in bytes.
+    */
+    explicit GenericPullReader(InputStream& is, StackAllocator* stackAllocator = 0, size_t stackCapacity = kDefaultStackCapacity) :
+        is_(is), reader_(stackAllocator, stackCapacity), handler_()
+    {
+        reader_.IterativeParseInit();
+    }
+
+    //! Advance to the next token.
+    /*! \return \c false at the end of the text or on error, see HasParseError().
+    */
+    bool Next() {
+        handler_.token = kPullTokenNone;
+        if (reader_.IterativeParseComplete())
+            return false;
+        if (!reader_.template IterativeParseNext<parseFlags>(is_, handler_)) {
+            handler_.token = kPullTokenNone;
+            return false;
+        }
+        return true;
+    }
+
+    //! Skip the current value.
+    /*! On \c kPullTokenStartObject or \c kPullTokenStartArray, skips to the end of
+        the object or array, and on \c kPullTokenKey, skips the value of the member.
+        The next token is the one following the skipped value. Does nothing for
+        other tokens.
+        \return Whether the parsing is successful.
+    */
+    bool Skip() {
+        if (handler_.token == kPullTokenStartObject || handler_.token == kPullTokenStartArray)
+            handler_.depth--;
+        handler_.token = kPullTokenNone;
+        return reader_.template IterativeParseSkip<parseFlags>(is_);
+    }
+
+    //! Parse the next element of the current array as a whole.
+    /*! Inside an array, on its \c kPullTokenStartArray or after an element,
+        sends all the events of the next element to \c handler as
+        GenericReader::Parse() would, e.g. into a document with
+        GenericDocument::Populate(). The current token becomes \c kPullTokenNone.
+        \return \c false at the end of the array, whose \c kPullTokenEndArray
+            is returned by the next call to Next(), or on error.
+    */
+    template <typename Handler>
+    bool ParseElement(Handler& handler) {
+        handler_.token = kPullTokenNone;
+        return reader_.template IterativeParseElement<parseFlags>(is_, handler);
+    }
+
+    //! Whether the whole text has been parsed, or an error occurred.
+    bool IsDone() const { return reader_.IterativeParseComplete(); }
+
+    //! Type of the current token.
+    PullToken GetToken() const { return handler_.token; }
+
+    //! Number of objects and arrays left open after the current token.
+    /*! It is 1 on the \c kPullTokenStartObject of the root and on its members,
+        and 0 on its \c kPullTokenEndObject.
+    */
+    unsigned GetDepth() const { return handler_.depth; }
+
+    //!@name Number
+    //@{
+
+    bool IsInt() const { return handler_.token == kPullTokenNumber && (handler_.numberFlags & kIntFlag) != 0; }
+    bool IsUint() const { return handler_.token == kPullTokenNumber && (handler_.numberFlags & kUintFlag) != 0; }
+    bool IsInt64() const { return handler_.token == kPullTokenNumber && (handler_.numberFlags & kInt64Flag) != 0; }
+    bool IsUint64() const { return handler_.token == kPullTokenNumber && (handler_.numberFlags & kUint64Flag) != 0; }
+    bool IsDouble() const { return handler_.token == kPullTokenNumber && (handler_.numberFlags & kDoubleFlag) != 0; }
+
+    int GetInt() const { RAPIDJSON_ASSERT(IsInt()); return static_cast<int>(handler_.number.i64); }
+    unsigned GetUint() const { RAPIDJSON_ASSERT(IsUint()); return static_cast<unsigned>(handler_.number.u64); }
+    int64_t GetInt64() const { RAPIDJSON_ASSERT(IsInt64()); return handler_.number.i64; }
+    uint64_t GetUint64() const { RAPIDJSON_ASSERT(IsUint64()); return handler_.number.u64; }
+
+    //! Get the value as double type.
+    /*! \note Integers are converted, possibly losing precision beyond 53 bits.
+    */
+    double GetDouble() const {
+        RAPIDJSON_ASSERT(handler_.token == kPullTokenNumber && handler_.numberFlags != kStringFlag);
+        if (handler_.numberFlags & kDoubleFlag) return handler_.number.d;
+        if (handler_.numberFlags & kInt64Flag) return static_cast<double>(handler_.number.i64); // int64 covers all integers but large uint64
+        return static_cast<double>(handler_.number.u64);
+    }
+
+    //@}
+
+    //!@name String
+    //@{
+
+    //! String of a \c kPullTokenString or \c kPullTokenKey, or number with \ref kParseNumbersAsStringsFlag.
+    const Ch* GetString() const { RAPIDJSON_ASSERT(handler_.str != 0); return handler_.str; }
+
+    //! Length of GetString() in code units, not counting the null terminator.
+    SizeType GetStringLength() const { RAPIDJSON_ASSERT(handler_.str != 0); return handler_.length; }
+
+    //@}
+
+    //! Whether a parse error has occured.
+    bool HasParseError() const { return reader_.HasParseError(); }
+
+    //! Get the \ref ParseErrorCode of the parsing.
+    ParseErrorCode GetParseErrorCode() const { return reader_.GetParseErrorCode(); }
+
+    //! Get the position of the parsing error in input, 0 otherwise.
+    size_t GetErrorOffset() const { return reader_.GetErrorOffset(); }
+
+private:
+    // Prohibit copy constructor & assignment operator.
+    GenericPullReader(const GenericPullReader&);
+    GenericPullReader& operator=(const GenericPullReader&);
+
+    enum {
+        kIntFlag = 0x01,
+        kUintFlag = 0x02,
+        kInt64Flag = 0x04,
+        kUint64Flag = 0x08,
+        kDoubleFlag = 0x10,
+        kStringFlag = 0x20     // kParseNumbersAsStringsFlag
+    };
+
+    // Records the event of each call to IterativeParseNext() as the current token.
+    struct TokenHandler : BaseReaderHandler<TargetEncoding, TokenHandler> {
+        TokenHandler() : token(kPullTokenNone), depth(), numberFlags(), number(), str(), length() {}
+
+        bool Null() { return Set(kPullTokenNull); }
+        bool Bool(bool b) { return Set(b ? kPullTokenTrue : kPullTokenFalse); }
+        bool Int(int i) {
+            number.i64 = i;
+            return SetNumber(i >= 0 ? kIntFlag | kUintFlag | kInt64Flag | kUint64Flag : kIntFlag | kInt64Flag);
+        }
+        bool Uint(unsigned u) {
+            number.u64 = u;
+            return SetNumber(kUintFlag | kInt64Flag | kUint64Flag | (u <= 0x7FFFFFFFu ? kIntFlag : 0));
+        }
+        bool Int64(int64_t i) {
+            number.i64 = i;
+            unsigned flags = kInt64Flag;
+            if (i >= 0) {
+                flags |= kUint64Flag;
+                if (i <= static_cast<int64_t>(0xFFFFFFFFu)) flags |= kUintFlag;
+            }
+            if (i >= static_cast<int64_t>(-2147483647) - 1 && i <= 0x7FFFFFFF) flags |= kIntFlag;
+            return SetNumber(flags);
+        }
+        bool Uint64(uint64_t u) {
+            number.u64 = u;
+            unsigned flags = kUint64Flag;
+            if (u <= RAPIDJSON_UINT64_C2(0x7FFFFFFF, 0xFFFFFFFF)) flags |= kInt64Flag;
+            if (u <= 0xFFFFFFFFu) flags |= kUintFlag;
+            if (u <= 0x7FFFFFFFu) flags |= kIntFlag;
+            return SetNumber(flags);
+        }
+        bool Double(double d) { number.d = d; return SetNumber(kDoubleFlag); }
+        bool RawNumber(const Ch* s, SizeType len, bool) { numberFlags = kStringFlag; return SetString(kPullTokenNumber, s, len); }
+        bool String(const Ch* s, SizeType len, bool) { return SetString(kPullTokenString, s, len); }
+        bool Key(const Ch* s, SizeType len, bool) { return SetString(kPullTokenKey, s, len); }
+        bool StartObject() { depth++; return Set(kPullTokenStartObject); }
+        bool EndObject(SizeType) { depth--; return Set(kPullTokenEndObject); }
+        bool StartArray() { depth++; return Set(kPullTokenStartArray); }
+        bool EndArray(SizeType) { depth--; return Set(kPullTokenEndArray); }
+
+        bool Set(PullToken t) { token = t; str = 0; length = 0; return true; }
+        bool SetNumber(unsigned flags) { numberFlags = flags; return Set(kPullTokenNumber); }
+        bool SetString(PullToken t, const Ch* s, SizeType len) { token = t; str = s; length = len; return true; }
+
+        PullToken token;
+        unsigned depth;
+        unsigned numberFlags;
+        union {
+            int64_t i64;
+            uint64_t u64;
+            double d;
+        } number;
+        const Ch* str;
+        SizeType length;
+    };
+
+    static const size_t kDefaultStackCapacity = 256;    //!< Default stack capacity in bytes.
+    InputStream& is_;
+    ReaderType reader_;
+    TokenHandler handler_;
+};
+
+//! Pull reader of UTF-8 strings, with default flags.
+typedef GenericPullReader<UTF8<>, UTF8<>, StringStream> PullReader;
+
+//! Pull reader of UTF-8 strings parsed in situ.
+typedef GenericPullReader<UTF8<>, UTF8<>, InsituStringStream, kParseInsituFlag> InsituPullReader;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_PULLREADER_H_
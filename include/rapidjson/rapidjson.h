@@ -320,11 +320,53 @@
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
-// RAPIDJSON_SSE2/RAPIDJSON_SSE42/RAPIDJSON_SIMD
+// RAPIDJSON_SCHUBFACH
+
+//! Use the Schubfach algorithm for double-to-string conversion.
+/*!
+    \ingroup RAPIDJSON_CONFIG
+
+    By default, \c Writer formats doubles with Grisu2, which produces digits
+    that round trip but, in rare cases, one more than necessary or not the
+    closest ones. Defining this macro to 1 selects Schubfach instead, which
+    always produces the shortest digits that round trip, closest to the
+    value. It is also faster, at the cost of a 10 kB table.
+
+    The output of both differs only in these rare cases, and
+    \c Writer::SetMaxDecimalPlaces() applies to either.
+*/
+#ifndef RAPIDJSON_SCHUBFACH
+#define RAPIDJSON_SCHUBFACH 0
+#endif // RAPIDJSON_SCHUBFACH
+
+///////////////////////////////////////////////////////////////////////////////
+// RAPIDJSON_ALLOCATION_STATS
+
+//! Collect statistics of the memory allocated by parsing.
+/*!
+    \ingroup RAPIDJSON_CONFIG
+
+    Defining this macro to 1 makes \c CrtAllocator and \c MemoryPoolAllocator
+    count their allocations and chunks, and the parsing stacks count their
+    allocations and record their peak size. The counters of the last parse
+    are returned by \c GenericDocument::GetAllocationStats() and
+    \c GenericReader::GetAllocationStats(), as an \c AllocationStats, which
+    helps choosing the chunk capacity of \c MemoryPoolAllocator and the stack
+    capacity of a document or a reader.
+
+    The counting has a small cost, so it is disabled by default. It must be
+    defined the same in all translation units of a program.
+*/
+#ifndef RAPIDJSON_ALLOCATION_STATS
+#define RAPIDJSON_ALLOCATION_STATS 0
+#endif // RAPIDJSON_ALLOCATION_STATS
+
+///////////////////////////////////////////////////////////////////////////////
+// RAPIDJSON_SSE2/RAPIDJSON_SSE42/RAPIDJSON_AVX2/RAPIDJSON_SIMD
 
 /*! \def RAPIDJSON_SIMD
     \ingroup RAPIDJSON_CONFIG
-    \brief Enable SSE2/SSE4.2 optimization.
+    \brief Enable SSE2/SSE4.2/AVX2 optimization.
 
     RapidJSON supports optimized implementations for some parsing operations
     based on the SSE2 or SSE4.2 SIMD extensions on modern Intel-compatible
@@ -341,9 +383,17 @@
 
     \c RAPIDJSON_SSE42 takes precedence, if both are defined.
 
+    Defining \c RAPIDJSON_AVX2 additionally uses 32-byte AVX2 instructions where
+    available (currently the structural indexer of \ref kParseStructuralIndexFlag
+    and the UTF-8 validation of \ref kParseValidateEncodingFlag), and implies
+    \c RAPIDJSON_SSE42.
+
     If any of these symbols is defined, RapidJSON defines the macro
     \c RAPIDJSON_SIMD to indicate the availability of the optimized code.
 */
+#if defined(RAPIDJSON_AVX2) && !defined(RAPIDJSON_SSE42)
+#define RAPIDJSON_SSE42
+#endif
 #if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42) \
     || defined(RAPIDJSON_DOXYGEN_RUNNING)
 #define RAPIDJSON_SIMD
@@ -572,6 +622,17 @@ RAPIDJSON_NAMESPACE_END
 #endif
 #endif // RAPIDJSON_HAS_CXX11_RANGE_FOR
 
+#ifndef RAPIDJSON_HAS_CXX11_THREAD
+#if defined(__clang__)
+#define RAPIDJSON_HAS_CXX11_THREAD (__cplusplus >= 201103L)
+#elif (defined(RAPIDJSON_GNUC) && (RAPIDJSON_GNUC >= RAPIDJSON_VERSION_CODE(4,7,0)) && defined(__GXX_EXPERIMENTAL_CXX0X__)) || \
+      (defined(_MSC_VER) && _MSC_VER >= 1700)
+#define RAPIDJSON_HAS_CXX11_THREAD 1
+#else
+#define RAPIDJSON_HAS_CXX11_THREAD 0
+#endif
+#endif // RAPIDJSON_HAS_CXX11_THREAD
+
 //!@endcond
 
 ///////////////////////////////////////////////////////////////////////////////
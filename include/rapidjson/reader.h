@@ -21,8 +21,11 @@
 #include "stream.h"
 #include "encodedstream.h"
 #include "internal/meta.h"
+#include "internal/digits.h"
 #include "internal/stack.h"
 #include "internal/strtod.h"
+#include "internal/structuralindex.h"
+#include <cstring>
 
 #if defined(RAPIDJSON_SIMD) && defined(_MSC_VER)
 #include <intrin.h>
@@ -150,6 +153,10 @@ enum ParseFlag {
     kParseCommentsFlag = 32,        //!< Allow one-line (//) and multi-line (/**/) comments.
     kParseNumbersAsStringsFlag = 64,    //!< Parse all numbers (ints/doubles) as strings.
     kParseTrailingCommasFlag = 128, //!< Allow trailing commas at the end of objects and arrays.
+    kParseSkipValueFlag = 256,      //!< Let the handler skip values it does not want, see Handler::SkipValue().
+    kParseStructuralIndexFlag = 512,    //!< Index the structural characters of an in-memory string with SIMD before parsing, see GenericReader::Parse().
+    kParsePackNumberArraysFlag = 1024,  //!< Store arrays of numbers packed in GenericDocument, see GenericValue::IsPackedArray(). Ignored by GenericReader.
+    kParseNumberRunsFlag = 2048,    //!< Report consecutive numbers in arrays together, by Handler::Doubles() and Handler::Int64s().
     kParseDefaultFlags = RAPIDJSON_PARSE_DEFAULT_FLAGS  //!< Default parse flags. Can be customized by defining RAPIDJSON_PARSE_DEFAULT_FLAGS
 };
 
@@ -179,8 +186,33 @@ concept Handler {
     bool EndObject(SizeType memberCount);
     bool StartArray();
     bool EndArray(SizeType elementCount);
+    /// only called with kParseSkipValueFlag, see below
+    bool SkipValue();
+    /// only called with kParseNumberRunsFlag, see below
+    bool Doubles(const double* values, SizeType count);
+    bool Int64s(const int64_t* values, SizeType count);
 };
 \endcode
+
+    With \ref kParseSkipValueFlag, the reader calls \c SkipValue() right after
+    each successful \c Key(), \c StartObject() and \c StartArray(). If it returns
+    true, the reader skips the member value following the key, or the rest of the
+    object/array including its closing bracket, without sending any event (there
+    is no \c EndObject() or \c EndArray() for a skipped object/array). Skipped
+    text is only scanned for string and bracket boundaries: numbers are not
+    converted, strings are not decoded, and the content is not validated.
+    The member and element counts of the enclosing object/array still include
+    the skipped value.
+
+    With \ref kParseNumberRunsFlag, consecutive numbers in an array are parsed
+    in a loop of their own, and reported together by \c Doubles() or \c Int64s()
+    instead of one \c Double(), \c Int(), \c Uint(), \c Int64() or \c Uint64()
+    call each. A run is split when the numbers change between integers and
+    doubles, and in batches of at most 256 numbers. Integers above the range of
+    \c int64_t are still reported by \c Uint64(). Each number counts as one element
+    in \c EndArray(). Numbers outside of arrays, and all numbers with
+    \ref kParseIterativeFlag, \ref kParseStructuralIndexFlag or
+    \ref kParseNumbersAsStringsFlag, are reported one by one.
 */
 ///////////////////////////////////////////////////////////////////////////////
 // BaseReaderHandler
@@ -211,6 +243,29 @@ struct BaseReaderHandler {
     bool EndObject(SizeType) { return static_cast<Override&>(*this).Default(); }
     bool StartArray() { return static_cast<Override&>(*this).Default(); }
     bool EndArray(SizeType) { return static_cast<Override&>(*this).Default(); }
+    /// enabled via kParseSkipValueFlag, skips nothing by default
+    bool SkipValue() { return false; }
+    /// enabled via kParseNumberRunsFlag, reports each number by default
+    bool Doubles(const double* values, SizeType count) {
+        for (SizeType i = 0; i < count; i++)
+            if (!static_cast<Override&>(*this).Double(values[i]))
+                return false;
+        return true;
+    }
+    /// enabled via kParseNumberRunsFlag, reports each number as it would be without the flag by default
+    bool Int64s(const int64_t* values, SizeType count) {
+        for (SizeType i = 0; i < count; i++) {
+            const int64_t v = values[i];
+            bool cont;
+            if (v < 0)
+                cont = v >= -static_cast<int64_t>(2147483647) - 1 ? static_cast<Override&>(*this).Int(static_cast<int>(v)) : static_cast<Override&>(*this).Int64(v);
+            else
+                cont = v <= static_cast<int64_t>(4294967295u) ? static_cast<Override&>(*this).Uint(static_cast<unsigned>(v)) : static_cast<Override&>(*this).Uint64(static_cast<uint64_t>(v));
+            if (!cont)
+                return false;
+        }
+        return true;
+    }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -248,6 +303,63 @@ private:
     StreamLocalCopy& operator=(const StreamLocalCopy&) /* = delete */;
 };
 
+//! Collects the numbers parsed in a run, see kParseNumberRunsFlag.
+template<typename Handler>
+class NumberRunHandler {
+public:
+    // buffer_ is left uninitialized, only the first count_ numbers are read.
+    explicit NumberRunHandler(Handler& handler) : handler_(handler), count_(), isDouble_() {}
+
+    bool Int(int i) { return AddInt64(i); }
+    bool Uint(unsigned u) { return AddInt64(u); }
+    bool Int64(int64_t i) { return AddInt64(i); }
+    bool Uint64(uint64_t u) {
+        if (!(u & RAPIDJSON_UINT64_C2(0x80000000, 0x00000000)))
+            return AddInt64(static_cast<int64_t>(u));
+        return Flush() && handler_.Uint64(u);
+    }
+    bool Double(double d) {
+        if (RAPIDJSON_UNLIKELY((count_ != 0 && !isDouble_) || count_ == kCapacity) && !Flush())
+            return false;
+        isDouble_ = true;
+        buffer_.d[count_++] = d;
+        return true;
+    }
+    template <typename Ch>
+    bool RawNumber(const Ch*, SizeType, bool) { RAPIDJSON_ASSERT(false); return false; }
+
+    //! Reports the numbers collected.
+    bool Flush() {
+        if (count_ == 0)
+            return true;
+        const SizeType count = count_;
+        count_ = 0;
+        return isDouble_ ? handler_.Doubles(buffer_.d, count) : handler_.Int64s(buffer_.i, count);
+    }
+
+private:
+    NumberRunHandler(const NumberRunHandler&);
+    NumberRunHandler& operator=(const NumberRunHandler&);
+
+    static const SizeType kCapacity = 256;
+
+    bool AddInt64(int64_t i) {
+        if (RAPIDJSON_UNLIKELY((count_ != 0 && isDouble_) || count_ == kCapacity) && !Flush())
+            return false;
+        isDouble_ = false;
+        buffer_.i[count_++] = i;
+        return true;
+    }
+
+    Handler& handler_;
+    union {
+        double d[kCapacity];
+        int64_t i[kCapacity];
+    } buffer_;
+    SizeType count_;
+    bool isDouble_;
+};
+
 } // namespace internal
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -440,6 +552,87 @@ template<> inline void SkipWhitespace(EncodedInputStream<UTF8<>, MemoryStream>&
 }
 #endif // RAPIDJSON_SIMD
 
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+//! Scan JSON text for string and bracket boundaries with SSE2, classifying 16 characters at once.
+/*! Only quotes, backslashes, brackets and the null terminator are examined, other
+    characters (numbers, literals, string contents) are passed over a block at a time.
+    \param p Current position in a null-terminated string.
+    \param depth Nesting depth of brackets, updated while scanning.
+    \param inString Whether \c p is inside a string, updated while scanning.
+    \return The position of the character which would end the skip: the bracket closing
+        depth 1, the quote closing a string at depth 0, or the null terminator. That
+        character has not been processed, so \c depth and \c inString describe the state before it.
+*/
+inline const char* SkipStructure_SIMD(const char* p, unsigned& depth, bool& inString) {
+    // Aligned loads never cross a page boundary, so start from the enclosing 16-byte block
+    // and mask out the characters before p.
+    const char* base = reinterpret_cast<const char*>(reinterpret_cast<size_t>(p) & static_cast<size_t>(~15));
+    unsigned startMask = ~0u << (p - base);
+    unsigned escapeMask = ~0u;  // clears a character escaped by a backslash at the end of the previous block
+
+    #define C16(c) { c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c }
+    static const char structurals[6][16] = { C16('\"'), C16('\\'), C16('{'), C16('['), C16('}'), C16(']') };
+    #undef C16
+
+    const __m128i dq = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[0][0]));
+    const __m128i bs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[1][0]));
+    const __m128i lc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[2][0]));
+    const __m128i lb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[3][0]));
+    const __m128i rc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[4][0]));
+    const __m128i rb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&structurals[5][0]));
+    const __m128i zero = _mm_setzero_si128();
+
+    for (;; base += 16) {
+        const __m128i s = _mm_load_si128(reinterpret_cast<const __m128i *>(base));
+        const unsigned q = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(s, dq)));
+        const unsigned b = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(s, bs)));
+        const unsigned z = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(s, zero)));
+        const unsigned o = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(s, lc), _mm_cmpeq_epi8(s, lb))));
+        const unsigned c = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(s, rc), _mm_cmpeq_epi8(s, rb))));
+
+        unsigned m = (((q | b | o | c) & escapeMask) | z) & startMask;
+        startMask = escapeMask = ~0u;
+
+        while (m != 0) {
+#ifdef _MSC_VER
+            unsigned long i;
+            _BitScanForward(&i, m);
+#else
+            const unsigned i = static_cast<unsigned>(__builtin_ffs(static_cast<int>(m)) - 1);
+#endif
+            const unsigned bit = 1u << i;
+            m &= m - 1;
+
+            if (z & bit)
+                return base + i;
+            else if (inString) {
+                if (q & bit) {
+                    if (depth == 0)
+                        return base + i;
+                    inString = false;
+                }
+                else if (b & bit) {
+                    // Skip the escaped character, but never a null terminator.
+                    if (i == 15)
+                        escapeMask = ~1u;
+                    else
+                        m &= ~((bit << 1) & ~z);
+                }
+            }
+            else if (q & bit)
+                inString = true;
+            else if (o & bit)
+                depth++;
+            else if (c & bit) {
+                if (depth == 1)
+                    return base + i;
+                depth--;
+            }
+        }
+    }
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // GenericReader
 
@@ -468,7 +661,7 @@ public:
     /*! \param stackAllocator Optional allocator for allocating stack memory. (Only use for non-destructive parsing)
         \param stackCapacity stack capacity in bytes for storing a single decoded string.  (Only use for non-destructive parsing)
     */
-    GenericReader(StackAllocator* stackAllocator = 0, size_t stackCapacity = kDefaultStackCapacity) : stack_(stackAllocator, stackCapacity), parseResult_() {}
+    GenericReader(StackAllocator* stackAllocator = 0, size_t stackCapacity = kDefaultStackCapacity) : stack_(stackAllocator, stackCapacity), index_(stackAllocator, 0), parseResult_(), state_(IterativeParsingStartState) {}
 
     //! Parse JSON text.
     /*! \tparam parseFlags Combination of \ref ParseFlag.
@@ -477,9 +670,27 @@ public:
         \param is Input stream to be parsed.
         \param handler The handler to receive events.
         \return Whether the parsing is successful.
+
+        With \ref kParseStructuralIndexFlag, a \c StringStream or \c InsituStringStream is parsed
+        in two stages: the offsets of all structural characters and value starts are collected
+        first, 64 bytes at a time with SIMD (\c RAPIDJSON_AVX2, \c RAPIDJSON_SSE42 or
+        \c RAPIDJSON_SSE2) if enabled, then the events are generated walking that index
+        instead of the text between tokens. The index needs 4 bytes per token, kept by the
+        reader for reuse. The flag is ignored for other streams, and together with
+        \ref kParseCommentsFlag or \ref kParseStopWhenDoneFlag. It takes precedence over
+        \ref kParseIterativeFlag, as the second stage does not recurse either.
+        The flag is opt-in: building the index costs more than the second stage saves,
+        so it is currently slower than the default parse (see doc/dom.md).
     */
     template <unsigned parseFlags, typename InputStream, typename Handler>
     ParseResult Parse(InputStream& is, Handler& handler) {
+#if RAPIDJSON_ALLOCATION_STATS
+        stack_.ResetStats();
+        index_.ResetStats();
+#endif
+        if ((parseFlags & kParseStructuralIndexFlag) && !(parseFlags & (kParseCommentsFlag | kParseStopWhenDoneFlag)))
+            return StructuralIndexParse<parseFlags>(is, handler);
+
         if (parseFlags & kParseIterativeFlag)
             return IterativeParse<parseFlags>(is, handler);
 
@@ -524,6 +735,157 @@ public:
         return Parse<kParseDefaultFlags>(is, handler);
     }
 
+    //! Initialize JSON text token-by-token parsing
+    /*! Resets the reader before calling \ref IterativeParseNext() on a new text.
+    */
+    void IterativeParseInit() {
+#if RAPIDJSON_ALLOCATION_STATS
+        stack_.ResetStats();
+        index_.ResetStats();
+#endif
+        parseResult_.Clear();
+        ClearStack();
+        state_ = IterativeParsingStartState;
+    }
+
+    //! Parse one token from JSON text
+    /*! Advances the iterative parsing state machine until the handler has received
+        one event, so that the caller controls the pace of parsing. Whitespace and
+        the delimiters (colon and commas) are consumed without an event.
+        \tparam parseFlags Combination of \ref ParseFlag, the same for all tokens of a text.
+            \ref kParseIterativeFlag and \ref kParseStructuralIndexFlag are implied and ignored, respectively.
+        \tparam InputStream Type of input stream, implementing Stream concept.
+        \tparam Handler Type of handler, implementing Handler concept.
+        \param is Input stream to be parsed.
+        \param handler The handler to receive the event.
+        \return Whether the parsing is successful. Once the root value has been
+            closed, \ref IterativeParseComplete() is true and the text is parsed.
+        \note Strings not parsed in situ are only valid during the event, or until
+            the next call if the handler keeps the pointer.
+    */
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    bool IterativeParseNext(InputStream& is, Handler& handler) {
+        RAPIDJSON_ASSERT(!IterativeParseComplete());
+        for (;;) {
+            SkipWhitespaceAndComments<parseFlags>(is);
+            if (RAPIDJSON_UNLIKELY(HasParseError()))
+                return IterativeParseFail();
+
+            if (RAPIDJSON_UNLIKELY(is.Peek() == '\0')) {
+                HandleError(state_, is);
+                return IterativeParseFail();
+            }
+
+            Token t = Tokenize(is.Peek());
+            IterativeParsingState n = Predict(state_, t);
+            IterativeParsingState d = Transit<parseFlags>(state_, t, n, is, handler);
+
+            if (RAPIDJSON_UNLIKELY(d == IterativeParsingErrorState)) {
+                HandleError(state_, is);
+                return IterativeParseFail();
+            }
+
+            state_ = d;
+            if (d == IterativeParsingFinishState)
+                return IterativeParseFinish<parseFlags>(is);
+
+            // Delimiters do not generate events, go on with the next token.
+            if (n != IterativeParsingKeyValueDelimiterState && n != IterativeParsingMemberDelimiterState && n != IterativeParsingElementDelimiterState)
+                return true;
+        }
+    }
+
+    //! Skip a value during token-by-token parsing
+    /*! Right after \c StartObject() or \c StartArray(), skips the rest of the object or
+        array including its end, and right after \c Key(), skips the value of the member.
+        Only string and bracket boundaries are scanned, and the handler receives no
+        event. Does nothing after other events.
+        \tparam parseFlags Same flags as for \ref IterativeParseNext().
+        \param is Input stream being parsed.
+        \return Whether the parsing is successful.
+    */
+    template <unsigned parseFlags, typename InputStream>
+    bool IterativeParseSkip(InputStream& is) {
+        if (state_ == IterativeParsingObjectInitialState || state_ == IterativeParsingArrayInitialState) {
+            SkipStructure<parseFlags>(is, state_ == IterativeParsingObjectInitialState ? '{' : '[', 1, false);
+            if (RAPIDJSON_UNLIKELY(HasParseError()))
+                return IterativeParseFail();
+            // Restore the state as on ObjectFinish or ArrayFinish.
+            stack_.template Pop<SizeType>(1);
+            IterativeParsingState n = static_cast<IterativeParsingState>(*stack_.template Pop<SizeType>(1));
+            if (n == IterativeParsingStartState) {
+                state_ = IterativeParsingFinishState;
+                return IterativeParseFinish<parseFlags>(is);
+            }
+            state_ = n;
+        }
+        else if (state_ == IterativeParsingMemberKeyState) {
+            // Skip the colon and the value, as if the value had been parsed.
+            SkipWhitespaceAndComments<parseFlags>(is);
+            if (!HasParseError() && RAPIDJSON_UNLIKELY(!Consume(is, ':')))
+                RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorObjectMissColon, is.Tell());
+            if (!HasParseError())
+                SkipWhitespaceAndComments<parseFlags>(is);
+            if (!HasParseError())
+                SkipValueText<parseFlags>(is);
+            if (RAPIDJSON_UNLIKELY(HasParseError()))
+                return IterativeParseFail();
+            state_ = IterativeParsingMemberValueState;
+        }
+        return true;
+    }
+
+    //! Parse a whole element of an array during token-by-token parsing
+    /*! Inside an array, right after \c StartArray() or after an element, parses
+        the next element with the recursive parser and sends all its events to
+        \c handler, which may differ from the handler of \ref IterativeParseNext().
+        The comma before the element is consumed, while the closing bracket is
+        left for \ref IterativeParseNext(), which then calls \c EndArray().
+        \tparam parseFlags Same flags as for \ref IterativeParseNext().
+        \param is Input stream being parsed.
+        \param handler The handler to receive the events of the element.
+        \return \c true when an element has been parsed, \c false at the end of
+            the array or on error, see \ref HasParseError().
+    */
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    bool IterativeParseElement(InputStream& is, Handler& handler) {
+        RAPIDJSON_ASSERT(state_ == IterativeParsingArrayInitialState || state_ == IterativeParsingElementState);
+        SkipWhitespaceAndComments<parseFlags>(is);
+        if (RAPIDJSON_UNLIKELY(HasParseError()))
+            return IterativeParseFail();
+
+        if (state_ == IterativeParsingElementState) {
+            if (is.Peek() == ']')
+                return false;
+            if (RAPIDJSON_UNLIKELY(!Consume(is, ','))) {
+                RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorArrayMissCommaOrSquareBracket, is.Tell());
+                return IterativeParseFail();
+            }
+            // Update element count.
+            *stack_.template Top<SizeType>() = *stack_.template Top<SizeType>() + 1;
+            state_ = IterativeParsingElementDelimiterState;
+            SkipWhitespaceAndComments<parseFlags>(is);
+            if (RAPIDJSON_UNLIKELY(HasParseError()))
+                return IterativeParseFail();
+        }
+
+        // A trailing comma is checked by IterativeParseNext() on the bracket.
+        if (is.Peek() == ']')
+            return false;
+        ParseValue<parseFlags>(is, handler);
+        if (RAPIDJSON_UNLIKELY(HasParseError()))
+            return IterativeParseFail();
+        state_ = IterativeParsingElementState;
+        return true;
+    }
+
+    //! Check if token-by-token parsing has finished
+    /*! \return Whether the root value has been parsed, or an error occurred.
+    */
+    RAPIDJSON_FORCEINLINE bool IterativeParseComplete() const {
+        return state_ == IterativeParsingFinishState || state_ == IterativeParsingErrorState;
+    }
+
     //! Whether a parse error has occured in the last parsing.
     bool HasParseError() const { return parseResult_.IsError(); }
 
@@ -533,6 +895,22 @@ public:
     //! Get the position of last parsing error in input, 0 otherwise.
     size_t GetErrorOffset() const { return parseResult_.Offset(); }
 
+#if RAPIDJSON_ALLOCATION_STATS
+    //! Get the memory allocated for the parsing stacks by the last parsing.
+    /*! Only the fields about the stacks are set: the peak size is the one of
+        the stack holding decoded strings, which \c stackCapacity of the
+        constructor is the initial capacity of.
+        \note Requires \ref RAPIDJSON_ALLOCATION_STATS.
+    */
+    AllocationStats GetAllocationStats() const {
+        AllocationStats stats;
+        stats.stackResizeCount = stack_.GetResizeCount() + index_.GetResizeCount();
+        stats.stackBytes = stack_.GetResizeBytes() + index_.GetResizeBytes();
+        stats.peakStackSize = stack_.GetPeakSize();
+        return stats;
+    }
+#endif
+
 protected:
     void SetParseError(ParseErrorCode code, size_t offset) { parseResult_.Set(code, offset); }
 
@@ -541,7 +919,10 @@ private:
     GenericReader(const GenericReader&);
     GenericReader& operator=(const GenericReader&);
 
-    void ClearStack() { stack_.Clear(); }
+    void ClearStack() {
+        stack_.Clear();
+        index_.Clear();
+    }
 
     // clear stack on any exit from ParseStream, e.g. due to exception
     struct ClearStackOnExit {
@@ -590,6 +971,11 @@ private:
         if (RAPIDJSON_UNLIKELY(!handler.StartObject()))
             RAPIDJSON_PARSE_ERROR(kParseErrorTermination, is.Tell());
 
+        if (SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>())) {
+            SkipStructure<parseFlags>(is, '{', 1, false);
+            return;
+        }
+
         SkipWhitespaceAndComments<parseFlags>(is);
         RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
@@ -606,6 +992,8 @@ private:
             ParseString<parseFlags>(is, handler, true);
             RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
+            const bool skip = SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>());
+
             SkipWhitespaceAndComments<parseFlags>(is);
             RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
@@ -615,7 +1003,10 @@ private:
             SkipWhitespaceAndComments<parseFlags>(is);
             RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
-            ParseValue<parseFlags>(is, handler);
+            if (skip)
+                SkipValueText<parseFlags>(is);
+            else
+                ParseValue<parseFlags>(is, handler);
             RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
             SkipWhitespaceAndComments<parseFlags>(is);
@@ -658,6 +1049,11 @@ private:
         if (RAPIDJSON_UNLIKELY(!handler.StartArray()))
             RAPIDJSON_PARSE_ERROR(kParseErrorTermination, is.Tell());
 
+        if (SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>())) {
+            SkipStructure<parseFlags>(is, '[', 1, false);
+            return;
+        }
+
         SkipWhitespaceAndComments<parseFlags>(is);
         RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
@@ -668,6 +1064,10 @@ private:
         }
 
         for (SizeType elementCount = 0;;) {
+            if (ParseNumberRun<parseFlags>(is, handler, elementCount,
+                    internal::BoolType<(parseFlags & kParseNumberRunsFlag) != 0 && (parseFlags & kParseNumbersAsStringsFlag) == 0>()))
+                return;
+
             ParseValue<parseFlags>(is, handler);
             RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
 
@@ -698,6 +1098,53 @@ private:
         }
     }
 
+    // Parse the elements of an array from the current one on while they are numbers,
+    // reporting them together, with kParseNumberRunsFlag.
+    // Returns true when the array is done, or on error, and false before an element
+    // which is not a number.
+    template<unsigned parseFlags, typename InputStream, typename Handler>
+    bool ParseNumberRun(InputStream& is, Handler& handler, SizeType& elementCount, internal::TrueType) {
+        if (!IsNumberStart(is.Peek()))
+            return false;
+
+        internal::NumberRunHandler<Handler> run(handler);
+        for (;;) {
+            ParseNumber<parseFlags>(is, run);
+            RAPIDJSON_PARSE_ERROR_EARLY_RETURN(true);
+
+            ++elementCount;
+            SkipWhitespaceAndComments<parseFlags>(is);
+            RAPIDJSON_PARSE_ERROR_EARLY_RETURN(true);
+
+            bool end;
+            if (Consume(is, ',')) {
+                SkipWhitespaceAndComments<parseFlags>(is);
+                RAPIDJSON_PARSE_ERROR_EARLY_RETURN(true);
+                if (IsNumberStart(is.Peek()))
+                    continue;
+                end = (parseFlags & kParseTrailingCommasFlag) && Consume(is, ']');
+            }
+            else if (Consume(is, ']'))
+                end = true;
+            else {
+                RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorArrayMissCommaOrSquareBracket, is.Tell());
+                return true;
+            }
+
+            if (RAPIDJSON_UNLIKELY(!run.Flush() || (end && !handler.EndArray(elementCount)))) {
+                RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorTermination, is.Tell());
+                return true;
+            }
+            return end;
+        }
+    }
+
+    template<unsigned parseFlags, typename InputStream, typename Handler>
+    static RAPIDJSON_FORCEINLINE bool ParseNumberRun(InputStream&, Handler&, SizeType&, internal::FalseType) { return false; }
+
+    template<typename Ch>
+    static RAPIDJSON_FORCEINLINE bool IsNumberStart(Ch c) { return c == '-' || (c >= '0' && c <= '9'); }
+
     template<unsigned parseFlags, typename InputStream, typename Handler>
     void ParseNull(InputStream& is, Handler& handler) {
         RAPIDJSON_ASSERT(is.Peek() == 'n');
@@ -851,6 +1298,8 @@ private:
             // Scan and copy string before "\\\"" or < 0x20. This is an optional optimzation.
             if (!(parseFlags & kParseValidateEncodingFlag))
                 ScanCopyUnescapedString(is, os);
+            else if (internal::IsSame<SEncoding, UTF8<> >::Value)
+                ScanCopyValidUnescapedString(is, os);
 
             Ch c = is.Peek();
             if (RAPIDJSON_UNLIKELY(c == '\\')) {    // Escape
@@ -906,7 +1355,35 @@ private:
             // Do nothing for generic version
     }
 
+    template<typename InputStream, typename OutputStream>
+    static RAPIDJSON_FORCEINLINE void ScanCopyValidUnescapedString(InputStream&, OutputStream&) {
+            // Do nothing for generic version
+    }
+
 #if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+    // Scan and copy as ScanCopyUnescapedString(), then validate the copied run of UTF-8 at once.
+    // The run ends before an ASCII character, so a valid run holds whole code points. On an
+    // invalid sequence, the streams go back to it for the byte by byte validation to report.
+    static RAPIDJSON_FORCEINLINE void ScanCopyValidUnescapedString(StringStream& is, StackStream<char>& os) {
+        const char* start = is.src_;
+        ScanCopyUnescapedString(is, os);
+        is.src_ = start + internal::FindInvalidUTF8(start, static_cast<size_t>(is.src_ - start));
+    }
+
+    static RAPIDJSON_FORCEINLINE void ScanCopyValidUnescapedString(InsituStringStream& is, InsituStringStream& os) {
+        char* src = is.src_;
+        char* dst = is.dst_;
+        ScanCopyUnescapedString(is, os);
+        const size_t length = static_cast<size_t>(is.dst_ - dst);
+        const size_t valid = internal::FindInvalidUTF8(dst, length);
+        if (RAPIDJSON_UNLIKELY(valid != length)) {
+            // Moving the run may have overwritten its source, which the error is reported from.
+            std::memmove(src + valid, dst + valid, length - valid);
+            is.src_ = src + valid;
+            is.dst_ = dst + valid;
+        }
+    }
+
     // StringStream -> StackStream<char>
     static RAPIDJSON_FORCEINLINE void ScanCopyUnescapedString(StringStream& is, StackStream<char>& os) {
         const char* p = is.src_;
@@ -1078,6 +1555,10 @@ private:
         RAPIDJSON_FORCEINLINE Ch TakePush() { return is.Take(); }
         RAPIDJSON_FORCEINLINE Ch Take() { return is.Take(); }
 		  RAPIDJSON_FORCEINLINE void Push(char) {}
+        RAPIDJSON_FORCEINLINE void PushSignificand(uint64_t, size_t) {}
+
+        //! Takes up to eight digits at once, returns how many (0 if not supported by the stream).
+        RAPIDJSON_FORCEINLINE unsigned TakeDigits(uint32_t& value, unsigned& zeros) { return GenericReader::TakeDigits(is, value, zeros); }
 
         size_t Tell() { return is.Tell(); }
         size_t Length() { return 0; }
@@ -1105,6 +1586,16 @@ private:
             stackStream.Put(c);
         }
 
+        //! Pushes the digits taken so far without backup, from their value.
+        /*! \param significand Value of the digits.
+            \param digitCount Number of digits, including leading zeros.
+        */
+        void PushSignificand(uint64_t significand, size_t digitCount) {
+            char* begin = static_cast<char*>(stackStream.Push(static_cast<SizeType>(digitCount)));
+            for (char* p = begin + digitCount; p != begin; significand /= 10)
+                *--p = static_cast<char>('0' + significand % 10);
+        }
+
         size_t Length() { return stackStream.Length(); }
 
         const char* Pop() {
@@ -1124,8 +1615,44 @@ private:
         ~NumberStream() {}
 
         RAPIDJSON_FORCEINLINE Ch Take() { return Base::TakePush(); }
+        RAPIDJSON_FORCEINLINE void PushSignificand(uint64_t, size_t) {} // Already pushed by Take()
+
+        // The taken characters would have to be pushed as well.
+        RAPIDJSON_FORCEINLINE unsigned TakeDigits(uint32_t&, unsigned&) { return 0; }
     };
 
+    template<typename InputStream>
+    static RAPIDJSON_FORCEINLINE unsigned TakeDigits(InputStream&, uint32_t&, unsigned&) {
+        // Digits are taken one by one for generic streams
+        return 0;
+    }
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+    // Contiguous null-terminated buffers: classify up to 16 digits at once and convert up to 8.
+    template<typename Ch>
+    static RAPIDJSON_FORCEINLINE unsigned TakeDigits(Ch*& src, uint32_t& value, unsigned& zeros) {
+        unsigned count = internal::CountDigits(src, zeros);
+        if (count == 0)
+            return 0;
+        if (count > 8) {
+            count = 8;
+            if (zeros > 8)
+                zeros = 8;
+        }
+        value = internal::ParseDigits(src, count);
+        src += count;
+        return count;
+    }
+
+    static RAPIDJSON_FORCEINLINE unsigned TakeDigits(StringStream& is, uint32_t& value, unsigned& zeros) {
+        return TakeDigits(is.src_, value, zeros);
+    }
+
+    static RAPIDJSON_FORCEINLINE unsigned TakeDigits(InsituStringStream& is, uint32_t& value, unsigned& zeros) {
+        return TakeDigits(is.src_, value, zeros);
+    }
+#endif
+
     template<unsigned parseFlags, typename InputStream, typename Handler>
     void ParseNumber(InputStream& is, Handler& handler) {
         internal::StreamLocalCopy<InputStream> copy(is);
@@ -1148,10 +1675,18 @@ private:
         int significandDigit = 0;
         if (RAPIDJSON_UNLIKELY(s.Peek() == '0')) {
             i = 0;
-            s.TakePush();
+            s.Take();
         }
         else if (RAPIDJSON_LIKELY(s.Peek() >= '1' && s.Peek() <= '9')) {
-            i = static_cast<unsigned>(s.TakePush() - '0');
+            i = static_cast<unsigned>(s.Take() - '0');
+
+            // Up to eight more digits cannot overflow.
+            uint32_t digits;
+            unsigned zeros;
+            if (unsigned count = s.TakeDigits(digits, zeros)) {
+                i = i * internal::Pow10Digits(count) + digits;
+                significandDigit += static_cast<int>(count);
+            }
 
             if (minus)
                 while (RAPIDJSON_LIKELY(s.Peek() >= '0' && s.Peek() <= '9')) {
@@ -1162,7 +1697,7 @@ private:
                             break;
                         }
                     }
-                    i = i * 10 + static_cast<unsigned>(s.TakePush() - '0');
+                    i = i * 10 + static_cast<unsigned>(s.Take() - '0');
                     significandDigit++;
                 }
             else
@@ -1174,7 +1709,7 @@ private:
                             break;
                         }
                     }
-                    i = i * 10 + static_cast<unsigned>(s.TakePush() - '0');
+                    i = i * 10 + static_cast<unsigned>(s.Take() - '0');
                     significandDigit++;
                 }
         }
@@ -1193,7 +1728,7 @@ private:
                             useDouble = true;
                             break;
                         }
-                    i64 = i64 * 10 + static_cast<unsigned>(s.TakePush() - '0');
+                    i64 = i64 * 10 + static_cast<unsigned>(s.Take() - '0');
                     significandDigit++;
                 }
             else
@@ -1204,13 +1739,16 @@ private:
                             useDouble = true;
                             break;
                         }
-                    i64 = i64 * 10 + static_cast<unsigned>(s.TakePush() - '0');
+                    i64 = i64 * 10 + static_cast<unsigned>(s.Take() - '0');
                     significandDigit++;
                 }
         }
 
         // Force double for big integer
         if (useDouble) {
+            // The significand is exact so far, the remaining digits are pushed for full precision.
+            // significandDigit counts all digits of the integer part but the first one.
+            s.PushSignificand(i64, static_cast<size_t>(significandDigit) + 1);
             while (RAPIDJSON_LIKELY(s.Peek() >= '0' && s.Peek() <= '9')) {
                 if (RAPIDJSON_UNLIKELY(d >= 1.7976931348623157e307)) // DBL_MAX / 10.0
                     RAPIDJSON_PARSE_ERROR(kParseErrorNumberTooBig, startOffset);
@@ -1222,7 +1760,8 @@ private:
         int expFrac = 0;
         size_t decimalPosition;
         if (Consume(s, '.')) {
-            decimalPosition = s.Length();
+            // Number of digits of the integer part, pushed or not yet.
+            decimalPosition = useDouble ? s.Length() : static_cast<size_t>(significandDigit) + 1;
 
             if (RAPIDJSON_UNLIKELY(!(s.Peek() >= '0' && s.Peek() <= '9')))
                 RAPIDJSON_PARSE_ERROR(kParseErrorNumberMissFraction, s.Tell());
@@ -1230,14 +1769,34 @@ private:
             if (!useDouble) {
 #if RAPIDJSON_64BIT
                 // Use i64 to store significand in 64-bit architecture
-                if (!use64bit)
+                if (!use64bit) {
                     i64 = i;
+                    use64bit = true;
+                }
 
+                // Take eight digits at a time while the significand surely stays below 2^53.
+                uint32_t digits;
+                unsigned zeros;
+                while (i64 <= 90071991) {
+                    const unsigned count = s.TakeDigits(digits, zeros);
+                    if (count == 0)
+                        break;
+                    significandDigit += static_cast<int>(i64 != 0 ? count : count - zeros);
+                    i64 = i64 * internal::Pow10Digits(count) + digits;
+                    expFrac -= static_cast<int>(count);
+                    if (count < 8)
+                        break;
+                }
+
+                // Full precision keeps the exact significand up to 19 digits.
+                const uint64_t maxSignificand = (parseFlags & kParseFullPrecisionFlag) ?
+                    RAPIDJSON_UINT64_C2(0x19999999, 0x99999998) :   // (2^64 - 10) / 10
+                    RAPIDJSON_UINT64_C2(0x1FFFFF, 0xFFFFFFFF);      // 2^53 - 1 for fast path
                 while (RAPIDJSON_LIKELY(s.Peek() >= '0' && s.Peek() <= '9')) {
-                    if (i64 > RAPIDJSON_UINT64_C2(0x1FFFFF, 0xFFFFFFFF)) // 2^53 - 1 for fast path
+                    if (i64 > maxSignificand)
                         break;
                     else {
-                        i64 = i64 * 10 + static_cast<unsigned>(s.TakePush() - '0');
+                        i64 = i64 * 10 + static_cast<unsigned>(s.Take() - '0');
                         --expFrac;
                         if (i64 != 0)
                             significandDigit++;
@@ -1247,9 +1806,16 @@ private:
                 d = static_cast<double>(i64);
 #else
                 // Use double to store significand in 32-bit architecture
-                d = static_cast<double>(use64bit ? i64 : i);
+                if (!use64bit) {
+                    i64 = i;
+                    use64bit = true;
+                }
+                d = static_cast<double>(i64);
 #endif
                 useDouble = true;
+
+                if (RAPIDJSON_UNLIKELY(s.Peek() >= '0' && s.Peek() <= '9'))
+                    s.PushSignificand(i64, decimalPosition + static_cast<size_t>(-expFrac));
             }
 
             while (RAPIDJSON_LIKELY(s.Peek() >= '0' && s.Peek() <= '9')) {
@@ -1339,8 +1905,12 @@ private:
 
            if (useDouble) {
                int p = exp + expFrac;
-               if (parseFlags & kParseFullPrecisionFlag)
-                   d = internal::StrtodFullPrecision(d, p, decimal, length, decimalPosition, exp);
+               if (parseFlags & kParseFullPrecisionFlag) {
+                   if (length == 0) // Every digit is in the significand
+                       d = internal::StrtodFullPrecision(d, p, use64bit ? i64 : i);
+                   else
+                       d = internal::StrtodFullPrecision(d, p, decimal, length, decimalPosition, exp);
+               }
                else
                    d = internal::StrtodNormalPrecision(d, p);
 
@@ -1382,6 +1952,319 @@ private:
         }
     }
 
+    // Ask the handler whether to skip the value, only with kParseSkipValueFlag.
+    template<typename Handler>
+    static RAPIDJSON_FORCEINLINE bool SkipRequested(Handler& handler, internal::TrueType) { return handler.SkipValue(); }
+
+    template<typename Handler>
+    static RAPIDJSON_FORCEINLINE bool SkipRequested(Handler&, internal::FalseType) { return false; }
+
+    // Skip any JSON value without generating events.
+    template<unsigned parseFlags, typename InputStream>
+    void SkipValueText(InputStream& is) {
+        Ch c = is.Peek();
+        if (c == '{' || c == '[') {
+            is.Take();
+            SkipStructure<parseFlags>(is, c, 1, false);
+        }
+        else if (c == '"') {
+            is.Take();
+            SkipStructure<parseFlags>(is, c, 0, true);
+        }
+        else {
+            // Literal or number, up to the next delimiter.
+            const size_t startOffset = is.Tell();
+            while ((c = is.Peek()) != ',' && c != '}' && c != ']' && c != '\0' &&
+                   c != ' ' && c != '\n' && c != '\r' && c != '\t' && !((parseFlags & kParseCommentsFlag) && c == '/'))
+                is.Take();
+            if (RAPIDJSON_UNLIKELY(is.Tell() == startOffset))
+                RAPIDJSON_PARSE_ERROR(kParseErrorValueInvalid, startOffset);
+        }
+    }
+
+    // Skip to the end of a string (open is '"') or of an object/array (open is its opening bracket).
+    // Only string and bracket boundaries are recognized.
+    template<unsigned parseFlags, typename InputStream>
+    void SkipStructure(InputStream& is, Ch open, unsigned depth, bool inString) {
+        if (!(parseFlags & kParseCommentsFlag))
+            ScanStructure(is, depth, inString);
+
+        const ParseErrorCode unclosed = open == '{' ? kParseErrorObjectMissCommaOrCurlyBracket :
+            open == '[' ? kParseErrorArrayMissCommaOrSquareBracket : kParseErrorStringMissQuotationMark;
+        for (;;) {
+            Ch c = is.Peek();
+            if (inString) {
+                if (c == '"') {
+                    is.Take();
+                    if (depth == 0)
+                        return;
+                    inString = false;
+                }
+                else if (c == '\\') {
+                    is.Take();
+                    if (is.Peek() != '\0')
+                        is.Take();
+                }
+                else if (RAPIDJSON_UNLIKELY(c == '\0'))
+                    RAPIDJSON_PARSE_ERROR(kParseErrorStringMissQuotationMark, is.Tell());
+                else
+                    is.Take();
+            }
+            else if (c == '"') {
+                is.Take();
+                inString = true;
+            }
+            else if (c == '{' || c == '[') {
+                is.Take();
+                depth++;
+            }
+            else if (c == '}' || c == ']') {
+                if (--depth == 0) {
+                    if (RAPIDJSON_UNLIKELY(c != (open == '{' ? '}' : ']')))
+                        RAPIDJSON_PARSE_ERROR(unclosed, is.Tell());
+                    is.Take();
+                    return;
+                }
+                is.Take();
+            }
+            else if (RAPIDJSON_UNLIKELY(c == '\0'))
+                RAPIDJSON_PARSE_ERROR(unclosed, is.Tell());
+            else if ((parseFlags & kParseCommentsFlag) && c == '/') {
+                SkipWhitespaceAndComments<parseFlags>(is);
+                RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+            }
+            else
+                is.Take();
+        }
+    }
+
+    template<typename InputStream>
+    static RAPIDJSON_FORCEINLINE void ScanStructure(InputStream&, unsigned&, bool&) {
+            // Do nothing for generic version
+    }
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+    static RAPIDJSON_FORCEINLINE void ScanStructure(StringStream& is, unsigned& depth, bool& inString) {
+        is.src_ = SkipStructure_SIMD(is.src_, depth, inString);
+    }
+
+    static RAPIDJSON_FORCEINLINE void ScanStructure(InsituStringStream& is, unsigned& depth, bool& inString) {
+        is.src_ = const_cast<char*>(SkipStructure_SIMD(is.src_, depth, inString));
+    }
+#endif
+
+    // Structural index parsing
+
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    ParseResult StructuralIndexParse(InputStream& is, Handler& handler) {
+        // Only null-terminated UTF-8 text in memory can be indexed.
+        return Parse<parseFlags & ~static_cast<unsigned>(kParseStructuralIndexFlag)>(is, handler);
+    }
+
+    template <unsigned parseFlags, typename Handler>
+    ParseResult StructuralIndexParse(StringStream& is, Handler& handler) {
+        return IndexedParse<parseFlags>(is, handler);
+    }
+
+    template <unsigned parseFlags, typename Handler>
+    ParseResult StructuralIndexParse(InsituStringStream& is, Handler& handler) {
+        return IndexedParse<parseFlags>(is, handler);
+    }
+
+    static RAPIDJSON_FORCEINLINE void Seek(StringStream& is, const char* p) { is.src_ = p; }
+    static RAPIDJSON_FORCEINLINE void Seek(InsituStringStream& is, const char* p) { is.src_ = const_cast<char*>(p); }
+
+    static RAPIDJSON_FORCEINLINE bool IsWhitespace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+    // Position of the token following a value which ended at end, given the next indexed token.
+    // Only whitespace may be in between, a character directly after the value is not indexed.
+    static RAPIDJSON_FORCEINLINE const char* NextToken(const char* end, const char* indexed) {
+        RAPIDJSON_ASSERT(end <= indexed);
+        return end == indexed || IsWhitespace(*end) ? indexed : end;
+    }
+
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    ParseResult IndexedParse(InputStream& is, Handler& handler) {
+        const size_t length = std::strlen(is.src_);
+        if (RAPIDJSON_UNLIKELY(length >= 0xFFFFFFFFu))
+            return Parse<parseFlags & ~static_cast<unsigned>(kParseStructuralIndexFlag)>(is, handler);
+
+        parseResult_.Clear();
+        ClearStackOnExit scope(*this);
+        const bool unclosedString = internal::StructuralIndexer::Build(is.src_, length, index_);
+        ParseIndexed<parseFlags>(is, handler, is.src_, index_.template Bottom<uint32_t>(), unclosedString);
+        return parseResult_;
+    }
+
+    // Generate the events by walking the index. Strings and numbers are still parsed by
+    // ParseString() and ParseNumber(). Containers are tracked with (isObject, count) pairs on stack_.
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    void ParseIndexed(InputStream& is, Handler& handler, const char* base, const uint32_t* token, bool unclosedString) {
+        if (RAPIDJSON_UNLIKELY(base[*token] == '\0')) {
+            Seek(is, base + *token);
+            RAPIDJSON_PARSE_ERROR(kParseErrorDocumentEmpty, is.Tell());
+        }
+
+        bool skip = false;
+        for (;;) {
+            const char* next;   // Token after the value
+            if (skip) {
+                SkipIndexedValue<parseFlags>(is, base, token, unclosedString);
+                RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+                next = base + *token;
+                skip = false;
+            }
+            else {
+                const char* p = base + *token++;
+                Seek(is, p);
+                if (*p == '{' || *p == '[') {
+                    const bool isObject = *p == '{';
+                    is.Take();
+                    if (RAPIDJSON_UNLIKELY(!(isObject ? handler.StartObject() : handler.StartArray())))
+                        RAPIDJSON_PARSE_ERROR(kParseErrorTermination, is.Tell());
+
+                    if (SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>())) {
+                        SkipIndexedContainer(is, base, token, *p, unclosedString);
+                        RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+                        next = base + *token;
+                    }
+                    else if (base[*token] == (isObject ? '}' : ']')) {
+                        Seek(is, base + *token++ + 1);
+                        if (RAPIDJSON_UNLIKELY(!(isObject ? handler.EndObject(0) : handler.EndArray(0))))
+                            RAPIDJSON_PARSE_ERROR(kParseErrorTermination, is.Tell());
+                        next = base + *token;
+                    }
+                    else {
+                        *stack_.template Push<SizeType>() = isObject;
+                        *stack_.template Push<SizeType>() = 0;
+                        if (isObject) {
+                            skip = ParseIndexedKey<parseFlags>(is, handler, base, token);
+                            RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+                        }
+                        continue;
+                    }
+                }
+                else {
+                    switch (*p) {
+                        case 'n': ParseNull  <parseFlags>(is, handler); break;
+                        case 't': ParseTrue  <parseFlags>(is, handler); break;
+                        case 'f': ParseFalse <parseFlags>(is, handler); break;
+                        case '"': ParseString<parseFlags>(is, handler); break;
+                        default : ParseNumber<parseFlags>(is, handler); break;
+                    }
+                    RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+                    next = NextToken(is.src_, base + *token);
+                }
+            }
+
+            // A value is complete, continue with the enclosing containers.
+            for (;;) {
+                if (stack_.Empty()) {
+                    if (RAPIDJSON_UNLIKELY(*next != '\0')) {
+                        Seek(is, next);
+                        RAPIDJSON_PARSE_ERROR(kParseErrorDocumentRootNotSingular, is.Tell());
+                    }
+                    return;
+                }
+
+                SizeType* frame = stack_.template Top<SizeType>() - 1;
+                const bool isObject = frame[0] != 0;
+                frame[1]++;
+                if (*next == ',') {
+                    next = base + *++token;
+                    if (!((parseFlags & kParseTrailingCommasFlag) && *next == (isObject ? '}' : ']'))) {
+                        if (isObject) {
+                            skip = ParseIndexedKey<parseFlags>(is, handler, base, token);
+                            RAPIDJSON_PARSE_ERROR_EARLY_RETURN_VOID;
+                        }
+                        break;
+                    }
+                }
+                else if (RAPIDJSON_UNLIKELY(*next != (isObject ? '}' : ']'))) {
+                    Seek(is, next);
+                    RAPIDJSON_PARSE_ERROR(isObject ? kParseErrorObjectMissCommaOrCurlyBracket : kParseErrorArrayMissCommaOrSquareBracket, is.Tell());
+                }
+
+                const SizeType count = frame[1];
+                stack_.template Pop<SizeType>(2);
+                Seek(is, next + 1);
+                if (RAPIDJSON_UNLIKELY(!(isObject ? handler.EndObject(count) : handler.EndArray(count))))
+                    RAPIDJSON_PARSE_ERROR(kParseErrorTermination, is.Tell());
+                next = base + *++token;
+            }
+        }
+    }
+
+    // Parse a member name and the colon, returns whether the handler asked to skip the value.
+    template <unsigned parseFlags, typename InputStream, typename Handler>
+    bool ParseIndexedKey(InputStream& is, Handler& handler, const char* base, const uint32_t*& token) {
+        Seek(is, base + *token);
+        if (RAPIDJSON_UNLIKELY(is.Peek() != '"')) {
+            RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorObjectMissName, is.Tell());
+            return false;
+        }
+
+        ParseString<parseFlags>(is, handler, true);
+        if (HasParseError())
+            return false;
+
+        const char* colon = NextToken(is.src_, base + *++token);
+        if (RAPIDJSON_UNLIKELY(*colon != ':')) {
+            Seek(is, colon);
+            RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorObjectMissColon, is.Tell());
+            return false;
+        }
+        ++token;
+        return SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>());
+    }
+
+    // Skip a member value, only strings and brackets are checked.
+    template <unsigned parseFlags, typename InputStream>
+    void SkipIndexedValue(InputStream& is, const char* base, const uint32_t*& token, bool unclosedString) {
+        const char c = base[*token];
+        if (c == '{' || c == '[') {
+            ++token;
+            SkipIndexedContainer(is, base, token, c, unclosedString);
+        }
+        else if (RAPIDJSON_UNLIKELY(c == '}' || c == ']' || c == ',' || c == ':' || c == '\0')) {
+            Seek(is, base + *token);
+            RAPIDJSON_PARSE_ERROR(kParseErrorValueInvalid, is.Tell());
+        }
+        else {
+            ++token;
+            // Only the last string of the text can be unclosed.
+            if (RAPIDJSON_UNLIKELY(c == '"' && unclosedString && base[*token] == '\0')) {
+                Seek(is, base + *token);
+                RAPIDJSON_PARSE_ERROR(kParseErrorStringMissQuotationMark, is.Tell());
+            }
+        }
+    }
+
+    // Skip the rest of a container, token is after its opening bracket.
+    template <typename InputStream>
+    void SkipIndexedContainer(InputStream& is, const char* base, const uint32_t*& token, char open, bool unclosedString) {
+        const ParseErrorCode unclosed = open == '{' ? kParseErrorObjectMissCommaOrCurlyBracket : kParseErrorArrayMissCommaOrSquareBracket;
+        for (unsigned depth = 1;; ++token) {
+            const char c = base[*token];
+            if (c == '{' || c == '[')
+                depth++;
+            else if (c == '}' || c == ']') {
+                if (--depth == 0) {
+                    Seek(is, base + *token);
+                    if (RAPIDJSON_UNLIKELY(c != (open == '{' ? '}' : ']')))
+                        RAPIDJSON_PARSE_ERROR(unclosed, is.Tell());
+                    is.Take();
+                    ++token;
+                    return;
+                }
+            }
+            else if (RAPIDJSON_UNLIKELY(c == '\0')) {
+                Seek(is, base + *token);
+                RAPIDJSON_PARSE_ERROR(unclosedString ? kParseErrorStringMissQuotationMark : unclosed, is.Tell());
+            }
+        }
+    }
+
     // Iterative Parsing
 
     // States
@@ -1652,6 +2535,15 @@ private:
                 RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorTermination, is.Tell());
                 return IterativeParsingErrorState;
             }
+            else if (SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>())) {
+                // Skip the whole object/array and restore the state as on ObjectFinish or ArrayFinish.
+                SkipStructure<parseFlags>(is, is.Take(), 1, false);
+                if (HasParseError())
+                    return IterativeParsingErrorState;
+                stack_.template Pop<SizeType>(1);
+                n = static_cast<IterativeParsingState>(*stack_.template Pop<SizeType>(1));
+                return n == IterativeParsingStartState ? IterativeParsingFinishState : n;
+            }
             else {
                 is.Take();
                 return dst;
@@ -1662,6 +2554,17 @@ private:
             ParseString<parseFlags>(is, handler, true);
             if (HasParseError())
                 return IterativeParsingErrorState;
+            else if (SkipRequested(handler, internal::BoolType<(parseFlags & kParseSkipValueFlag) != 0>())) {
+                // Skip the colon and the value, as if the value had been parsed.
+                SkipWhitespaceAndComments<parseFlags>(is);
+                if (!HasParseError() && RAPIDJSON_UNLIKELY(!Consume(is, ':')))
+                    RAPIDJSON_PARSE_ERROR_NORETURN(kParseErrorObjectMissColon, is.Tell());
+                if (!HasParseError())
+                    SkipWhitespaceAndComments<parseFlags>(is);
+                if (!HasParseError())
+                    SkipValueText<parseFlags>(is);
+                return HasParseError() ? IterativeParsingErrorState : IterativeParsingMemberValueState;
+            }
             else
                 return dst;
 
@@ -1831,9 +2734,33 @@ private:
         return parseResult_;
     }
 
+    // End token-by-token parsing on an error, which has been set.
+    bool IterativeParseFail() {
+        RAPIDJSON_ASSERT(HasParseError());
+        state_ = IterativeParsingErrorState;
+        ClearStack();
+        return false;
+    }
+
+    // The root value has been parsed: check the rest of the text as IterativeParse() does.
+    template <unsigned parseFlags, typename InputStream>
+    bool IterativeParseFinish(InputStream& is) {
+        ClearStack();
+        if (!(parseFlags & kParseStopWhenDoneFlag)) {
+            SkipWhitespaceAndComments<parseFlags>(is);
+            if (!HasParseError() && RAPIDJSON_UNLIKELY(is.Peek() != '\0'))
+                HandleError(state_, is);
+            if (RAPIDJSON_UNLIKELY(HasParseError()))
+                return IterativeParseFail();
+        }
+        return true;
+    }
+
     static const size_t kDefaultStackCapacity = 256;    //!< Default stack capacity in bytes for storing a single decoded string.
     internal::Stack<StackAllocator> stack_;  //!< A stack for storing decoded string temporarily during non-destructive parsing.
+    internal::Stack<StackAllocator> index_;  //!< Offsets of the tokens for kParseStructuralIndexFlag.
     ParseResult parseResult_;
+    IterativeParsingState state_;            //!< State of token-by-token parsing.
 }; // class GenericReader
 
 //! Reader with UTF8 encoding and default allocator.
@@ -18,6 +18,7 @@
 #include "document.h"
 #include "pointer.h"
 #include <cmath> // abs, floor
+#include <cstring> // memset
 
 #ifdef __clang__
 RAPIDJSON_DIAG_PUSH
@@ -259,6 +260,83 @@ private:
     Stack<Allocator> stack_;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// HashCodeSet
+
+// Set of the hash codes of Hasher for enum and uniqueItems, with open addressing
+template<typename Allocator>
+class HashCodeSet {
+public:
+    HashCodeSet(Allocator* allocator, size_t count = 0) : allocator_(allocator), codes_(), mask_(), size_(), hasZero_() {
+        if (count > 0)
+            Rehash(count);
+    }
+
+    ~HashCodeSet() { Allocator::Free(codes_); }
+
+    // Returns false if h is already in the set.
+    bool Insert(uint64_t h) {
+        if (h == 0) {   // 0 marks an empty slot
+            const bool inserted = !hasZero_;
+            hasZero_ = true;
+            return inserted;
+        }
+        if (!codes_ || (size_ + 1) * 4 > (mask_ + 1) * 3)
+            Rehash(size_ + 1);
+        uint64_t* slot = Find(h);
+        if (*slot == h)
+            return false;
+        *slot = h;
+        size_++;
+        return true;
+    }
+
+    bool Contains(uint64_t h) const {
+        if (h == 0)
+            return hasZero_;
+        return codes_ && *Find(h) == h;
+    }
+
+private:
+    HashCodeSet(const HashCodeSet&);
+    HashCodeSet& operator=(const HashCodeSet&);
+
+    static const size_t kMinCapacity = 16;
+
+    uint64_t* Find(uint64_t h) const {
+        // Mix the high bits into the index, FNV-1a only carries upwards.
+        uint64_t x = h ^ (h >> 33);
+        x *= RAPIDJSON_UINT64_C2(0xff51afd7, 0xed558ccd);
+        x ^= x >> 33;
+        size_t i = static_cast<size_t>(x) & mask_;
+        while (codes_[i] != 0 && codes_[i] != h)
+            i = (i + 1) & mask_;
+        return &codes_[i];
+    }
+
+    // Allocates a table with a load factor of at most 3/4 for count codes, or twice the current one.
+    void Rehash(size_t count) {
+        size_t capacity = codes_ ? (mask_ + 1) * 2 : kMinCapacity;
+        while (count * 4 > capacity * 3)
+            capacity *= 2;
+        uint64_t* old = codes_;
+        const size_t oldCapacity = codes_ ? mask_ + 1 : 0;
+        codes_ = static_cast<uint64_t*>(allocator_->Malloc(sizeof(uint64_t) * capacity));
+        std::memset(codes_, 0, sizeof(uint64_t) * capacity);
+        mask_ = capacity - 1;
+        for (size_t i = 0; i < oldCapacity; i++)
+            if (old[i] != 0)
+                *Find(old[i]) = old[i];
+        Allocator::Free(old);
+    }
+
+    Allocator* allocator_;
+    uint64_t* codes_;
+    size_t mask_;
+    size_t size_;
+    bool hasZero_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // SchemaValidationContext
 
@@ -355,7 +433,6 @@ public:
     Schema(SchemaDocumentType* schemaDocument, const PointerType& p, const ValueType& value, const ValueType& document, AllocatorType* allocator) :
         allocator_(allocator),
         enum_(),
-        enumCount_(),
         not_(),
         type_((1 << kTotalSchemaType) - 1), // typeless
         validatorCount_(),
@@ -402,14 +479,14 @@ public:
 
         if (const ValueType* v = GetMember(value, GetEnumString()))
             if (v->IsArray() && v->Size() > 0) {
-                enum_ = static_cast<uint64_t*>(allocator_->Malloc(sizeof(uint64_t) * v->Size()));
+                enum_ = new (allocator_->Malloc(sizeof(HashCodeSetType))) HashCodeSetType(allocator_, v->Size());
                 for (ConstValueIterator itr = v->Begin(); itr != v->End(); ++itr) {
                     typedef Hasher<EncodingType, MemoryPoolAllocator<> > EnumHasherType;
                     char buffer[256 + 24];
                     MemoryPoolAllocator<> hasherAllocator(buffer, sizeof(buffer));
                     EnumHasherType h(&hasherAllocator, 256);
                     itr->Accept(h);
-                    enum_[enumCount_++] = h.GetHashCode();
+                    enum_->Insert(h.GetHashCode());
                 }
             }
 
@@ -578,7 +655,10 @@ public:
     }
 
     ~Schema() {
-        allocator_->Free(enum_);
+        if (enum_) {
+            enum_->~HashCodeSetType();
+            AllocatorType::Free(enum_);
+        }
         if (properties_) {
             for (SizeType i = 0; i < propertyCount_; i++)
                 properties_[i].~Property();
@@ -649,14 +729,8 @@ public:
                 RAPIDJSON_INVALID_KEYWORD_RETURN(GetPatternPropertiesString());
         }
 
-        if (enum_) {
-            const uint64_t h = context.factory.GetHashCode(context.hasher);
-            for (SizeType i = 0; i < enumCount_; i++)
-                if (enum_[i] == h)
-                    goto foundEnum;
+        if (enum_ && !enum_->Contains(context.factory.GetHashCode(context.hasher)))
             RAPIDJSON_INVALID_KEYWORD_RETURN(GetEnumString());
-            foundEnum:;
-        }
 
         if (allOf_.schemas)
             for (SizeType i = allOf_.begin; i < allOf_.begin + allOf_.count; i++)
@@ -942,6 +1016,8 @@ private:
         typedef char RegexType;
 #endif
 
+    typedef HashCodeSet<AllocatorType> HashCodeSetType;
+
     struct SchemaArray {
         SchemaArray() : schemas(), count() {}
         ~SchemaArray() { AllocatorType::Free(schemas); }
@@ -1219,8 +1295,7 @@ private:
     };
 
     AllocatorType* allocator_;
-    uint64_t* enum_;
-    SizeType enumCount_;
+    HashCodeSetType* enum_;
     SchemaArray allOf_;
     SchemaArray anyOf_;
     SchemaArray oneOf_;
@@ -1777,7 +1852,7 @@ RAPIDJSON_MULTILINEMACRO_END
 
 private:
     typedef typename SchemaType::Context Context;
-    typedef GenericValue<UTF8<>, StateAllocator> HashCodeArray;
+    typedef internal::HashCodeSet<StateAllocator> HashCodeSet;
     typedef internal::Hasher<EncodingType, StateAllocator> HasherType;
 
     GenericSchemaValidator( 
@@ -1861,13 +1936,11 @@ private:
         if (!schemaStack_.Empty()) {
             Context& context = CurrentContext();
             if (context.valueUniqueness) {
-                HashCodeArray* a = static_cast<HashCodeArray*>(context.arrayElementHashCodes);
+                HashCodeSet* a = static_cast<HashCodeSet*>(context.arrayElementHashCodes);
                 if (!a)
-                    CurrentContext().arrayElementHashCodes = a = new (GetStateAllocator().Malloc(sizeof(HashCodeArray))) HashCodeArray(kArrayType);
-                for (typename HashCodeArray::ConstValueIterator itr = a->Begin(); itr != a->End(); ++itr)
-                    if (itr->GetUint64() == h)
-                        RAPIDJSON_INVALID_KEYWORD_RETURN(SchemaType::GetUniqueItemsString());
-                a->PushBack(h, GetStateAllocator());
+                    CurrentContext().arrayElementHashCodes = a = new (GetStateAllocator().Malloc(sizeof(HashCodeSet))) HashCodeSet(&GetStateAllocator());
+                if (!a->Insert(h))
+                    RAPIDJSON_INVALID_KEYWORD_RETURN(SchemaType::GetUniqueItemsString());
             }
         }
 
@@ -1899,8 +1972,8 @@ private:
     
     RAPIDJSON_FORCEINLINE void PopSchema() {
         Context* c = schemaStack_.template Pop<Context>(1);
-        if (HashCodeArray* a = static_cast<HashCodeArray*>(c->arrayElementHashCodes)) {
-            a->~HashCodeArray();
+        if (HashCodeSet* a = static_cast<HashCodeSet*>(c->arrayElementHashCodes)) {
+            a->~HashCodeSet();
             StateAllocator::Free(a);
         }
         c->~Context();
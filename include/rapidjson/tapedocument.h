@@ -0,0 +1,776 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_TAPEDOCUMENT_H_
+#define RAPIDJSON_TAPEDOCUMENT_H_
+
+/*! \file tapedocument.h */
+
+#include "document.h"
+#include "internal/ieee754.h"
+#include <cstring>
+#include <iterator>
+
+#ifdef __clang__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(padded)
+#endif
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_PUSH
+RAPIDJSON_DIAG_OFF(effc++)
+#endif
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+template <typename Encoding, typename Allocator>
+class GenericTapeDocument;
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericTapeValue
+
+//! Read-only view of a value in a GenericTapeDocument.
+/*!
+    A value is a pointer into the tape of its document, so it is cheap to copy
+    and stays valid until the document is parsed again or destroyed.
+
+    The tape stores each value as a 64-bit word, with the kind of value in the
+    highest 8 bits:
+    - null, false and true take one word.
+    - 32-bit integers are stored in the word, 64-bit integers and doubles in the next one.
+    - A string stores the offset of its length, characters and terminator in the string buffer.
+      UTF-8 strings of up to 6 bytes are stored in the word instead (on little endian machines).
+    - An object or array stores the number of words up to its next sibling and its size
+      (up to 2^24 - 1, otherwise it is counted when needed), followed by its members
+      (name and value) or elements.
+
+    The read API is the same as GenericValue, including FindMember(), iteration and Accept().
+
+    \tparam Encoding Encoding of the strings.
+*/
+template <typename Encoding>
+class GenericTapeValue {
+public:
+    typedef typename Encoding::Ch Ch;               //!< Character type derived from Encoding.
+    typedef GenericTapeValue ValueType;             //!< Value type of itself.
+
+    //! Name-value pair of an object, as dereferenced from ConstMemberIterator.
+    struct Member {
+        GenericTapeValue name;      //!< name of member (must be a string)
+        GenericTapeValue value;     //!< value of member.
+    };
+
+    //! Forward iterator over the elements of an array.
+    class ConstValueIterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef GenericTapeValue value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const GenericTapeValue* pointer;
+        typedef const GenericTapeValue& reference;
+
+        ConstValueIterator() : value_() {}
+
+        reference operator*() const { return value_; }
+        pointer operator->() const { return &value_; }
+
+        ConstValueIterator& operator++() { value_.word_ = Next(value_.word_); return *this; }
+        ConstValueIterator operator++(int) { ConstValueIterator old(*this); ++*this; return old; }
+
+        bool operator==(const ConstValueIterator& that) const { return value_.word_ == that.value_.word_; }
+        bool operator!=(const ConstValueIterator& that) const { return value_.word_ != that.value_.word_; }
+
+    private:
+        friend class GenericTapeValue;
+        ConstValueIterator(const uint64_t* word, const char* strings) : value_(word, strings) {}
+
+        GenericTapeValue value_;
+    };
+
+    //! Forward iterator over the members of an object.
+    class ConstMemberIterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Member value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Member* pointer;
+        typedef const Member& reference;
+
+        ConstMemberIterator() : member_() {}
+
+        reference operator*() const { return member_; }
+        pointer operator->() const { return &member_; }
+
+        ConstMemberIterator& operator++() {
+            // Name strings take one word.
+            member_.name.word_ = Next(member_.value.word_);
+            member_.value.word_ = member_.name.word_ + 1;
+            return *this;
+        }
+        ConstMemberIterator operator++(int) { ConstMemberIterator old(*this); ++*this; return old; }
+
+        bool operator==(const ConstMemberIterator& that) const { return member_.name.word_ == that.member_.name.word_; }
+        bool operator!=(const ConstMemberIterator& that) const { return member_.name.word_ != that.member_.name.word_; }
+
+    private:
+        friend class GenericTapeValue;
+        ConstMemberIterator(const uint64_t* word, const char* strings) : member_() {
+            member_.name = GenericTapeValue(word, strings);
+            // Only compared at the end, where there is no value.
+            member_.value = GenericTapeValue(word + 1, strings);
+        }
+
+        Member member_;
+    };
+
+    //! Default constructor, a null value.
+    GenericTapeValue() : word_(NullWord()), strings_(0) {}
+
+    //!@name Type
+    //!@{
+
+    Type GetType() const {
+        return Tag() <= kStringTag ? static_cast<Type>(Tag()) : Tag() == kShortStringTag ? kStringType : kNumberType;
+    }
+    bool IsNull()   const { return Tag() == kNullTag; }
+    bool IsFalse()  const { return Tag() == kFalseTag; }
+    bool IsTrue()   const { return Tag() == kTrueTag; }
+    bool IsBool()   const { return Tag() == kFalseTag || Tag() == kTrueTag; }
+    bool IsObject() const { return Tag() == kObjectTag; }
+    bool IsArray()  const { return Tag() == kArrayTag; }
+    bool IsString() const { return Tag() == kStringTag || Tag() == kShortStringTag; }
+    bool IsNumber() const { return Tag() >= kIntTag; }
+    bool IsDouble() const { return Tag() == kDoubleTag; }
+
+    //! Whether the number fits in an int, as for GenericValue::IsInt().
+    bool IsInt() const {
+        switch (Tag()) {
+        case kIntTag:    return true;
+        case kUintTag:   return Payload() <= 0x7FFFFFFFu;
+        case kInt64Tag:  return static_cast<int>(word_[1]) == static_cast<int64_t>(word_[1]);
+        case kUint64Tag: return word_[1] <= 0x7FFFFFFFu;
+        default:         return false;
+        }
+    }
+
+    //! Whether the number fits in an unsigned, as for GenericValue::IsUint().
+    bool IsUint() const {
+        switch (Tag()) {
+        case kIntTag:    return static_cast<int>(Payload()) >= 0;
+        case kUintTag:   return true;
+        case kInt64Tag:
+        case kUint64Tag: return word_[1] <= 0xFFFFFFFFu;
+        default:         return false;
+        }
+    }
+
+    //! Whether the number fits in an int64_t, as for GenericValue::IsInt64().
+    bool IsInt64() const {
+        switch (Tag()) {
+        case kIntTag:
+        case kUintTag:
+        case kInt64Tag:  return true;
+        case kUint64Tag: return !(word_[1] & RAPIDJSON_UINT64_C2(0x80000000, 0x00000000));
+        default:         return false;
+        }
+    }
+
+    //! Whether the number fits in an uint64_t, as for GenericValue::IsUint64().
+    bool IsUint64() const {
+        switch (Tag()) {
+        case kIntTag:    return static_cast<int>(Payload()) >= 0;
+        case kUintTag:
+        case kUint64Tag: return true;
+        case kInt64Tag:  return static_cast<int64_t>(word_[1]) >= 0;
+        default:         return false;
+        }
+    }
+    //!@}
+
+    //!@name Bool, number and string
+    //!@{
+
+    bool GetBool() const { RAPIDJSON_ASSERT(IsBool()); return Tag() == kTrueTag; }
+
+    int GetInt() const {
+        RAPIDJSON_ASSERT(IsInt());
+        return Tag() <= kUintTag ? static_cast<int>(Payload()) : static_cast<int>(word_[1]);
+    }
+
+    unsigned GetUint() const {
+        RAPIDJSON_ASSERT(IsUint());
+        return Tag() <= kUintTag ? static_cast<unsigned>(Payload()) : static_cast<unsigned>(word_[1]);
+    }
+
+    int64_t GetInt64() const {
+        RAPIDJSON_ASSERT(IsInt64());
+        switch (Tag()) {
+        case kIntTag:   return static_cast<int>(Payload());
+        case kUintTag:  return static_cast<int64_t>(Payload());
+        default:        return static_cast<int64_t>(word_[1]);
+        }
+    }
+
+    uint64_t GetUint64() const {
+        RAPIDJSON_ASSERT(IsUint64());
+        return Tag() <= kUintTag ? Payload() : word_[1];
+    }
+
+    //! Get the value as double, converting integers as GenericValue::GetDouble() does.
+    double GetDouble() const {
+        RAPIDJSON_ASSERT(IsNumber());
+        switch (Tag()) {
+        case kIntTag:    return static_cast<double>(static_cast<int>(Payload()));
+        case kUintTag:   return static_cast<double>(Payload());
+        case kInt64Tag:  return static_cast<double>(static_cast<int64_t>(word_[1]));
+        case kUint64Tag: return static_cast<double>(word_[1]);
+        default:         return internal::Double(word_[1]).Value();
+        }
+    }
+
+    const Ch* GetString() const {
+        RAPIDJSON_ASSERT(IsString());
+        if (Tag() == kShortStringTag)
+            return reinterpret_cast<const Ch*>(word_);
+        return reinterpret_cast<const Ch*>(strings_ + Payload() + sizeof(SizeType));
+    }
+
+    //! Get the length of string, excluding the terminator.
+    SizeType GetStringLength() const {
+        RAPIDJSON_ASSERT(IsString());
+        if (Tag() == kShortStringTag)
+            return kMaxShortStringLength - static_cast<SizeType>((*word_ >> kShortStringLengthShift) & 0xFF);
+        return *reinterpret_cast<const SizeType*>(strings_ + Payload());
+    }
+    //!@}
+
+    //!@name Array
+    //!@{
+
+    //! Get the number of elements in array.
+    SizeType Size() const { RAPIDJSON_ASSERT(IsArray()); return Count(); }
+
+    //! Check whether the array is empty.
+    bool Empty() const { RAPIDJSON_ASSERT(IsArray()); return Span() == 1; }
+
+    //! Get an element from array by index.
+    /*! Elements are skipped one by one from the start, in time linear to the index.
+        \param index Zero-based index of element.
+    */
+    GenericTapeValue operator[](SizeType index) const {
+        RAPIDJSON_ASSERT(index < Size());
+        ConstValueIterator itr = Begin();
+        for (; index > 0; index--)
+            ++itr;
+        return *itr;
+    }
+
+    ConstValueIterator Begin() const { RAPIDJSON_ASSERT(IsArray()); return ConstValueIterator(word_ + 1, strings_); }
+    ConstValueIterator End() const { RAPIDJSON_ASSERT(IsArray()); return ConstValueIterator(word_ + Span(), strings_); }
+    //!@}
+
+    //!@name Object
+    //!@{
+
+    //! Get the number of members in the object.
+    SizeType MemberCount() const { RAPIDJSON_ASSERT(IsObject()); return Count(); }
+
+    //! Check whether the object is empty.
+    bool ObjectEmpty() const { RAPIDJSON_ASSERT(IsObject()); return Span() == 1; }
+
+    ConstMemberIterator MemberBegin() const { RAPIDJSON_ASSERT(IsObject()); return ConstMemberIterator(word_ + 1, strings_); }
+    ConstMemberIterator MemberEnd() const { RAPIDJSON_ASSERT(IsObject()); return ConstMemberIterator(word_ + Span(), strings_); }
+
+    //! Find member by name.
+    /*! The members are scanned in order, and the values in between are skipped
+        without being visited.
+        \param name Member name to be searched.
+        \return Iterator to member, if it exists. Otherwise returns \ref MemberEnd().
+    */
+    ConstMemberIterator FindMember(const Ch* name) const {
+        return FindMember(name, internal::StrLen(name));
+    }
+
+    //! Find member by name, with the length of the name.
+    ConstMemberIterator FindMember(const Ch* name, SizeType length) const {
+        RAPIDJSON_ASSERT(IsObject());
+        RAPIDJSON_ASSERT(name);
+        const ConstMemberIterator end = MemberEnd();
+        uint64_t word;
+        if (MakeShortString(name, length, &word)) {
+            // Short names are always stored in the word, so only words are compared.
+            for (ConstMemberIterator itr = MemberBegin(); itr != end; ++itr)
+                if (*itr->name.word_ == word)
+                    return itr;
+            return end;
+        }
+        for (ConstMemberIterator itr = MemberBegin(); itr != end; ++itr)
+            if (itr->name.GetStringLength() == length && std::memcmp(itr->name.GetString(), name, length * sizeof(Ch)) == 0)
+                return itr;
+        return end;
+    }
+
+    //! Find member by name given as a GenericValue string.
+    template <typename SourceAllocator>
+    ConstMemberIterator FindMember(const GenericValue<Encoding, SourceAllocator>& name) const {
+        return FindMember(name.GetString(), name.GetStringLength());
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    //! Find member by string object name (with \c std::basic_string).
+    ConstMemberIterator FindMember(const std::basic_string<Ch>& name) const {
+        return FindMember(name.data(), static_cast<SizeType>(name.size()));
+    }
+#endif
+
+    bool HasMember(const Ch* name) const { return FindMember(name) != MemberEnd(); }
+
+#if RAPIDJSON_HAS_STDSTRING
+    bool HasMember(const std::basic_string<Ch>& name) const { return FindMember(name) != MemberEnd(); }
+#endif
+
+    //! Get a value from an object by name, or a null value if there is no such member.
+    /*! \tparam T Either \c Ch or \c const \c Ch (template used for disambiguation with \ref operator[](SizeType))
+    */
+    template <typename T>
+    RAPIDJSON_DISABLEIF_RETURN((internal::NotExpr<internal::IsSame<typename internal::RemoveConst<T>::Type, Ch> >),(GenericTapeValue)) operator[](T* name) const {
+        const ConstMemberIterator member = FindMember(name);
+        if (member != MemberEnd())
+            return member->value;
+        RAPIDJSON_ASSERT(false);    // see GenericValue::operator[]
+        return GenericTapeValue();
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    GenericTapeValue operator[](const std::basic_string<Ch>& name) const { return (*this)[name.c_str()]; }
+#endif
+    //!@}
+
+    //! Generate events of this value to a Handler.
+    /*! This function adopts the GoF visitor pattern, as GenericValue::Accept().
+        Strings are passed with \c copy = false.
+        \tparam Handler type of handler.
+        \param handler An object implementing concept Handler.
+    */
+    template <typename Handler>
+    bool Accept(Handler& handler) const {
+        return AcceptWord(word_, handler) != 0;
+    }
+
+protected:
+    template <typename, typename> friend class GenericTapeDocument;
+
+    //! Kinds of words on the tape, the first ones in the order of Type.
+    enum WordTag {
+        kNullTag,
+        kFalseTag,
+        kTrueTag,
+        kObjectTag,
+        kArrayTag,
+        kStringTag,
+        kShortStringTag,    // the characters are in the word, followed by 6 - length
+        kIntTag,        // the payload holds the int
+        kUintTag,       // the payload holds the unsigned
+        kInt64Tag,      // the next word holds the number
+        kUint64Tag,
+        kDoubleTag
+    };
+
+    static const int kTagShift = 56;
+    static const int kCountShift = 32;
+    static const uint64_t kMaxCount = 0xFFFFFF;
+    static const int kShortStringLengthShift = 48;
+    static const SizeType kMaxShortStringLength = 6;
+
+    GenericTapeValue(const uint64_t* word, const char* strings) : word_(word), strings_(strings) {}
+
+    static uint64_t MakeWord(WordTag tag, uint64_t payload = 0) {
+        return (static_cast<uint64_t>(tag) << kTagShift) | payload;
+    }
+
+    //! Makes the word of a short string, with a zero byte after the characters.
+    /*! \return false if the string is too long, or not UTF-8. */
+    static bool MakeShortString(const Ch* str, SizeType length, uint64_t* word) {
+#if RAPIDJSON_ENDIAN == RAPIDJSON_LITTLEENDIAN
+        if (sizeof(Ch) == 1 && length <= kMaxShortStringLength) {
+            *word = MakeWord(kShortStringTag, static_cast<uint64_t>(kMaxShortStringLength - length) << kShortStringLengthShift);
+            std::memcpy(word, str, length);
+            return true;
+        }
+#else
+        (void)str;
+        (void)length;
+        (void)word;
+#endif
+        return false;
+    }
+
+    static const uint64_t* NullWord() {
+        static const uint64_t null = 0;
+        return &null;
+    }
+
+    //! The word after a value and its content.
+    static const uint64_t* Next(const uint64_t* word) {
+        const uint64_t tag = *word >> kTagShift;
+        if (tag == kObjectTag || tag == kArrayTag)
+            return word + static_cast<uint32_t>(*word);
+        return word + 1 + (tag >= kInt64Tag);
+    }
+
+    //! Generates the events of the value at a word, walking the tape in order.
+    /*! \return The word after the value, or 0 if the handler stopped. */
+    template <typename Handler>
+    const uint64_t* AcceptWord(const uint64_t* word, Handler& handler) const {
+        const GenericTapeValue v(word, strings_);
+        switch (v.Tag()) {
+        case kNullTag:  return handler.Null() ? word + 1 : 0;
+        case kFalseTag: return handler.Bool(false) ? word + 1 : 0;
+        case kTrueTag:  return handler.Bool(true) ? word + 1 : 0;
+
+        case kObjectTag: {
+            if (RAPIDJSON_UNLIKELY(!handler.StartObject()))
+                return 0;
+            const uint64_t* end = word + v.Span();
+            for (const uint64_t* w = word + 1; w != end; ) {
+                // A name is always a single string word.
+                const GenericTapeValue name(w, strings_);
+                if (RAPIDJSON_UNLIKELY(!handler.Key(name.GetString(), name.GetStringLength(), false)))
+                    return 0;
+                if (RAPIDJSON_UNLIKELY(!(w = AcceptWord(w + 1, handler))))
+                    return 0;
+            }
+            return handler.EndObject(v.Count()) ? end : 0;
+        }
+
+        case kArrayTag: {
+            if (RAPIDJSON_UNLIKELY(!handler.StartArray()))
+                return 0;
+            const uint64_t* end = word + v.Span();
+            for (const uint64_t* w = word + 1; w != end; )
+                if (RAPIDJSON_UNLIKELY(!(w = AcceptWord(w, handler))))
+                    return 0;
+            return handler.EndArray(v.Count()) ? end : 0;
+        }
+
+        case kStringTag:
+        case kShortStringTag:   return handler.String(v.GetString(), v.GetStringLength(), false) ? word + 1 : 0;
+        case kIntTag:       return handler.Int(v.GetInt()) ? word + 1 : 0;
+        case kUintTag:      return handler.Uint(v.GetUint()) ? word + 1 : 0;
+        case kInt64Tag:     return handler.Int64(v.GetInt64()) ? word + 2 : 0;
+        case kUint64Tag:    return handler.Uint64(v.GetUint64()) ? word + 2 : 0;
+        default:
+            RAPIDJSON_ASSERT(v.Tag() == kDoubleTag);
+            return handler.Double(v.GetDouble()) ? word + 2 : 0;
+        }
+    }
+
+    unsigned Tag() const { return static_cast<unsigned>(*word_ >> kTagShift); }
+    uint64_t Payload() const { return *word_ & RAPIDJSON_UINT64_C2(0x00FFFFFF, 0xFFFFFFFF); }
+
+    //! Number of words of an object or array, including its own.
+    uint32_t Span() const { return static_cast<uint32_t>(*word_); }
+
+    SizeType Count() const {
+        const uint64_t count = Payload() >> kCountShift;
+        if (RAPIDJSON_LIKELY(count < kMaxCount))
+            return static_cast<SizeType>(count);
+        SizeType n = 0;
+        const uint64_t* end = word_ + Span();
+        for (const uint64_t* w = word_ + 1; w != end; w = Next(w))
+            n++;
+        return IsObject() ? n / 2 : n;
+    }
+
+    const uint64_t* word_;  //!< Word of this value on the tape.
+    const char* strings_;   //!< String buffer of the document.
+};
+
+//! GenericTapeValue with UTF8 encoding
+typedef GenericTapeValue<UTF8<> > TapeValue;
+
+///////////////////////////////////////////////////////////////////////////////
+// GenericTapeDocument
+
+//! An immutable document which stores the parsed JSON as a tape of 64-bit words.
+/*!
+    Instead of a tree of GenericValue, each with separately allocated members
+    or elements, the whole document is one contiguous array of words in
+    document order, plus one buffer with all the strings. Parsing it allocates
+    only a few growing buffers, and numbers, literals, short strings and the
+    structure take about half the memory of a Document (long strings take
+    about the same).
+
+    It cannot be modified after parsing. Values are accessed with the read API
+    of GenericValue through GenericTapeValue, which the document derives from
+    for its root.
+
+    \code
+    TapeDocument d;
+    d.Parse(json);
+    if (!d.HasParseError() && d.IsObject())
+        for (TapeValue::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+            printf("%s\n", m->name.GetString());
+    \endcode
+
+    The buffers are kept when parsing again, so a document can be reused for
+    parsing many texts without allocation.
+
+    \note implements Handler concept
+    \tparam Encoding Encoding for both parsing and string storage.
+    \tparam Allocator Allocator for the tape, the string buffer and the parsing stack.
+*/
+template <typename Encoding, typename Allocator = CrtAllocator>
+class GenericTapeDocument : public GenericTapeValue<Encoding> {
+public:
+    typedef typename Encoding::Ch Ch;                       //!< Character type derived from Encoding.
+    typedef GenericTapeValue<Encoding> ValueType;           //!< Value type of the document.
+    typedef Allocator AllocatorType;                        //!< Allocator type from template parameter.
+
+    //! Constructor
+    /*! Creates an empty document which type is Null.
+        \param allocator        Optional allocator for the buffers.
+        \param tapeCapacity     Optional initial capacity of the tape in bytes.
+    */
+    explicit GenericTapeDocument(Allocator* allocator = 0, size_t tapeCapacity = kDefaultTapeCapacity) :
+        tape_(allocator, tapeCapacity), stringBuffer_(allocator, tapeCapacity), stack_(allocator, kDefaultStackCapacity), parseResult_() {}
+
+    //!@name Parse from stream
+    //!@{
+
+    //! Parse JSON text from an input stream (with Encoding conversion)
+    /*! \tparam parseFlags Combination of \ref ParseFlag.
+        \tparam SourceEncoding Encoding of input stream
+        \tparam InputStream Type of input stream, implementing Stream concept
+        \param is Input stream to be parsed.
+        \return The document itself for fluent API.
+    */
+    template <unsigned parseFlags, typename SourceEncoding, typename InputStream>
+    GenericTapeDocument& ParseStream(InputStream& is) {
+        ValueType::operator=(ValueType());
+        tape_.Clear();
+        stringBuffer_.Clear();
+        ClearStackOnExit scope(*this);
+        GenericReader<SourceEncoding, Encoding, Allocator> reader(stack_.HasAllocator() ? &stack_.GetAllocator() : 0);
+        parseResult_ = reader.template Parse<parseFlags>(is, *this);
+        if (parseResult_) {
+            RAPIDJSON_ASSERT(stack_.Empty());
+            ValueType::operator=(ValueType(tape_.template Bottom<uint64_t>(), stringBuffer_.template Bottom<char>()));
+        }
+        else {
+            tape_.Clear();
+            stringBuffer_.Clear();
+        }
+        return *this;
+    }
+
+    //! Parse JSON text from an input stream
+    template <unsigned parseFlags, typename InputStream>
+    GenericTapeDocument& ParseStream(InputStream& is) {
+        return ParseStream<parseFlags, Encoding, InputStream>(is);
+    }
+
+    //! Parse JSON text from an input stream (with \ref kParseDefaultFlags)
+    template <typename InputStream>
+    GenericTapeDocument& ParseStream(InputStream& is) {
+        return ParseStream<kParseDefaultFlags, Encoding, InputStream>(is);
+    }
+    //!@}
+
+    //!@name Parse from read-only string
+    //!@{
+
+    //! Parse JSON text from a read-only string (with Encoding conversion)
+    /*! \tparam parseFlags Combination of \ref ParseFlag (must not contain \ref kParseInsituFlag).
+        \tparam SourceEncoding Transcoding from input Encoding
+        \param str Read-only zero-terminated string to be parsed.
+    */
+    template <unsigned parseFlags, typename SourceEncoding>
+    GenericTapeDocument& Parse(const typename SourceEncoding::Ch* str) {
+        RAPIDJSON_ASSERT(!(parseFlags & kParseInsituFlag));
+        GenericStringStream<SourceEncoding> s(str);
+        return ParseStream<parseFlags, SourceEncoding>(s);
+    }
+
+    //! Parse JSON text from a read-only string
+    template <unsigned parseFlags>
+    GenericTapeDocument& Parse(const Ch* str) {
+        return Parse<parseFlags, Encoding>(str);
+    }
+
+    //! Parse JSON text from a read-only string (with \ref kParseDefaultFlags)
+    GenericTapeDocument& Parse(const Ch* str) {
+        return Parse<kParseDefaultFlags>(str);
+    }
+
+    template <unsigned parseFlags, typename SourceEncoding>
+    GenericTapeDocument& Parse(const typename SourceEncoding::Ch* str, size_t length) {
+        RAPIDJSON_ASSERT(!(parseFlags & kParseInsituFlag));
+        MemoryStream ms(reinterpret_cast<const char*>(str), length * sizeof(typename SourceEncoding::Ch));
+        EncodedInputStream<SourceEncoding, MemoryStream> is(ms);
+        return ParseStream<parseFlags, SourceEncoding>(is);
+    }
+
+    template <unsigned parseFlags>
+    GenericTapeDocument& Parse(const Ch* str, size_t length) {
+        return Parse<parseFlags, Encoding>(str, length);
+    }
+
+    GenericTapeDocument& Parse(const Ch* str, size_t length) {
+        return Parse<kParseDefaultFlags>(str, length);
+    }
+
+#if RAPIDJSON_HAS_STDSTRING
+    template <unsigned parseFlags>
+    GenericTapeDocument& Parse(const std::basic_string<Ch>& str) {
+        return Parse<parseFlags, Encoding>(str.c_str());
+    }
+
+    GenericTapeDocument& Parse(const std::basic_string<Ch>& str) {
+        return Parse<kParseDefaultFlags>(str);
+    }
+#endif // RAPIDJSON_HAS_STDSTRING
+    //!@}
+
+    //!@name Handling parse errors
+    //!@{
+
+    //! Whether a parse error has occured in the last parsing.
+    bool HasParseError() const { return parseResult_.IsError(); }
+
+    //! Get the \ref ParseErrorCode of last parsing.
+    ParseErrorCode GetParseError() const { return parseResult_.Code(); }
+
+    //! Get the position of last parsing error in input, 0 otherwise.
+    size_t GetErrorOffset() const { return parseResult_.Offset(); }
+
+    //! Implicit conversion to get the last parse result
+    operator ParseResult() const { return parseResult_; }
+    //!@}
+
+    //! Get the size of the tape in bytes.
+    size_t GetTapeSize() const { return tape_.GetSize(); }
+
+    //! Get the size of the string buffer in bytes.
+    size_t GetStringBufferSize() const { return stringBuffer_.GetSize(); }
+
+private:
+    // clear stack on any exit from ParseStream, e.g. due to exception
+    struct ClearStackOnExit {
+        explicit ClearStackOnExit(GenericTapeDocument& d) : d_(d) {}
+        ~ClearStackOnExit() { d_.stack_.Clear(); }
+    private:
+        ClearStackOnExit(const ClearStackOnExit&);
+        ClearStackOnExit& operator=(const ClearStackOnExit&);
+        GenericTapeDocument& d_;
+    };
+
+    typedef typename ValueType::WordTag WordTag;
+
+public:
+    // Implementation of Handler
+    bool Null() { return PushWord(ValueType::kNullTag); }
+    bool Bool(bool b) { return PushWord(b ? ValueType::kTrueTag : ValueType::kFalseTag); }
+    bool Int(int i) { return PushWord(ValueType::kIntTag, static_cast<uint32_t>(i)); }
+    bool Uint(unsigned u) { return PushWord(ValueType::kUintTag, u); }
+    bool Int64(int64_t i) { return PushNumber(ValueType::kInt64Tag, static_cast<uint64_t>(i)); }
+    bool Uint64(uint64_t u) { return PushNumber(ValueType::kUint64Tag, u); }
+    bool Double(double d) { return PushNumber(ValueType::kDoubleTag, internal::Double(d).Uint64Value()); }
+
+    bool RawNumber(const Ch* str, SizeType length, bool copy) { return String(str, length, copy); }
+
+    bool String(const Ch* str, SizeType length, bool) {
+        uint64_t word;
+        if (ValueType::MakeShortString(str, length, &word)) {
+            *tape_.template Push<uint64_t>() = word;
+            return true;
+        }
+
+        // Length, characters and terminator, aligned for the next length.
+        const size_t offset = stringBuffer_.GetSize();
+        const size_t size = (sizeof(SizeType) + (length + 1) * sizeof(Ch) + sizeof(SizeType) - 1) & ~(sizeof(SizeType) - 1);
+        char* buffer = stringBuffer_.template Push<char>(size);
+        std::memcpy(buffer, &length, sizeof(SizeType));
+        Ch* s = reinterpret_cast<Ch*>(buffer + sizeof(SizeType));
+        std::memcpy(s, str, length * sizeof(Ch));
+        s[length] = Ch();
+        return PushWord(ValueType::kStringTag, offset);
+    }
+
+    bool StartObject() { return StartContainer(ValueType::kObjectTag); }
+
+    bool Key(const Ch* str, SizeType length, bool copy) { return String(str, length, copy); }
+
+    bool EndObject(SizeType memberCount) { return EndContainer(memberCount); }
+
+    bool StartArray() { return StartContainer(ValueType::kArrayTag); }
+
+    bool EndArray(SizeType elementCount) { return EndContainer(elementCount); }
+
+private:
+    //! Prohibit copying
+    GenericTapeDocument(const GenericTapeDocument&);
+    //! Prohibit assignment
+    GenericTapeDocument& operator=(const GenericTapeDocument&);
+
+    bool PushWord(WordTag tag, uint64_t payload = 0) {
+        *tape_.template Push<uint64_t>() = ValueType::MakeWord(tag, payload);
+        return true;
+    }
+
+    bool PushNumber(WordTag tag, uint64_t bits) {
+        uint64_t* words = tape_.template Push<uint64_t>(2);
+        words[0] = ValueType::MakeWord(tag);
+        words[1] = bits;
+        return true;
+    }
+
+    bool StartContainer(WordTag tag) {
+        *stack_.template Push<size_t>() = tape_.GetSize() / sizeof(uint64_t);
+        return PushWord(tag);
+    }
+
+    bool EndContainer(SizeType count) {
+        const size_t start = *stack_.template Pop<size_t>(1);
+        const size_t span = tape_.GetSize() / sizeof(uint64_t) - start;
+        RAPIDJSON_ASSERT(span <= 0xFFFFFFFFu);
+        uint64_t c = count;
+        if (c > ValueType::kMaxCount)
+            c = ValueType::kMaxCount;
+        tape_.template Bottom<uint64_t>()[start] |= (c << ValueType::kCountShift) | span;
+        return true;
+    }
+
+    static const size_t kDefaultTapeCapacity = 1024;
+    static const size_t kDefaultStackCapacity = 256;
+    internal::Stack<Allocator> tape_;           //!< Words of the values.
+    internal::Stack<Allocator> stringBuffer_;   //!< Lengths, characters and terminators of the strings.
+    internal::Stack<Allocator> stack_;          //!< Tape indices of the open objects and arrays while parsing.
+    ParseResult parseResult_;
+};
+
+//! GenericTapeDocument with UTF8 encoding
+typedef GenericTapeDocument<UTF8<> > TapeDocument;
+
+RAPIDJSON_NAMESPACE_END
+
+#ifdef __GNUC__
+RAPIDJSON_DIAG_POP
+#endif
+
+#ifdef __clang__
+RAPIDJSON_DIAG_POP
+#endif
+
+#endif // RAPIDJSON_TAPEDOCUMENT_H_
@@ -0,0 +1,319 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef RAPIDJSON_THREADCACHINGALLOCATOR_H_
+#define RAPIDJSON_THREADCACHINGALLOCATOR_H_
+
+#include "allocators.h"
+
+#if !RAPIDJSON_HAS_CXX11_THREAD
+#error "rapidjson/threadcachingallocator.h requires C++11 threads (RAPIDJSON_HAS_CXX11_THREAD)"
+#endif
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+RAPIDJSON_NAMESPACE_BEGIN
+
+///////////////////////////////////////////////////////////////////////////////
+// ThreadCachingAllocator
+
+//! Thread-safe allocator which serves small blocks from per-thread caches.
+/*!
+    Blocks of up to \c kMaxSmallSize bytes are rounded up to a multiple of 16
+    bytes (a size class) and allocated from a cache owned by the calling
+    thread, without any lock or atomic operation:
+    -# the cache's free list of the size class,
+    -# a chunk of \c kChunkSize bytes which the thread carves blocks from.
+
+    Freed blocks go to the free list of the thread which frees them. When a
+    thread has cached more than \c kMaxCachedSize bytes of one size class, or
+    when it exits, it hands its free lists over to lock-free global lists, from
+    which the other threads refill their caches before carving new blocks.
+    The unused parts of the chunks of exited threads are also passed on to new
+    threads through a lock-free list. Larger blocks go straight to \c malloc().
+
+    Memory of the small blocks is kept for reuse until the process exits, so
+    threads building and destroying documents in a steady state do not call
+    \c malloc() at all, and do not contend on it.
+
+    The allocator has no state of its own: all instances are interchangeable
+    and a block may be freed by any thread. It is meant for DOMs with many
+    insertions and removals, which \c MemoryPoolAllocator cannot reclaim, built
+    on many threads, where \c CrtAllocator would serialize them on \c malloc().
+
+    \code
+    typedef GenericDocument<UTF8<>, ThreadCachingAllocator> DocumentType;
+    \endcode
+
+    \note implements Allocator concept
+    \note Requires C++11 threads (\ref RAPIDJSON_HAS_CXX11_THREAD) and \c thread_local.
+*/
+class ThreadCachingAllocator {
+public:
+    static const bool kNeedFree = true;    //!< Blocks must be freed with Free(). (concept Allocator)
+
+    static const size_t kMaxSmallSize = 1024;           //!< Largest block served from the thread caches.
+    static const size_t kChunkSize = 64 * 1024;         //!< Size of the chunks which blocks are carved from.
+    static const size_t kMaxCachedSize = 64 * 1024;     //!< Bytes of one size class a thread caches before handing them over.
+
+    //! Allocates a memory block. (concept Allocator)
+    void* Malloc(size_t size) {
+        if (!size)
+            return NULL;
+        if (size > kMaxSmallSize)
+            return MallocLarge(size);
+
+        const size_t sizeClass = (size - 1) / kGranularity;
+        Cache* cache = GetCache();
+        if (!cache) // Thread is exiting
+            return MallocLarge(size);
+
+        FreeBlock* block = cache->free[sizeClass];
+        if (block) {
+            cache->free[sizeClass] = block->next;
+            cache->count[sizeClass]--;
+        }
+        else if (!(block = Refill(*cache, sizeClass)))
+            return NULL;
+        *Header(block) = sizeClass;
+        return block;
+    }
+
+    //! Resizes a memory block. (concept Allocator)
+    void* Realloc(void* originalPtr, size_t originalSize, size_t newSize) {
+        if (originalPtr == 0)
+            return Malloc(newSize);
+
+        if (newSize == 0) {
+            Free(originalPtr);
+            return NULL;
+        }
+
+        const size_t sizeClass = *Header(originalPtr);
+        if (sizeClass == kLargeClass) {
+            if (newSize > kMaxSmallSize) {
+                void* header = std::realloc(Header(originalPtr), kHeaderSize + newSize);
+                return header ? static_cast<char*>(header) + kHeaderSize : NULL;
+            }
+        }
+        else if (newSize <= (sizeClass + 1) * kGranularity)
+            return originalPtr; // Do not shrink within the size class
+
+        void* newBuffer = Malloc(newSize);
+        if (newBuffer) {
+            std::memcpy(newBuffer, originalPtr, originalSize < newSize ? originalSize : newSize);
+            Free(originalPtr);
+        }
+        return newBuffer;
+    }
+
+    //! Frees a memory block, from any thread. (concept Allocator)
+    static void Free(void *ptr) {
+        if (!ptr)
+            return;
+
+        const size_t sizeClass = *Header(ptr);
+        if (sizeClass == kLargeClass) {
+            std::free(Header(ptr));
+            return;
+        }
+
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        Cache* cache = GetCache();
+        if (!cache) { // Thread is exiting
+            block->next = 0;
+            block->count = 1;
+            PushBatch(sizeClass, block);
+            return;
+        }
+
+        block->next = cache->free[sizeClass];
+        cache->free[sizeClass] = block;
+        if (++cache->count[sizeClass] > kMaxCachedSize / ((sizeClass + 1) * kGranularity)) {
+            block->count = cache->count[sizeClass];
+            PushBatch(sizeClass, block);
+            cache->free[sizeClass] = 0;
+            cache->count[sizeClass] = 0;
+        }
+    }
+
+private:
+    static const size_t kGranularity = 16;                              //!< Size classes are multiples of this.
+    static const size_t kClassCount = kMaxSmallSize / kGranularity;     //!< Number of size classes.
+    static const size_t kLargeClass = ~static_cast<size_t>(0);          //!< Header of blocks from malloc().
+    static const size_t kHeaderSize = RAPIDJSON_ALIGN(sizeof(void*));   //!< Header before each block.
+
+    //! A free block, or the first block of a batch of free blocks.
+    /*! In a global list, the header of the first block of each batch links the next batch. */
+    struct FreeBlock {
+        FreeBlock* next;    //!< Next free block of the batch.
+        size_t count;       //!< Number of blocks in the batch, valid in the first block.
+    };
+
+    //! Unused part of a chunk, starting with this header.
+    struct Region {
+        Region* next;       //!< Next region in the global list.
+        char* end;          //!< End of the region.
+    };
+
+    //! Header of a chunk allocated by malloc().
+    struct Chunk {
+        Chunk* next;        //!< Next chunk ever allocated, which keeps them reachable.
+    };
+
+    //! Lists shared by all threads.
+    /*! Threads only push single entries, or take a whole list at once, which is
+        immune to the ABA problem of lock-free stacks. */
+    struct Globals {
+        std::atomic<FreeBlock*> batches[kClassCount];   //!< Batches of free blocks per size class.
+        std::atomic<Region*> regions;                   //!< Unused parts of chunks from exited threads.
+        std::atomic<Chunk*> chunks;                     //!< All chunks, never freed.
+    };
+
+    //! Blocks owned by one thread.
+    struct Cache {
+        Cache() : free(), count(), pending(), cursor(), end() {}
+        ~Cache();
+
+        FreeBlock* free[kClassCount];       //!< Free lists per size class.
+        size_t count[kClassCount];          //!< Length of the free lists.
+        FreeBlock* pending[kClassCount];    //!< Batches taken from the global list, not yet used.
+        char* cursor;                       //!< Next block to carve from the current chunk.
+        char* end;                          //!< End of the current chunk.
+
+    private:
+        Cache(const Cache&);
+        Cache& operator=(const Cache&);
+    };
+
+    static size_t* Header(void* block) { return reinterpret_cast<size_t*>(static_cast<char*>(block) - kHeaderSize); }
+    static FreeBlock*& NextBatch(FreeBlock* batch) { return *reinterpret_cast<FreeBlock**>(Header(batch)); }
+
+    static Globals& GetGlobals() {
+        static Globals globals; // Zero-initialized before any dynamic initialization
+        return globals;
+    }
+
+    static bool& CacheDestroyed() {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    //! Cache of the calling thread, or null when its thread-local storage is being destroyed.
+    static Cache* GetCache() {
+        if (CacheDestroyed())
+            return 0;
+        static thread_local Cache cache;
+        return &cache;
+    }
+
+    static void* MallocLarge(size_t size) {
+        void* header = std::malloc(kHeaderSize + size);
+        if (!header)
+            return NULL;
+        *static_cast<size_t*>(header) = kLargeClass;
+        return static_cast<char*>(header) + kHeaderSize;
+    }
+
+    static void PushBatch(size_t sizeClass, FreeBlock* batch) {
+        std::atomic<FreeBlock*>& head = GetGlobals().batches[sizeClass];
+        FreeBlock* next = head.load(std::memory_order_relaxed);
+        do
+            NextBatch(batch) = next;
+        while (!head.compare_exchange_weak(next, batch, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    static void PushRegion(Region* region) {
+        std::atomic<Region*>& head = GetGlobals().regions;
+        region->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(region->next, region, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    //! Allocates a block when the free list of the size class is empty.
+    static FreeBlock* Refill(Cache& cache, size_t sizeClass) {
+        // Take over the blocks freed by other threads before carving new ones.
+        std::atomic<FreeBlock*>& head = GetGlobals().batches[sizeClass];
+        if (!cache.pending[sizeClass] && head.load(std::memory_order_relaxed))
+            cache.pending[sizeClass] = head.exchange(0, std::memory_order_acquire);
+        if (FreeBlock* batch = cache.pending[sizeClass]) {
+            cache.pending[sizeClass] = NextBatch(batch);
+            cache.free[sizeClass] = batch->next;
+            cache.count[sizeClass] = batch->count - 1;
+            return batch;
+        }
+
+        const size_t stride = kHeaderSize + (sizeClass + 1) * kGranularity;
+        if (static_cast<size_t>(cache.end - cache.cursor) < stride && !NewRegion(cache))
+            return 0;
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(cache.cursor + kHeaderSize);
+        cache.cursor += stride;
+        return block;
+    }
+
+    //! Replaces the current chunk of a cache, the rest of which is lost.
+    static bool NewRegion(Cache& cache) {
+        std::atomic<Region*>& regions = GetGlobals().regions;
+        if (regions.load(std::memory_order_relaxed)) {
+            if (Region* region = regions.exchange(0, std::memory_order_acquire)) {
+                for (Region* r = region->next; r; ) {
+                    Region* next = r->next;
+                    PushRegion(r);
+                    r = next;
+                }
+                cache.cursor = reinterpret_cast<char*>(region);
+                cache.end = region->end;
+                return true;
+            }
+        }
+
+        Chunk* chunk = static_cast<Chunk*>(std::malloc(kChunkSize));
+        if (!chunk)
+            return false;
+        std::atomic<Chunk*>& chunks = GetGlobals().chunks;
+        chunk->next = chunks.load(std::memory_order_relaxed);
+        while (!chunks.compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed))
+            ;
+        cache.cursor = reinterpret_cast<char*>(chunk) + RAPIDJSON_ALIGN(sizeof(Chunk));
+        cache.end = reinterpret_cast<char*>(chunk) + kChunkSize;
+        return true;
+    }
+};
+
+//! Hands all cached blocks and the rest of the current chunk over to the other threads.
+inline ThreadCachingAllocator::Cache::~Cache() {
+    for (size_t sizeClass = 0; sizeClass < kClassCount; sizeClass++) {
+        if (FreeBlock* block = free[sizeClass]) {
+            block->count = count[sizeClass];
+            PushBatch(sizeClass, block);
+        }
+        for (FreeBlock* batch = pending[sizeClass]; batch; ) {
+            FreeBlock* next = NextBatch(batch);
+            PushBatch(sizeClass, batch);
+            batch = next;
+        }
+    }
+    if (static_cast<size_t>(end - cursor) >= kHeaderSize + kMaxSmallSize) {
+        Region* region = reinterpret_cast<Region*>(cursor);
+        region->end = end;
+        PushRegion(region);
+    }
+    CacheDestroyed() = true;
+}
+
+RAPIDJSON_NAMESPACE_END
+
+#endif // RAPIDJSON_THREADCACHINGALLOCATOR_H_
@@ -17,17 +17,18 @@
 
 #include "stream.h"
 #include "internal/stack.h"
+#include "internal/meta.h"
 #include "internal/strfunc.h"
 #include "internal/dtoa.h"
 #include "internal/itoa.h"
+#include "internal/bitscan.h"
 #include "stringbuffer.h"
+#include <cstring>
 #include <new>      // placement new
 
-#if defined(RAPIDJSON_SIMD) && defined(_MSC_VER)
-#include <intrin.h>
-#pragma intrinsic(_BitScanForward)
-#endif
-#ifdef RAPIDJSON_SSE42
+#ifdef RAPIDJSON_AVX2
+#include <immintrin.h>
+#elif defined(RAPIDJSON_SSE42)
 #include <nmmintrin.h>
 #elif defined(RAPIDJSON_SSE2)
 #include <emmintrin.h>
@@ -404,10 +405,127 @@ protected:
         return true;
     }
 
+    //! Writes the characters up to the next one to escape at once, if they can be copied.
+    /*! \return Whether the string has more characters. */
     bool ScanWriteUnescapedString(GenericStringStream<SourceEncoding>& is, size_t length) {
+        // UTF-8 is copied to UTF-8 or ASCII as is, other encodings are transcoded one by one.
+        ScanWriteUnescapedString(is, length, internal::BoolType<
+            internal::IsSame<SourceEncoding, UTF8<> >::Value &&
+            (internal::IsSame<TargetEncoding, UTF8<> >::Value || internal::IsSame<TargetEncoding, ASCII<> >::Value)>());
         return RAPIDJSON_LIKELY(is.Tell() < length);
     }
 
+    void ScanWriteUnescapedString(GenericStringStream<SourceEncoding>&, size_t, internal::FalseType) {}
+
+    void ScanWriteUnescapedString(GenericStringStream<SourceEncoding>& is, size_t length, internal::TrueType) {
+        const char* p = is.src_;
+        const char* end = is.head_ + length;
+        for (;;) {
+            // Non-ASCII characters are escaped for ASCII, and validated at once for UTF-8.
+            const char* q = FindEscapedChar(p, end, !TargetEncoding::supportUnicode);
+            if ((writeFlags & kWriteValidateEncodingFlag) && TargetEncoding::supportUnicode)
+                q = p + internal::FindInvalidUTF8(p, static_cast<size_t>(q - p));
+            PutRunUnsafe(*os_, p, static_cast<size_t>(q - p));
+            p = q;
+            if (TargetEncoding::supportUnicode)
+                break;
+
+            // Escape the following non-ASCII characters for ASCII, then go on with the next run.
+            // Other escapes, and invalid sequences to fail with, are left to WriteString().
+            unsigned codepoint;
+            while (q != end && static_cast<unsigned char>(*q) >= 0x80 && internal::DecodeUTF8(q, end, &codepoint))
+                PutUnicodeEscapeUnsafe(codepoint);
+            if (q == p)
+                break;
+            p = q;
+        }
+        is.src_ = p;
+    }
+
+    //! Writes \\uXXXX, or a surrogate pair of them, for a code point which is already reserved.
+    void PutUnicodeEscapeUnsafe(unsigned codepoint) {
+        static const char hexDigits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+        RAPIDJSON_ASSERT(codepoint <= 0x10FFFF);
+        const unsigned s = codepoint - 0x010000;
+        const unsigned units[2] = { codepoint <= 0xFFFF ? codepoint : (s >> 10) + 0xD800, (s & 0x3FF) + 0xDC00 };
+        const size_t count = codepoint <= 0xFFFF ? 1 : 2;
+        char buffer[12];
+        for (size_t i = 0; i < count; i++) {
+            char* q = buffer + i * 6;
+            q[0] = '\\';
+            q[1] = 'u';
+            q[2] = hexDigits[(units[i] >> 12) & 15];
+            q[3] = hexDigits[(units[i] >>  8) & 15];
+            q[4] = hexDigits[(units[i] >>  4) & 15];
+            q[5] = hexDigits[(units[i]      ) & 15];
+        }
+        if (count == 1)
+            PutRunUnsafe(*os_, buffer, 6);
+        else
+            PutRunUnsafe(*os_, buffer, 12);
+    }
+
+    //! Finds the first character of UTF-8 text which cannot be written as is.
+    /*! These are control characters, '"' and '\\', and with \c nonASCII also the
+        bytes of non-ASCII characters. With SIMD, the text is scanned 16 bytes
+        (SSE2/SSE4.2) or 32 bytes (AVX2) at a time.
+    */
+    static RAPIDJSON_FORCEINLINE const char* FindEscapedChar(const char* p, const char* end, bool nonASCII) {
+#ifdef RAPIDJSON_AVX2
+        {
+            const __m256i dq = _mm256_set1_epi8('\"');
+            const __m256i bs = _mm256_set1_epi8('\\');
+            const __m256i sp = _mm256_set1_epi8(0x1F);
+            const __m256i limit = _mm256_set1_epi8(0x20);
+            for (; end - p >= 32; p += 32) {
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                // Bytes from 0x80 are negative, so less than 0x20 as signed.
+                const __m256i t3 = nonASCII ? _mm256_cmpgt_epi8(limit, s) : _mm256_cmpeq_epi8(_mm256_max_epu8(s, sp), sp);
+                const __m256i x = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(s, dq), _mm256_cmpeq_epi8(s, bs)), t3);
+                const unsigned r = static_cast<unsigned>(_mm256_movemask_epi8(x));
+                if (RAPIDJSON_UNLIKELY(r != 0))
+                    return p + internal::CountTrailingZero64(r);
+            }
+        }
+#endif
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+        {
+            const __m128i dq = _mm_set1_epi8('\"');
+            const __m128i bs = _mm_set1_epi8('\\');
+            const __m128i sp = _mm_set1_epi8(0x1F);
+            const __m128i limit = _mm_set1_epi8(0x20);
+            for (; end - p >= 16; p += 16) {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                // s < 0x20 <=> max(s, 0x1F) == 0x1F, and bytes from 0x80 are less than 0x20 as signed.
+                const __m128i t3 = nonASCII ? _mm_cmplt_epi8(s, limit) : _mm_cmpeq_epi8(_mm_max_epu8(s, sp), sp);
+                const __m128i x = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(s, dq), _mm_cmpeq_epi8(s, bs)), t3);
+                const unsigned r = static_cast<unsigned>(_mm_movemask_epi8(x));
+                if (RAPIDJSON_UNLIKELY(r != 0))
+                    return p + internal::CountTrailingZero64(r);
+            }
+        }
+#endif
+        for (; p != end; ++p) {
+            const unsigned char c = static_cast<unsigned char>(*p);
+            if (c < 0x20 || c == '\"' || c == '\\' || (nonASCII && c >= 0x80))
+                break;
+        }
+        return p;
+    }
+
+    //! Writes characters which are already reserved.
+    template <typename Stream>
+    static void PutRunUnsafe(Stream& os, const char* p, size_t count) {
+        for (size_t i = 0; i < count; i++)
+            PutUnsafe(os, static_cast<typename TargetEncoding::Ch>(p[i]));
+    }
+
+    template <typename Encoding, typename Allocator>
+    static void PutRunUnsafe(GenericStringBuffer<Encoding, Allocator>& os, const char* p, size_t count) {
+        RAPIDJSON_STATIC_ASSERT(sizeof(typename Encoding::Ch) == 1);
+        std::memcpy(os.PushUnsafe(count), p, count);
+    }
+
     bool WriteStartObject() { os_->Put('{'); return true; }
     bool WriteEndObject()   { os_->Put('}'); return true; }
     bool WriteStartArray()  { os_->Put('['); return true; }
@@ -498,69 +616,6 @@ inline bool Writer<StringBuffer>::WriteDouble(double d) {
     return true;
 }
 
-#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
-template<>
-inline bool Writer<StringBuffer>::ScanWriteUnescapedString(StringStream& is, size_t length) {
-    if (length < 16)
-        return RAPIDJSON_LIKELY(is.Tell() < length);
-
-    if (!RAPIDJSON_LIKELY(is.Tell() < length))
-        return false;
-
-    const char* p = is.src_;
-    const char* end = is.head_ + length;
-    const char* nextAligned = reinterpret_cast<const char*>((reinterpret_cast<size_t>(p) + 15) & static_cast<size_t>(~15));
-    const char* endAligned = reinterpret_cast<const char*>(reinterpret_cast<size_t>(end) & static_cast<size_t>(~15));
-    if (nextAligned > end)
-        return true;
-
-    while (p != nextAligned)
-        if (*p < 0x20 || *p == '\"' || *p == '\\') {
-            is.src_ = p;
-            return RAPIDJSON_LIKELY(is.Tell() < length);
-        }
-        else
-            os_->PutUnsafe(*p++);
-
-    // The rest of string using SIMD
-    static const char dquote[16] = { '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"', '\"' };
-    static const char bslash[16] = { '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\', '\\' };
-    static const char space[16]  = { 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19 };
-    const __m128i dq = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dquote[0]));
-    const __m128i bs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&bslash[0]));
-    const __m128i sp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&space[0]));
-
-    for (; p != endAligned; p += 16) {
-        const __m128i s = _mm_load_si128(reinterpret_cast<const __m128i *>(p));
-        const __m128i t1 = _mm_cmpeq_epi8(s, dq);
-        const __m128i t2 = _mm_cmpeq_epi8(s, bs);
-        const __m128i t3 = _mm_cmpeq_epi8(_mm_max_epu8(s, sp), sp); // s < 0x20 <=> max(s, 0x19) == 0x19
-        const __m128i x = _mm_or_si128(_mm_or_si128(t1, t2), t3);
-        unsigned short r = static_cast<unsigned short>(_mm_movemask_epi8(x));
-        if (RAPIDJSON_UNLIKELY(r != 0)) {   // some of characters is escaped
-            SizeType len;
-#ifdef _MSC_VER         // Find the index of first escaped
-            unsigned long offset;
-            _BitScanForward(&offset, r);
-            len = offset;
-#else
-            len = static_cast<SizeType>(__builtin_ffs(r) - 1);
-#endif
-            char* q = reinterpret_cast<char*>(os_->PushUnsafe(len));
-            for (size_t i = 0; i < len; i++)
-                q[i] = p[i];
-
-            p += len;
-            break;
-        }
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(os_->PushUnsafe(16)), s);
-    }
-
-    is.src_ = p;
-    return RAPIDJSON_LIKELY(is.Tell() < length);
-}
-#endif // defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
-
 RAPIDJSON_NAMESPACE_END
 
 #ifdef _MSC_VER
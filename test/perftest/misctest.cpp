@@ -79,6 +79,31 @@ TEST_F(Misc, Hoehrmann_IsUTF8) {
     }
 }
 
+TEST_F(Misc, RapidJson_Validate_IsUTF8) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        rapidjson::StringStream is(json_);
+        rapidjson::GenericStringBuffer<rapidjson::UTF8<> > os;
+        bool result = true;
+        while (is.Peek() != '\0' && result) {
+            os.Clear();
+            result = rapidjson::UTF8<>::Validate(is, os);
+        }
+        EXPECT_TRUE(result);
+    }
+}
+
+TEST_F(Misc, RapidJson_Scalar_IsUTF8) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        EXPECT_TRUE(rapidjson::internal::FindInvalidUTF8Scalar(json_, json_ + length_) == json_ + length_);
+    }
+}
+
+TEST_F(Misc, RapidJson_ValidateBuffer_IsUTF8) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        EXPECT_TRUE(rapidjson::UTF8<>::ValidateBuffer(json_, length_));
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // CountDecimalDigit: Count number of decimal places
 
@@ -971,4 +996,169 @@ TEST_F(Misc, itoa64_Writer2_InsituStringStream) { itoa64_Writer_InsituStringStre
 TEST_F(Misc, itoa64_Writer3_InsituStringStream) { itoa64_Writer_InsituStringStream<Writer3<rapidjson::InsituStringStream> >(); }
 TEST_F(Misc, itoa64_Writer4_InsituStringStream) { itoa64_Writer_InsituStringStream<Writer4<rapidjson::InsituStringStream> >(); }
 
+///////////////////////////////////////////////////////////////////////////////
+// atoi/atof: C library against the reader, with digits taken one by one (ByteStream)
+// and in bulk from a contiguous buffer (StringStream).
+
+#include "rapidjson/reader.h"
+
+// A stream which is not a contiguous buffer for the reader.
+struct ByteStream {
+    typedef char Ch;
+    ByteStream(const char* src) : src_(src), head_(src) {}
+    Ch Peek() const { return *src_; }
+    Ch Take() { return *src_++; }
+    size_t Tell() const { return static_cast<size_t>(src_ - head_); }
+    Ch* PutBegin() { return 0; }
+    void Put(Ch) {}
+    void Flush() {}
+    size_t PutEnd(Ch*) { return 0; }
+    const char* src_;
+    const char* head_;
+};
+
+struct NumberSum : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NumberSum> {
+    NumberSum() : i(), d() {}
+    bool Int(int v) { i += v; return true; }
+    bool Uint(unsigned v) { i += v; return true; }
+    bool Double(double v) { d += v; return true; }
+    int64_t i;
+    double d;
+};
+
+// JSON array of the random values, as integers or as coordinate-like decimals.
+static std::string NumberArray(bool decimal) {
+    std::string json = "[";
+    for (size_t j = 0; j < randvalCount; j++) {
+        char buffer[32];
+        if (decimal)
+            sprintf(buffer, "%.15g", randval[j] / 10007.0);
+        else
+            sprintf(buffer, "%d", randval[j] * 1000 + static_cast<int>(j));
+        if (j)
+            json += ',';
+        json += buffer;
+    }
+    json += ']';
+    return json;
+}
+
+static int64_t atoi_Sum() {
+    int64_t sum = 0;
+    for (size_t j = 0; j < randvalCount; j++)
+        sum += randval[j] * 1000 + static_cast<int>(j);
+    return sum;
+}
+
+TEST_F(Misc, atoi_strtol) {
+    const std::string json = NumberArray(false);
+    for (size_t i = 0; i < kItoaTrialCount; i++) {
+        int64_t sum = 0;
+        for (const char* p = json.c_str() + 1; *p != '\0'; p++)
+            sum += strtol(p, const_cast<char**>(&p), 10);
+        EXPECT_EQ(atoi_Sum(), sum);
+    }
+}
+
+template <typename Stream>
+static void atoi_Reader() {
+    const std::string json = NumberArray(false);
+    rapidjson::Reader reader;
+    for (size_t i = 0; i < kItoaTrialCount; i++) {
+        Stream s(json.c_str());
+        NumberSum h;
+        reader.Parse(s, h);
+        EXPECT_EQ(atoi_Sum(), h.i);
+    }
+}
+
+TEST_F(Misc, atoi_Reader_ByteStream) { atoi_Reader<ByteStream>(); }
+TEST_F(Misc, atoi_Reader_StringStream) { atoi_Reader<rapidjson::StringStream>(); }
+
+TEST_F(Misc, atof_strtod) {
+    const std::string json = NumberArray(true);
+    for (size_t i = 0; i < kItoaTrialCount; i++) {
+        double sum = 0;
+        for (const char* p = json.c_str() + 1; *p != '\0'; p++)
+            sum += strtod(p, const_cast<char**>(&p));
+        EXPECT_GT(sum, 0.0);
+    }
+}
+
+template <typename Stream>
+static void atof_Reader() {
+    const std::string json = NumberArray(true);
+    rapidjson::Reader reader;
+    for (size_t i = 0; i < kItoaTrialCount; i++) {
+        Stream s(json.c_str());
+        NumberSum h;
+        reader.Parse(s, h);
+        EXPECT_GT(h.d, 0.0);
+    }
+}
+
+TEST_F(Misc, atof_Reader_ByteStream) { atof_Reader<ByteStream>(); }
+TEST_F(Misc, atof_Reader_StringStream) { atof_Reader<rapidjson::StringStream>(); }
+
+////////////////////////////////////////////////////////////////////////////////
+// dtoa: the shortest digits from Grisu2 against Schubfach (RAPIDJSON_SCHUBFACH),
+// both formatted the same way as Writer::WriteDouble().
+
+#include <cmath>
+
+typedef void (*DtoaDigits)(double, char*, int*, int*);
+
+template <DtoaDigits digits>
+static char* dtoa_Format(double value, char* buffer) {
+    if (value < 0) {
+        *buffer++ = '-';
+        value = -value;
+    }
+    int length, K;
+    digits(value, buffer, &length, &K);
+    return rapidjson::internal::Prettify(buffer, length, K, 324);
+}
+
+// Random values as full 17-digit doubles, or as short decimals.
+static double DtoaValue(size_t j, bool shortest) {
+    return shortest ? randval[j] / 1000.0 : randval[j] / 10007.0 * std::pow(10.0, static_cast<int>(j % 41) - 20);
+}
+
+template <DtoaDigits digits>
+static void dtoa_Digits(bool shortest) {
+    char buffer[32];
+    size_t length = 0;
+    for (size_t i = 0; i < kItoaTrialCount; i++)
+        for (size_t j = 0; j < randvalCount; j++)
+            length += static_cast<size_t>(dtoa_Format<digits>(DtoaValue(j, shortest), buffer) - buffer);
+    OUTPUT_LENGTH(length);
+}
+
+TEST_F(Misc, dtoa_VerifySchubfach) {
+    char buffer[32];
+    for (size_t j = 0; j < randvalCount * 2; j++) {
+        const double d = DtoaValue(j % randvalCount, j < randvalCount);
+        *dtoa_Format<rapidjson::internal::Grisu2>(d, buffer) = '\0';
+        const size_t grisu2Length = strlen(buffer);
+        EXPECT_EQ(d, strtod(buffer, 0));
+        *dtoa_Format<rapidjson::internal::Schubfach>(d, buffer) = '\0';
+        EXPECT_LE(strlen(buffer), grisu2Length);
+        EXPECT_EQ(d, strtod(buffer, 0));
+    }
+}
+
+TEST_F(Misc, dtoa_Grisu2) { dtoa_Digits<rapidjson::internal::Grisu2>(false); }
+TEST_F(Misc, dtoa_Schubfach) { dtoa_Digits<rapidjson::internal::Schubfach>(false); }
+TEST_F(Misc, dtoa_Grisu2_Short) { dtoa_Digits<rapidjson::internal::Grisu2>(true); }
+TEST_F(Misc, dtoa_Schubfach_Short) { dtoa_Digits<rapidjson::internal::Schubfach>(true); }
+
+TEST_F(Misc, dtoa_sprintf) {
+    char buffer[32];
+    size_t length = 0;
+    for (size_t i = 0; i < kItoaTrialCount; i++)
+        for (size_t j = 0; j < randvalCount; j++)
+            length += static_cast<size_t>(sprintf(buffer, "%.17g", DtoaValue(j, false)));
+    OUTPUT_LENGTH(length);
+}
+
 #endif // TEST_MISC
@@ -29,6 +29,9 @@
 #elif defined(__SSE2__)
 #  define RAPIDJSON_SSE2
 #endif
+#if defined(__AVX2__)
+#  define RAPIDJSON_AVX2
+#endif
 
 #define RAPIDJSON_HAS_STDSTRING 1
 
@@ -21,10 +21,24 @@
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/filereadstream.h"
+#include "rapidjson/memorymappedfile.h"
 #include "rapidjson/encodedstream.h"
 #include "rapidjson/memorystream.h"
+#include "rapidjson/tapedocument.h"
+#include "rapidjson/lazydocument.h"
+#include "rapidjson/keyset.h"
+#include "rapidjson/elementreader.h"
 
-#ifdef RAPIDJSON_SSE2
+#if RAPIDJSON_HAS_CXX11_THREAD
+#include "rapidjson/ndjson.h"
+#include "rapidjson/parallelparser.h"
+#include "rapidjson/threadcachingallocator.h"
+#include <thread>
+#endif
+
+#ifdef RAPIDJSON_AVX2
+#define SIMD_SUFFIX(name) name##_AVX2
+#elif defined(RAPIDJSON_SSE2)
 #define SIMD_SUFFIX(name) name##_SSE2
 #elif defined(RAPIDJSON_SSE42)
 #define SIMD_SUFFIX(name) name##_SSE42
@@ -95,6 +109,33 @@ TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler)) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(StructuralIndexer)) {
+    internal::Stack<CrtAllocator> index(0, 0);
+    for (size_t i = 0; i < kTrialCount; i++) {
+        index.Clear();
+        EXPECT_FALSE(internal::StructuralIndexer::Build(json_, length_, index));
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_StructuralIndex)) {
+    Reader reader;  // Reuse the index buffer
+    for (size_t i = 0; i < kTrialCount; i++) {
+        StringStream s(json_);
+        BaseReaderHandler<> h;
+        EXPECT_TRUE(reader.Parse<kParseStructuralIndexFlag>(s, h));
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParseInsitu_DummyHandler_StructuralIndex)) {
+    Reader reader;
+    for (size_t i = 0; i < kTrialCount; i++) {
+        memcpy(temp_, json_, length_ + 1);
+        InsituStringStream s(temp_);
+        BaseReaderHandler<> h;
+        EXPECT_TRUE(reader.Parse<kParseInsituFlag | kParseStructuralIndexFlag>(s, h));
+    }
+}
+
 #define TEST_TYPED(index, Name)\
 TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_##Name)) {\
     for (size_t i = 0; i < kTrialCount * 10; i++) {\
@@ -133,6 +174,53 @@ TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_FullPrecision)) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_FullPrecision_Floats)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        StringStream s(types_[1]);
+        BaseReaderHandler<> h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<kParseFullPrecisionFlag>(s, h));
+    }
+}
+
+// Longitude/latitude pairs in shortest round-trip form, mostly 15 to 17 significant
+// digits, which are out of reach of the exact fast path of full precision parsing.
+static void MakeCoordinates(StringBuffer& sb, size_t count) {
+    Writer<StringBuffer> writer(sb);
+    unsigned seed = 1;
+    writer.StartArray();
+    for (size_t i = 0; i < count; i++) {
+        writer.StartArray();
+        for (int j = 0; j < 2; j++) {
+            seed = seed * 1103515245u + 12345u;
+            const double unit = static_cast<double>(seed) / 4294967296.0;
+            writer.Double(j == 0 ? unit * 360.0 - 180.0 : unit * 180.0 - 90.0);
+        }
+        writer.EndArray();
+    }
+    writer.EndArray();
+}
+
+template <unsigned parseFlags>
+static void TestReaderParseCoordinates(size_t trialCount) {
+    StringBuffer sb;
+    MakeCoordinates(sb, 100000);
+    for (size_t i = 0; i < trialCount; i++) {
+        StringStream s(sb.GetString());
+        BaseReaderHandler<> h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<parseFlags>(s, h));
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_Coordinates)) {
+    TestReaderParseCoordinates<kParseDefaultFlags>(kTrialCount / 10);
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_Coordinates_FullPrecision)) {
+    TestReaderParseCoordinates<kParseFullPrecisionFlag>(kTrialCount / 10);
+}
+
 TEST_F(RapidJson, SIMD_SUFFIX(ReaderParseIterative_DummyHandler)) {
     for (size_t i = 0; i < kTrialCount; i++) {
         StringStream s(json_);
@@ -161,6 +249,37 @@ TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_ValidateEncoding)) {
     }
 }
 
+// Skips every member of the root object, so the whole input is scanned structurally.
+struct SkipMembersHandler : public BaseReaderHandler<UTF8<>, SkipMembersHandler> {
+    SkipMembersHandler() : depth_() {}
+    bool Key(const char*, SizeType, bool) { return true; }
+    bool StartObject() { depth_++; return true; }
+    bool StartArray() { depth_++; return true; }
+    bool EndObject(SizeType) { depth_--; return true; }
+    bool EndArray(SizeType) { depth_--; return true; }
+    bool SkipValue() { return depth_ > 0; }
+    unsigned depth_;
+};
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_SkipValue)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        StringStream s(json_);
+        SkipMembersHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<kParseSkipValueFlag>(s, h));
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParseInsitu_SkipValue)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        memcpy(temp_, json_, length_ + 1);
+        InsituStringStream s(temp_);
+        SkipMembersHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<kParseSkipValueFlag | kParseInsituFlag>(s, h));
+    }
+}
+
 TEST_F(RapidJson, SIMD_SUFFIX(DocumentParseInsitu_MemoryPoolAllocator)) {
     for (size_t i = 0; i < kTrialCount; i++) {
         memcpy(temp_, json_, length_ + 1);
@@ -187,6 +306,14 @@ TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_MemoryPoolAllocator)) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_MemoryPoolAllocator_StructuralIndex)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        Document doc;
+        doc.Parse<kParseStructuralIndexFlag>(json_);
+        ASSERT_TRUE(doc.IsObject());
+    }
+}
+
 TEST_F(RapidJson, SIMD_SUFFIX(DocumentParseLength_MemoryPoolAllocator)) {
     for (size_t i = 0; i < kTrialCount; i++) {
         Document doc;
@@ -223,6 +350,116 @@ TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_CrtAllocator)) {
     }
 }
 
+// The small samples next to sample.json, as a stream of messages.
+class RapidJsonSamples : public RapidJson {
+public:
+    RapidJsonSamples() : samples_() {}
+
+    virtual void SetUp() {
+        RapidJson::SetUp();
+
+        const char* names[] = { "glossary.json", "menu.json", "webapp.json", "widget.json" };
+        const size_t directoryLength = strlen(filename_) - strlen("sample.json");
+        for (size_t i = 0; i < 4; i++) {
+            char filename[256];
+            sprintf(filename, "%.*s%s", static_cast<int>(directoryLength), filename_, names[i]);
+            FILE* fp = fopen(filename, "rb");
+            ASSERT_TRUE(fp != 0);
+            fseek(fp, 0, SEEK_END);
+            size_t length = (size_t)ftell(fp);
+            fseek(fp, 0, SEEK_SET);
+            samples_[i] = (char*)malloc(length + 1);
+            ASSERT_EQ(length, fread(samples_[i], 1, length, fp));
+            samples_[i][length] = '\0';
+            fclose(fp);
+        }
+    }
+
+    virtual void TearDown() {
+        RapidJson::TearDown();
+        for (size_t i = 0; i < 4; i++) {
+            free(samples_[i]);
+            samples_[i] = 0;
+        }
+    }
+
+protected:
+    char* samples_[4];
+};
+
+// Each message parsed into a new document.
+TEST_F(RapidJsonSamples, SIMD_SUFFIX(DocumentParse_Samples_NewDocument)) {
+    for (size_t i = 0; i < kTrialCount * 100; i++)
+        for (size_t j = 0; j < 4; j++) {
+            Document doc;
+            doc.Parse(samples_[j]);
+            ASSERT_TRUE(doc.IsObject());
+        }
+}
+
+// Each message parsed into the same document after Reset(), without heap allocations.
+TEST_F(RapidJsonSamples, SIMD_SUFFIX(DocumentParse_Samples_Reset)) {
+    GenericDocument<UTF8<>, MemoryPoolAllocator<>, MemoryPoolAllocator<> > doc;
+    for (size_t i = 0; i < kTrialCount * 100; i++)
+        for (size_t j = 0; j < 4; j++) {
+            doc.Reset().Parse(samples_[j]);
+            ASSERT_TRUE(doc.IsObject());
+        }
+}
+
+#if RAPIDJSON_HAS_CXX11_THREAD
+
+TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_ThreadCachingAllocator)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        memcpy(temp_, json_, length_ + 1);
+        GenericDocument<UTF8<>, ThreadCachingAllocator> doc;
+        doc.Parse(temp_);
+        ASSERT_TRUE(doc.IsObject());
+    }
+}
+
+// Builds, modifies and destroys documents on several threads at once, trialCount documents in total.
+template <typename Allocator>
+static void TestMultithreadedAllocation(const char* json, size_t trialCount, unsigned threadCount) {
+    typedef GenericDocument<UTF8<>, Allocator> DocumentType;
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < threadCount; t++)
+        threads.push_back(std::thread([json, trialCount, threadCount]() {
+            for (size_t i = 0; i < trialCount / threadCount; i++) {
+                DocumentType doc;
+                doc.Parse(json);
+                EXPECT_TRUE(doc.IsObject());
+                // Churn typical of editing a DOM: members removed and values appended.
+                for (typename DocumentType::MemberIterator m = doc.MemberBegin(); m != doc.MemberEnd(); ) {
+                    if (m->value.IsArray()) {
+                        m->value.PushBack(static_cast<unsigned>(i), doc.GetAllocator());
+                        ++m;
+                    }
+                    else
+                        m = doc.EraseMember(m);
+                }
+            }
+        }));
+    for (unsigned t = 0; t < threadCount; t++)
+        threads[t].join();
+}
+
+#define TEST_MULTITHREADED_ALLOCATION(Name, threadCount) \
+TEST_F(RapidJson, MultithreadedAllocation_CrtAllocator_##Name) { \
+    TestMultithreadedAllocation<CrtAllocator>(json_, kTrialCount, threadCount); \
+} \
+TEST_F(RapidJson, MultithreadedAllocation_MemoryPoolAllocator_##Name) { \
+    TestMultithreadedAllocation<MemoryPoolAllocator<> >(json_, kTrialCount, threadCount); \
+} \
+TEST_F(RapidJson, MultithreadedAllocation_ThreadCachingAllocator_##Name) { \
+    TestMultithreadedAllocation<ThreadCachingAllocator>(json_, kTrialCount, threadCount); \
+}
+TEST_MULTITHREADED_ALLOCATION(1Thread, 1)
+TEST_MULTITHREADED_ALLOCATION(4Threads, 4)
+TEST_MULTITHREADED_ALLOCATION(8Threads, 8)
+
+#endif // RAPIDJSON_HAS_CXX11_THREAD
+
 TEST_F(RapidJson, SIMD_SUFFIX(DocumentParseEncodedInputStream_MemoryStream)) {
     for (size_t i = 0; i < kTrialCount; i++) {
         MemoryStream ms(json_, length_);
@@ -275,6 +512,305 @@ TEST_F(RapidJson, DocumentTraverse) {
     }
 }
 
+// Parsing and summing types/floats.json, an array of numbers, with and without kParsePackNumberArraysFlag
+// or kParseNumberRunsFlag.
+TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_Floats)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        Document doc;
+        doc.Parse(types_[1]);
+        ASSERT_TRUE(doc.IsArray());
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_Floats_PackNumberArrays)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        Document doc;
+        doc.Parse<kParsePackNumberArraysFlag>(types_[1]);
+        ASSERT_TRUE(doc.IsDoubleArray());
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(DocumentParse_Floats_NumberRuns)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        Document doc;
+        doc.Parse<kParseNumberRunsFlag>(types_[1]);
+        ASSERT_TRUE(doc.IsArray());
+    }
+}
+
+// Sums the numbers one by one, or by runs with kParseNumberRunsFlag.
+struct SumHandler : public BaseReaderHandler<UTF8<>, SumHandler> {
+    SumHandler() : sum_() {}
+    bool Double(double d) { sum_ += d; return true; }
+    bool Doubles(const double* values, SizeType count) {
+        for (SizeType i = 0; i < count; i++)
+            sum_ += values[i];
+        return true;
+    }
+    double sum_;
+};
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_SumFloats)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        StringStream s(types_[1]);
+        SumHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse(s, h));
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_SumFloats_NumberRuns)) {
+    for (size_t i = 0; i < kTrialCount * 10; i++) {
+        StringStream s(types_[1]);
+        SumHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<kParseNumberRunsFlag>(s, h));
+    }
+}
+
+TEST_F(RapidJson, DocumentSum_Floats) {
+    const Value& a = typesDoc_[1];
+    double expected = 0;
+    for (size_t i = 0; i < kTrialCount * 100; i++) {
+        double sum = 0;
+        for (Value::ConstValueIterator v = a.Begin(); v != a.End(); ++v)
+            sum += v->GetDouble();
+        if (i == 0)
+            expected = sum;
+        EXPECT_EQ(expected, sum);
+    }
+}
+
+TEST_F(RapidJson, DocumentSum_Floats_PackNumberArrays) {
+    Document doc;
+    doc.Parse<kParsePackNumberArraysFlag>(types_[1]);
+    const double* p = doc.GetDoubleArray();
+    double expected = 0;
+    for (size_t i = 0; i < kTrialCount * 100; i++) {
+        double sum = 0;
+        for (SizeType j = 0; j < doc.Size(); j++)
+            sum += p[j];
+        if (i == 0)
+            expected = sum;
+        EXPECT_EQ(expected, sum);
+    }
+}
+
+// An object keyed by ids, as in dictionaries of records.
+static void MakeIdObject(Document& d, SizeType n) {
+    d.SetObject();
+    for (SizeType i = 0; i < n; i++) {
+        char name[16];
+        sprintf(name, "id%08u", i * 7919u);
+        d.AddMember(Value(name, d.GetAllocator()).Move(), Value(i).Move(), d.GetAllocator());
+    }
+}
+
+TEST_F(RapidJson, DocumentFindMember) {
+    Document d;
+    MakeIdObject(d, 1000);
+    for (size_t i = 0; i < kTrialCount; i++) {
+        unsigned sum = 0;
+        for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+            sum += d.FindMember(m->name)->value.GetUint();
+        EXPECT_EQ(499500u, sum);
+    }
+}
+
+// Lookups of names which are not members, as when checking for optional ones.
+TEST_F(RapidJson, DocumentHasMember_Absent) {
+    Document d;
+    MakeIdObject(d, 1000);
+    const Document& c = d;
+    for (size_t i = 0; i < kTrialCount; i++) {
+        unsigned count = 0;
+        for (SizeType j = 0; j < 1000; j++) {
+            char name[16];
+            sprintf(name, "id%08u", j * 7919u + 1);
+            count += c.HasMember(name);
+        }
+        EXPECT_EQ(0u, count);
+    }
+}
+
+// The same lookups with a scan of all members, as FindMember() does without a hash index.
+TEST_F(RapidJson, DocumentFindMember_LinearScan) {
+    Document d;
+    MakeIdObject(d, 1000);
+    for (size_t i = 0; i < kTrialCount / 10; i++) {
+        unsigned sum = 0;
+        for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m) {
+            Value::ConstMemberIterator found = d.MemberBegin();
+            while (!(found->name == m->name))
+                ++found;
+            sum += found->value.GetUint();
+        }
+        EXPECT_EQ(499500u, sum);
+    }
+}
+
+// Lookups of the names of a small object, which FindMember() scans without a hash index,
+// against the IDs of the same names in a KeySet.
+TEST_F(RapidJson, DocumentFindMember_SmallObject) {
+    Document d;
+    MakeIdObject(d, 16);
+    for (size_t i = 0; i < kTrialCount; i++) {
+        unsigned sum = 0;
+        for (int j = 0; j < 100000; j++)
+            for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+                sum += d.FindMember(m->name)->value.GetUint();
+        EXPECT_EQ(12000000u, sum);
+    }
+}
+
+TEST_F(RapidJson, KeySetFind_SmallObject) {
+    Document d;
+    MakeIdObject(d, 16);
+    KeySet keys;
+    for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+        keys.Add(KeySet::StringRefType(m->name.GetString(), m->name.GetStringLength()));
+    keys.Build();
+    for (size_t i = 0; i < kTrialCount; i++) {
+        unsigned sum = 0;
+        for (int j = 0; j < 100000; j++)
+            for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+                sum += static_cast<unsigned>(keys.Find(m->name));
+        EXPECT_EQ(12000000u, sum);
+    }
+}
+
+// Newline-delimited JSON with each element of the types documents on its own line,
+// repeated to about the size of sample.json.
+static void MakeNDJson(const Document* docs, size_t docCount, StringBuffer& ndjson, size_t& recordCount) {
+    recordCount = 0;
+    for (int repeat = 0; repeat < 12; repeat++)
+        for (size_t j = 0; j < docCount; j++)
+            for (Value::ConstValueIterator v = docs[j].Begin(); v != docs[j].End(); ++v) {
+                Writer<StringBuffer> writer(ndjson);
+                v->Accept(writer);
+                ndjson.Put('\n');
+                recordCount++;
+            }
+}
+
+TEST_F(RapidJson, DocumentParse_NDJson_Sequential) {
+    StringBuffer ndjson;
+    size_t recordCount;
+    MakeNDJson(typesDoc_, 7, ndjson, recordCount);
+    const char* json = ndjson.GetString();
+    const char* end = json + ndjson.GetSize();
+
+    Document doc;
+    for (size_t i = 0; i < kTrialCount; i++) {
+        size_t count = 0;
+        for (const char* p = json; p < end; ) {
+            const char* newline = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(end - p)));
+            doc.Parse(p, static_cast<size_t>(newline - p));
+            EXPECT_FALSE(doc.HasParseError());
+            count++;
+            p = newline + 1;
+        }
+        EXPECT_EQ(recordCount, count);
+    }
+}
+
+#if RAPIDJSON_HAS_CXX11_THREAD
+
+struct NDJsonCounter {
+    NDJsonCounter() : count() {}
+    bool operator()(const Value&, size_t) { count++; return true; }
+    size_t count;
+};
+
+static void TestNDJsonParser(const Document* docs, size_t docCount, size_t trialCount, unsigned threadCount) {
+    StringBuffer ndjson;
+    size_t recordCount;
+    MakeNDJson(docs, docCount, ndjson, recordCount);
+
+    NDJsonParser parser(threadCount);
+    for (size_t i = 0; i < trialCount; i++) {
+        NDJsonCounter counter;
+        EXPECT_FALSE(parser.Parse(ndjson.GetString(), ndjson.GetSize(), counter).IsError());
+        EXPECT_EQ(recordCount, counter.count);
+    }
+}
+
+// Scaling across worker threads, compare with DocumentParse_NDJson_Sequential.
+#define TEST_NDJSON_PARSER(Name, threadCount) \
+TEST_F(RapidJson, NDJsonParser_##Name) { \
+    TestNDJsonParser(typesDoc_, 7, kTrialCount, threadCount); \
+}
+TEST_NDJSON_PARSER(1Thread, 1)
+TEST_NDJSON_PARSER(2Threads, 2)
+TEST_NDJSON_PARSER(4Threads, 4)
+TEST_NDJSON_PARSER(8Threads, 8)
+TEST_NDJSON_PARSER(HardwareConcurrency, 0)
+
+// One array of the elements of the types documents, like the features of a
+// large FeatureCollection, the same size as the NDJSON above.
+static void MakeArray(const Document* docs, size_t docCount, StringBuffer& json, size_t& elementCount) {
+    StringBuffer ndjson;
+    MakeNDJson(docs, docCount, ndjson, elementCount);
+    json.Put('[');
+    for (const char* p = ndjson.GetString(); *p; p++)
+        json.Put(*p == '\n' ? (p[1] ? ',' : ']') : *p);
+}
+
+TEST_F(RapidJson, DocumentParse_LargeArray_Sequential) {
+    StringBuffer json;
+    size_t elementCount;
+    MakeArray(typesDoc_, 7, json, elementCount);
+
+    for (size_t i = 0; i < kTrialCount; i++) {
+        Document doc;
+        doc.Parse(json.GetString(), json.GetSize());
+        EXPECT_EQ(elementCount, doc.Size());
+    }
+}
+
+// One element at a time in constant memory, compare with DocumentParse_LargeArray_Sequential.
+TEST_F(RapidJson, ElementReader_LargeArray) {
+    StringBuffer json;
+    size_t elementCount;
+    MakeArray(typesDoc_, 7, json, elementCount);
+
+    for (size_t i = 0; i < kTrialCount; i++) {
+        StringStream s(json.GetString());
+        ElementReader r(s);
+        size_t count = 0;
+        while (r.Next())
+            count++;
+        EXPECT_FALSE(r.HasParseError());
+        EXPECT_EQ(elementCount, count);
+    }
+}
+
+static void TestParallelParser(const Document* docs, size_t docCount, size_t trialCount, unsigned threadCount) {
+    StringBuffer json;
+    size_t elementCount;
+    MakeArray(docs, docCount, json, elementCount);
+
+    ParallelParser parser(threadCount, 64 * 1024);
+    for (size_t i = 0; i < trialCount; i++) {
+        Document doc;
+        EXPECT_FALSE(parser.Parse(doc, json.GetString(), json.GetSize()).IsError());
+        EXPECT_EQ(elementCount, doc.Size());
+        EXPECT_EQ(threadCount != 1, parser.IsParallel());
+    }
+}
+
+// Scaling across threads, compare with DocumentParse_LargeArray_Sequential.
+#define TEST_PARALLEL_PARSER(Name, threadCount) \
+TEST_F(RapidJson, ParallelParser_##Name) { \
+    TestParallelParser(typesDoc_, 7, kTrialCount, threadCount); \
+}
+TEST_PARALLEL_PARSER(1Thread, 1)
+TEST_PARALLEL_PARSER(2Threads, 2)
+TEST_PARALLEL_PARSER(4Threads, 4)
+TEST_PARALLEL_PARSER(8Threads, 8)
+
+#endif // RAPIDJSON_HAS_CXX11_THREAD
+
 #ifdef __GNUC__
 RAPIDJSON_DIAG_PUSH
 RAPIDJSON_DIAG_OFF(effc++)
@@ -301,6 +837,73 @@ TEST_F(RapidJson, DocumentAccept) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(TapeDocumentParse)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        TapeDocument doc;
+        doc.Parse(json_);
+        ASSERT_TRUE(doc.IsObject());
+    }
+}
+
+// The same document for all trials, which keeps its buffers.
+TEST_F(RapidJson, SIMD_SUFFIX(TapeDocumentParse_Reuse)) {
+    TapeDocument doc;
+    for (size_t i = 0; i < kTrialCount; i++) {
+        doc.Parse(json_);
+        ASSERT_TRUE(doc.IsObject());
+    }
+}
+
+TEST_F(RapidJson, TapeDocumentTraverse) {
+    TapeDocument doc;
+    doc.Parse(json_);
+    for (size_t i = 0; i < kTrialCount; i++) {
+        size_t count = Traverse(doc);
+        EXPECT_EQ(4339u, count);
+    }
+}
+
+TEST_F(RapidJson, TapeDocumentAccept) {
+    TapeDocument doc;
+    doc.Parse(json_);
+    for (size_t i = 0; i < kTrialCount; i++) {
+        ValueCounter counter;
+        doc.Accept(counter);
+        EXPECT_EQ(4339u, counter.count_);
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(LazyDocumentParse)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        LazyDocument doc;
+        doc.Parse(json_);
+        ASSERT_TRUE(doc.IsObject());
+    }
+}
+
+// Reads the members of the root only, compare with DocumentParse_MemoryPoolAllocator.
+TEST_F(RapidJson, SIMD_SUFFIX(LazyDocumentParse_RootMembers)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        LazyDocument doc;
+        doc.Parse(json_);
+        size_t objects = 0;
+        for (LazyValue::ConstMemberIterator m = doc.MemberBegin(); m != doc.MemberEnd(); ++m)
+            objects += m->value.IsObject();
+        EXPECT_LT(0u, objects);
+    }
+}
+
+// Parses every value, compare with DocumentParse_MemoryPoolAllocator and DocumentAccept.
+TEST_F(RapidJson, SIMD_SUFFIX(LazyDocumentParse_Accept)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        LazyDocument doc;
+        doc.Parse(json_);
+        ValueCounter counter;
+        doc.Accept(counter);
+        EXPECT_EQ(4339u, counter.count_);
+    }
+}
+
 struct NullStream {
     typedef char Ch;
 
@@ -332,6 +935,26 @@ TEST_F(RapidJson, SIMD_SUFFIX(Writer_StringBuffer)) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(Writer_StringBuffer_ValidateEncoding)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        StringBuffer s(0, 1024 * 1024);
+        Writer<StringBuffer, UTF8<>, UTF8<>, CrtAllocator, kWriteValidateEncodingFlag> writer(s);
+        doc_.Accept(writer);
+        const char* str = s.GetString();
+        (void)str;
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(Writer_StringBuffer_ASCII)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        StringBuffer s(0, 2048 * 1024);
+        Writer<StringBuffer, UTF8<>, ASCII<> > writer(s);
+        doc_.Accept(writer);
+        const char* str = s.GetString();
+        (void)str;
+    }
+}
+
 #define TEST_TYPED(index, Name)\
 TEST_F(RapidJson, SIMD_SUFFIX(Writer_StringBuffer_##Name)) {\
     for (size_t i = 0; i < kTrialCount * 10; i++) {\
@@ -432,6 +1055,26 @@ TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_FileReadStream)) {
     }
 }
 
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParse_DummyHandler_MemoryMappedFile)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        MemoryMappedFile file(filename_);
+        StringStream s = file.GetStream();
+        BaseReaderHandler<> h;
+        Reader reader;
+        reader.Parse(s, h);
+    }
+}
+
+TEST_F(RapidJson, SIMD_SUFFIX(ReaderParseInsitu_DummyHandler_MemoryMappedFile)) {
+    for (size_t i = 0; i < kTrialCount; i++) {
+        MemoryMappedFile file(filename_, MemoryMappedFile::kCopyOnWrite);
+        InsituStringStream s = file.GetInsituStream();
+        BaseReaderHandler<> h;
+        Reader reader;
+        reader.Parse<kParseInsituFlag>(s, h);
+    }
+}
+
 TEST_F(RapidJson, StringBuffer) {
     StringBuffer sb;
     for (int i = 0; i < 32 * 1024 * 1024; i++)
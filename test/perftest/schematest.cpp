@@ -213,4 +213,33 @@ TEST_F(Schema, TestSuite) {
     printf("%d tests per trial\n", testCount / trialCount);
 }
 
+// Validates uniqueItems of an array of 100k distinct objects, which needs a
+// set of the hash codes of the items.
+TEST(SchemaValidator, UniqueItems_100k) {
+    Document sd;
+    sd.Parse("{\"type\": \"array\", \"uniqueItems\": true}");
+    SchemaDocument schema(sd);
+
+    std::string json = "[";
+    for (unsigned i = 0; i < 100000; i++) {
+        char item[64];
+        sprintf(item, "%s{\"id\": %u, \"name\": \"item %u\"}", i ? ", " : "", i, i);
+        json += item;
+    }
+    json += "]";
+    Document d;
+    d.Parse(json.c_str());
+    ASSERT_FALSE(d.HasParseError());
+
+    const int trialCount = 10;
+    clock_t start = clock();
+    for (int i = 0; i < trialCount; i++) {
+        SchemaValidator validator(schema);
+        EXPECT_TRUE(d.Accept(validator));
+    }
+    clock_t end = clock();
+    double duration = double(end - start) / CLOCKS_PER_SEC;
+    printf("%d trials in %f s -> %f trials per sec\n", trialCount, duration, trialCount / duration);
+}
+
 #endif
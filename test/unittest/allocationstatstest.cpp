@@ -0,0 +1,93 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+// 
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed 
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR 
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the 
+// specific language governing permissions and limitations under the License.
+
+// The statistics change the layout of the allocators and of the parsing
+// stacks, so these tests are built in their own executable.
+#define RAPIDJSON_ALLOCATION_STATS 1
+
+#include "unittest.h"
+#include "rapidjson/document.h"
+#include <string>
+
+using namespace rapidjson;
+
+TEST(Allocator, AllocationStats) {
+    CrtAllocator c;
+    CrtAllocator::Free(c.Realloc(c.Malloc(10), 10, 20));
+    c.Malloc(0);
+    EXPECT_EQ(2u, c.GetAllocationStats().allocationCount);
+    EXPECT_EQ(30u, c.GetAllocationStats().allocatedBytes);
+    EXPECT_EQ(0u, c.GetAllocationStats().chunkCount);
+
+    MemoryPoolAllocator<> a(256);
+    void* p = a.Malloc(96);
+    a.Realloc(p, 96, 128);  // Expanded in place
+    a.Malloc(200);          // New chunk
+    const AllocationStats& stats = a.GetAllocationStats();
+    EXPECT_EQ(2u, stats.allocationCount);
+    EXPECT_EQ(328u, stats.allocatedBytes);
+    EXPECT_EQ(2u, stats.chunkCount);
+    EXPECT_EQ(512u, stats.chunkBytes);
+    EXPECT_EQ(0u, stats.stackResizeCount);
+}
+
+TEST(Document, AllocationStats) {
+    Document doc;
+    doc.Parse("[1,2,3,{\"a\":\"a string too long to be short\"}]");
+    const AllocationStats& stats = doc.GetAllocationStats();
+    EXPECT_EQ(3u, stats.allocationCount);  // Elements, members and the copied string
+    EXPECT_EQ(RAPIDJSON_ALIGN(4 * sizeof(Value)) + RAPIDJSON_ALIGN(sizeof(Value::Member)) + RAPIDJSON_ALIGN(31), stats.allocatedBytes);
+    EXPECT_EQ(1u, stats.chunkCount);
+    EXPECT_EQ(2u, stats.stackResizeCount); // Stacks of the document and of the reader
+    EXPECT_EQ(7 * sizeof(Value), stats.peakStackSize); // Arrays and objects are pushed when they start
+
+    // The chunk is allocated by the first parsing only.
+    doc.Parse("[1,2,3,{\"a\":\"a string too long to be short\"}]");
+    EXPECT_EQ(3u, stats.allocationCount);
+    EXPECT_EQ(0u, stats.chunkCount);
+
+    // CrtAllocator
+    GenericDocument<UTF8<>, CrtAllocator> crtDoc;
+    crtDoc.Parse("{\"a\":[1]}");
+    EXPECT_EQ(2u, crtDoc.GetAllocationStats().allocationCount); // "a" is a short string
+    EXPECT_EQ(0u, crtDoc.GetAllocationStats().chunkCount);
+
+    // A deep document needs a larger stack.
+    std::string deep(1000, '[');
+    deep.append(1000, ']');
+    doc.Parse(deep.c_str());
+    EXPECT_FALSE(doc.HasParseError());
+    EXPECT_EQ(1000 * sizeof(Value), doc.GetAllocationStats().peakStackSize);
+    doc.Parse("[[1,2,3],[4,5,6,7,8,9,10,11,12]]");
+    EXPECT_EQ(12 * sizeof(Value), doc.GetAllocationStats().peakStackSize);
+}
+
+TEST(Reader, AllocationStats) {
+    Reader reader(0, 4);
+    BaseReaderHandler<> h;
+    StringStream s("[\"ab\", \"a longer string\", \"abc\"]");
+    EXPECT_FALSE(reader.Parse(s, h).IsError());
+    AllocationStats stats = reader.GetAllocationStats();
+    EXPECT_EQ(16u, stats.peakStackSize);   // Longest string with its terminator
+    EXPECT_LT(0u, stats.stackResizeCount);  // Depends on how many characters are copied at once
+    EXPECT_LE(16u, stats.stackBytes);
+    EXPECT_EQ(0u, stats.allocationCount);
+
+    // The stack is kept by the reader.
+    StringStream s2("[\"another string\"]");
+    EXPECT_FALSE(reader.Parse(s2, h).IsError());
+    stats = reader.GetAllocationStats();
+    EXPECT_EQ(15u, stats.peakStackSize);
+    EXPECT_EQ(0u, stats.stackResizeCount);
+}
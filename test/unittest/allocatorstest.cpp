@@ -62,6 +62,75 @@ TEST(Allocator, MemoryPoolAllocator) {
     }
 }
 
+TEST(Allocator, MemoryPoolAllocator_Reset) {
+    MemoryPoolAllocator<> a(256);
+    a.Reset();
+    EXPECT_EQ(0u, a.Capacity());
+
+    // Blocks of several chunks are kept in one chunk.
+    for (size_t i = 0; i < 100; i++)
+        EXPECT_TRUE(a.Malloc(96) != 0);
+    const size_t size = a.Size();
+    a.Reset();
+    EXPECT_EQ(0u, a.Size());
+    EXPECT_EQ(size, a.Capacity());
+    for (size_t i = 0; i < 100; i++)
+        EXPECT_TRUE(a.Malloc(96) != 0);
+    EXPECT_EQ(size, a.Capacity());
+
+    // Fewer blocks keep the largest chunk.
+    a.Reset();
+    a.Malloc(96);
+    a.Reset();
+    EXPECT_EQ(size, a.Capacity());
+
+    // The user buffer is kept, with a chunk if it is too small.
+    char buffer[1024];
+    MemoryPoolAllocator<> b(buffer, sizeof(buffer), 256);
+    b.Malloc(96);
+    b.Reset();
+    EXPECT_EQ(0u, b.Size());
+    const size_t bufferCapacity = b.Capacity();
+    EXPECT_GT(sizeof(buffer), bufferCapacity);
+    for (size_t i = 0; i < 20; i++)
+        b.Malloc(96);
+    b.Reset();
+    EXPECT_LT(bufferCapacity, b.Capacity());
+    for (size_t i = 0; i < 20; i++)
+        b.Malloc(96);
+    EXPECT_EQ(20u * 96, b.Size());
+    b.Clear();
+    EXPECT_EQ(bufferCapacity, b.Capacity());
+}
+
+TEST(Allocator, MemoryPoolAllocator_Adopt) {
+    MemoryPoolAllocator<> a(256), empty;
+    char* p = static_cast<char*>(a.Malloc(500));
+    std::memset(p, 'x', 500);
+    const size_t size = a.Size(), capacity = a.Capacity();
+
+    // The user buffer stays the last chunk.
+    char buffer[1024];
+    MemoryPoolAllocator<> b(buffer, sizeof(buffer));
+    b.Malloc(96);
+    b.Adopt(a);
+    b.Adopt(empty);
+    EXPECT_EQ(0u, a.Size());
+    EXPECT_EQ(0u, a.Capacity());
+    EXPECT_EQ(size + 96, b.Size());
+    EXPECT_LT(capacity, b.Capacity());
+    EXPECT_EQ('x', p[499]);
+    b.Clear();
+    EXPECT_EQ(0u, b.Size());
+    EXPECT_GT(sizeof(buffer), b.Capacity());
+
+    // A is still usable, and an allocator without chunks can adopt.
+    a.Malloc(10);
+    empty.Adopt(a);
+    EXPECT_EQ(0u, a.Size());
+    EXPECT_LE(10u, empty.Size());
+}
+
 TEST(Allocator, Alignment) {
 #if RAPIDJSON_64BIT == 1
     EXPECT_EQ(RAPIDJSON_UINT64_C2(0x00000000, 0x00000000), RAPIDJSON_ALIGN(0));
@@ -100,3 +169,108 @@ TEST(Allocator, Issue399) {
         }
     }
 }
+
+#if RAPIDJSON_HAS_CXX11_THREAD
+
+#include "rapidjson/threadcachingallocator.h"
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <thread>
+#include <vector>
+
+TEST(Allocator, ThreadCachingAllocator) {
+    ThreadCachingAllocator a;
+    TestAllocator(a);
+
+    // Small and large blocks, resized across size classes
+    for (size_t i = 1; i < 3000; i += 7) {
+        uint8_t* p = static_cast<uint8_t*>(a.Malloc(i));
+        EXPECT_TRUE(p != 0);
+        EXPECT_EQ(0u, reinterpret_cast<size_t>(p) % RAPIDJSON_ALIGN(1));
+        for (size_t j = 0; j < i; j++)
+            p[j] = static_cast<uint8_t>(i + j);
+        uint8_t* q = static_cast<uint8_t*>(a.Realloc(p, i, i * 2));
+        for (size_t j = 0; j < i; j++)
+            EXPECT_EQ(static_cast<uint8_t>(i + j), q[j]);
+        ThreadCachingAllocator::Free(q);
+    }
+
+    // A freed block is reused by the next allocation of its size class
+    void* p = a.Malloc(40);
+    ThreadCachingAllocator::Free(p);
+    EXPECT_EQ(p, a.Malloc(48));
+    ThreadCachingAllocator::Free(p);
+    ThreadCachingAllocator::Free(0);
+}
+
+TEST(Allocator, ThreadCachingAllocator_CrossThreadFree) {
+    const size_t kThreadCount = 4;
+    const size_t kBlockCount = 20000;
+    std::vector<std::vector<uint32_t*> > blocks(kThreadCount);
+
+    // Every thread fills blocks, which the next thread checks and frees.
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; t++)
+        threads.push_back(std::thread([&blocks, t]() {
+            ThreadCachingAllocator a;
+            for (size_t i = 0; i < kBlockCount; i++) {
+                const size_t count = 1 + (i * 7 + t) % 300;
+                uint32_t* block = static_cast<uint32_t*>(a.Malloc(count * sizeof(uint32_t)));
+                for (size_t j = 0; j < count; j++)
+                    block[j] = static_cast<uint32_t>(i);
+                blocks[t].push_back(block);
+            }
+        }));
+    for (size_t t = 0; t < kThreadCount; t++)
+        threads[t].join();
+    threads.clear();
+
+    for (size_t t = 0; t < kThreadCount; t++)
+        threads.push_back(std::thread([&blocks, t]() {
+            const std::vector<uint32_t*>& owned = blocks[(t + 1) % kThreadCount];
+            bool ok = true;
+            for (size_t i = 0; i < owned.size(); i++) {
+                const size_t count = 1 + (i * 7 + (t + 1) % kThreadCount) % 300;
+                for (size_t j = 0; j < count; j++)
+                    ok = ok && owned[i][j] == static_cast<uint32_t>(i);
+                ThreadCachingAllocator::Free(owned[i]);
+            }
+            EXPECT_TRUE(ok);
+        }));
+    for (size_t t = 0; t < kThreadCount; t++)
+        threads[t].join();
+}
+
+TEST(Allocator, ThreadCachingAllocator_Document) {
+    typedef GenericDocument<UTF8<>, ThreadCachingAllocator> DocumentType;
+    const char* json = "{\"hello\":\"world\",\"t\":true,\"n\":null,\"i\":123,\"pi\":3.1416,\"a\":[1,2,3,4,\"a long enough string\"]}";
+
+    // Documents built on one thread, modified and destroyed on another
+    std::vector<DocumentType*> docs;
+    std::thread producer([&docs, json]() {
+        for (int i = 0; i < 1000; i++) {
+            DocumentType* d = new DocumentType;
+            d->Parse(json);
+            docs.push_back(d);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&docs, json]() {
+        for (size_t i = 0; i < docs.size(); i++) {
+            DocumentType& d = *docs[i];
+            EXPECT_FALSE(d.HasParseError());
+            d["a"].PushBack(5, d.GetAllocator());
+            d.EraseMember("hello");
+            StringBuffer buffer;
+            Writer<StringBuffer> writer(buffer);
+            d.Accept(writer);
+            EXPECT_STREQ("{\"t\":true,\"n\":null,\"i\":123,\"pi\":3.1416,\"a\":[1,2,3,4,\"a long enough string\",5]}", buffer.GetString());
+            delete docs[i];
+        }
+    });
+    consumer.join();
+}
+
+#endif // RAPIDJSON_HAS_CXX11_THREAD
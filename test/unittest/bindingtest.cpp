@@ -0,0 +1,210 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+#include "rapidjson/binding.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+
+using namespace rapidjson;
+
+namespace {
+
+struct Point {
+    Point() : x(), y() {}
+    int x;
+    int y;
+
+    template <typename Fields>
+    static void Bind(Fields& f) { f("x", &Point::x)("y", &Point::y); }
+};
+
+struct Shape {
+    Shape() : name(), visible(), id(), size(), scale(), ratio(), origin(), points(), tags(), grid() {}
+    std::string name;
+    bool visible;
+    int64_t id;
+    unsigned size;
+    double scale;
+    float ratio;
+    Point origin;
+    std::vector<Point> points;
+    std::vector<std::string> tags;
+    std::vector<std::vector<uint64_t> > grid;
+};
+
+// A tree of itself.
+struct Node {
+    Node() : value(), children() {}
+    int value;
+    std::vector<Node> children;
+
+    template <typename Fields>
+    static void Bind(Fields& f) { f("value", &Node::value)("children", &Node::children); }
+};
+
+} // namespace
+
+RAPIDJSON_NAMESPACE_BEGIN
+template <>
+struct StructBinding<Shape> {
+    template <typename Fields>
+    static void Declare(Fields& f) {
+        f("name", &Shape::name)
+         ("visible", &Shape::visible)
+         ("id", &Shape::id)
+         ("size", &Shape::size)
+         ("scale", &Shape::scale)
+         ("ratio", &Shape::ratio)
+         ("origin", &Shape::origin)
+         ("points", &Shape::points)
+         ("tags", &Shape::tags)
+         ("grid", &Shape::grid);
+    }
+};
+RAPIDJSON_NAMESPACE_END
+
+template <typename T>
+static std::string Write(const T& value) {
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    EXPECT_TRUE(WriteStruct(writer, value));
+    return buffer.GetString();
+}
+
+TEST(Binding, Parse) {
+    StringStream s(
+        "{\"name\": \"tri\\nangle\", \"visible\": true, \"id\": -5000000000, \"size\": 3, \"scale\": 2, \"ratio\": 0.5,"
+        " \"origin\": {\"y\": 2, \"x\": 1}, \"points\": [{\"x\": 3}, {\"y\": 4}, null], \"tags\": [\"a\", \"b\"],"
+        " \"grid\": [[1, 18446744073709551615], []]}");
+    Shape shape;
+    ParseResult result = ParseStruct(s, shape);
+    ASSERT_TRUE(result) << result.Code();
+
+    EXPECT_EQ("tri\nangle", shape.name);
+    EXPECT_TRUE(shape.visible);
+    EXPECT_EQ(-5000000000LL, shape.id);
+    EXPECT_EQ(3u, shape.size);
+    EXPECT_EQ(2.0, shape.scale);
+    EXPECT_EQ(0.5f, shape.ratio);
+    EXPECT_EQ(1, shape.origin.x);
+    EXPECT_EQ(2, shape.origin.y);
+    ASSERT_EQ(3u, shape.points.size());
+    EXPECT_EQ(3, shape.points[0].x);
+    EXPECT_EQ(0, shape.points[0].y);
+    EXPECT_EQ(4, shape.points[1].y);
+    EXPECT_EQ(0, shape.points[2].x);
+    ASSERT_EQ(2u, shape.tags.size());
+    EXPECT_EQ("b", shape.tags[1]);
+    ASSERT_EQ(2u, shape.grid.size());
+    EXPECT_EQ(RAPIDJSON_UINT64_C2(0xFFFFFFFF, 0xFFFFFFFF), shape.grid[0][1]);
+    EXPECT_TRUE(shape.grid[1].empty());
+}
+
+TEST(Binding, Unknown) {
+    // Unknown members are ignored, with or without kParseSkipValueFlag.
+    const char* json = "{\"a\": {\"x\": [1, {\"y\": 2}]}, \"x\": 7, \"b\": [[]], \"c\": \"s\", \"y\": 8, \"d\": null}";
+    Point p;
+    StringStream s(json);
+    EXPECT_TRUE(ParseStruct(s, p));
+    EXPECT_EQ(7, p.x);
+    EXPECT_EQ(8, p.y);
+
+    Point p2;
+    GenericBindingHandler<Point> handler(p2);
+    Reader reader;
+    StringStream s2(json);
+    EXPECT_TRUE(reader.Parse(s2, handler));
+    EXPECT_EQ(7, p2.x);
+    EXPECT_EQ(8, p2.y);
+}
+
+TEST(Binding, Mismatch) {
+    const char* errors[] = {
+        "{\"x\": \"1\"}",
+        "{\"x\": 1.5}",
+        "{\"x\": 2147483648}",
+        "{\"x\": true}",
+        "{\"x\": {}}",
+        "{\"x\": []}",
+        "[]"
+    };
+    for (size_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++) {
+        Point p;
+        StringStream s(errors[i]);
+        ParseResult result = ParseStruct(s, p);
+        EXPECT_EQ(kParseErrorTermination, result.Code()) << errors[i];
+    }
+
+    Shape shape;
+    StringStream s("{\"size\": -1}");
+    EXPECT_EQ(kParseErrorTermination, ParseStruct(s, shape).Code());
+    StringStream s2("{\"points\": [1]}");
+    EXPECT_EQ(kParseErrorTermination, ParseStruct(s2, shape).Code());
+    StringStream s3("{\"x\": 1");
+    Point p;
+    EXPECT_EQ(kParseErrorObjectMissCommaOrCurlyBracket, ParseStruct(s3, p).Code());
+}
+
+TEST(Binding, Recursive) {
+    Node root;
+    StringStream s("{\"value\": 1, \"children\": [{\"value\": 2}, {\"value\": 3, \"children\": [{\"value\": 4}]}]}");
+    EXPECT_TRUE(ParseStruct(s, root));
+    ASSERT_EQ(2u, root.children.size());
+    EXPECT_EQ(4, root.children[1].children[0].value);
+    EXPECT_EQ("{\"value\":1,\"children\":[{\"value\":2,\"children\":[]},{\"value\":3,\"children\":[{\"value\":4,\"children\":[]}]}]}", Write(root));
+}
+
+TEST(Binding, Write) {
+    Shape shape;
+    shape.name = "s\"q";
+    shape.id = -1;
+    shape.size = 4294967295u;
+    shape.scale = 1.5;
+    shape.origin.x = 9;
+    shape.points.resize(1);
+    shape.tags.push_back("t");
+    shape.grid.resize(1);
+    shape.grid[0].push_back(7);
+    const std::string json = Write(shape);
+    EXPECT_EQ("{\"name\":\"s\\\"q\",\"visible\":false,\"id\":-1,\"size\":4294967295,\"scale\":1.5,\"ratio\":0.0,"
+              "\"origin\":{\"x\":9,\"y\":0},\"points\":[{\"x\":0,\"y\":0}],\"tags\":[\"t\"],\"grid\":[[7]]}", json);
+
+    // Round trip
+    Shape shape2;
+    StringStream s(json.c_str());
+    EXPECT_TRUE(ParseStruct(s, shape2));
+    EXPECT_EQ(json, Write(shape2));
+
+    std::vector<Point> points(2);
+    points[1].y = 1;
+    EXPECT_EQ("[{\"x\":0,\"y\":0},{\"x\":0,\"y\":1}]", Write(points));
+}
+
+TEST(Binding, ManyFields) {
+    // The perfect hash finds every name, and only them.
+    internal::BindingFieldTable<char> table;
+    static const char* names[] = { "a", "b", "c", "ab", "ba", "abc", "id", "name", "value", "values", "x", "y", "z", "", "longer_name_1", "longer_name_2" };
+    const size_t n = sizeof(names) / sizeof(names[0]);
+    for (size_t i = 0; i < n; i++)
+        table.Add(names[i], i, &internal::BindingTraits<int, char>::Type);
+    table.Build();
+    for (size_t i = 0; i < n; i++) {
+        const internal::BindingField<char>* f = table.Find(names[i], internal::StrLen(names[i]));
+        ASSERT_TRUE(f != 0) << names[i];
+        EXPECT_EQ(i, f->offset);
+    }
+    EXPECT_TRUE(table.Find("abcd", 4) == 0);
+    EXPECT_TRUE(table.Find("longer_name_3", 13) == 0);
+}
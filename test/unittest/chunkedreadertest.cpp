@@ -0,0 +1,206 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+
+#include "rapidjson/chunkedreader.h"
+#include "rapidjson/document.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <cstring>
+#include <string>
+
+using namespace rapidjson;
+
+// Parse the whole text with Reader, into a Writer.
+template <unsigned parseFlags>
+static std::string ParseWhole(const char* json, ParseResult& result) {
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    Reader reader;
+    StringStream s(json);
+    result = reader.Parse<parseFlags>(s, writer);
+    return buffer.GetString();
+}
+
+// Parse the text fed in chunks of chunkSize, the first one of firstSize, into a Writer.
+template <unsigned parseFlags>
+static std::string ParseChunks(const char* json, size_t firstSize, size_t chunkSize, ParseResult& result) {
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    GenericChunkedReader<UTF8<>, UTF8<>, parseFlags> reader;
+    const size_t length = std::strlen(json);
+    size_t i = 0;
+    for (size_t n = firstSize; i < length; i += n, n = chunkSize) {
+        if (n > length - i)
+            n = length - i;
+        // Copy the chunk, so that the reader cannot read beyond it.
+        std::string chunk(json + i, n);
+        reader.Feed(chunk.data(), n, writer);
+    }
+    result = reader.Finish(writer);
+    return buffer.GetString();
+}
+
+template <unsigned parseFlags>
+static void TestAllSplits(const char* json) {
+    ParseResult expected;
+    std::string events = ParseWhole<parseFlags>(json, expected);
+    const size_t length = std::strlen(json);
+    for (size_t first = 0; first <= length; first++) {
+        ParseResult result;
+        EXPECT_EQ(events, ParseChunks<parseFlags>(json, first, length, result)) << json << " split at " << first;
+        EXPECT_EQ(expected.Code(), result.Code()) << json << " split at " << first;
+        EXPECT_EQ(expected.Offset(), result.Offset()) << json << " split at " << first;
+    }
+    for (size_t size = 1; size <= 3; size++) {
+        ParseResult result;
+        EXPECT_EQ(events, ParseChunks<parseFlags>(json, size, size, result)) << json << " by " << size;
+        EXPECT_EQ(expected.Code(), result.Code()) << json << " by " << size;
+        EXPECT_EQ(expected.Offset(), result.Offset()) << json << " by " << size;
+    }
+}
+
+TEST(ChunkedReader, Splits) {
+    TestAllSplits<kParseDefaultFlags>(" { \"hello\" : \"wor\\\"ld\\u00e9\", \"t\" : true, \"f\" : false, \"n\": null, \"i\":123, \"pi\": 3.1416e-1, \"a\":[1, -2, {}, []] } ");
+    TestAllSplits<kParseDefaultFlags>("\"\\\\\"");
+    TestAllSplits<kParseDefaultFlags>("12345");
+    TestAllSplits<kParseDefaultFlags>(" null ");
+    TestAllSplits<kParseDefaultFlags>("[[[[\"\xE4\xB8\xAD\"]]]]");
+    TestAllSplits<kParseFullPrecisionFlag>("[0.1234567890123456789, 1e308]");
+    TestAllSplits<kParseNumbersAsStringsFlag>("[1.5, -0]");
+    TestAllSplits<kParseTrailingCommasFlag>("{\"a\": [1,2,],}");
+}
+
+TEST(ChunkedReader, Errors) {
+    TestAllSplits<kParseDefaultFlags>("{\"a\": a}");
+    TestAllSplits<kParseDefaultFlags>("");
+    TestAllSplits<kParseDefaultFlags>("  ");
+    TestAllSplits<kParseDefaultFlags>("{}{}");
+    TestAllSplits<kParseDefaultFlags>("{1}");
+    TestAllSplits<kParseDefaultFlags>("{\"a\", 1}");
+    TestAllSplits<kParseDefaultFlags>("{\"a\"}");
+    TestAllSplits<kParseDefaultFlags>("{\"a\": 1");
+    TestAllSplits<kParseDefaultFlags>("[1 2 3]");
+    TestAllSplits<kParseDefaultFlags>("{\"a: 1");
+    TestAllSplits<kParseDefaultFlags>("[1,2,}");
+    TestAllSplits<kParseDefaultFlags>("[1,,]");
+    TestAllSplits<kParseDefaultFlags>("[1,2,3,]");
+    TestAllSplits<kParseDefaultFlags>("\"ab");
+    TestAllSplits<kParseDefaultFlags>("truE");
+    TestAllSplits<kParseDefaultFlags>("true, false");
+    TestAllSplits<kParseDefaultFlags>("null , null");
+    TestAllSplits<kParseDefaultFlags>("1a");
+    TestAllSplits<kParseDefaultFlags>("[1] \"x");
+    TestAllSplits<kParseDefaultFlags>("[\"\\x\"]");
+    TestAllSplits<kParseDefaultFlags>("[1] /* no comments */");
+    TestAllSplits<kParseValidateEncodingFlag>("[\"\xC3\"]");
+}
+
+TEST(ChunkedReader, Comments) {
+    TestAllSplits<kParseCommentsFlag>("/* a */ [1, // b\n 2/**/,3/***/] // c");
+    TestAllSplits<kParseCommentsFlag>("[1] /* unclosed *");
+    TestAllSplits<kParseCommentsFlag>("[1] / x");
+    TestAllSplits<kParseCommentsFlag>("[1, / 2]");
+    TestAllSplits<kParseCommentsFlag>("[1] // ok");
+}
+
+TEST(ChunkedReader, StopWhenDone) {
+    ParseResult result;
+    EXPECT_EQ("[1]", ParseChunks<kParseStopWhenDoneFlag>("[1] [2", 2, 2, result));
+    EXPECT_FALSE(result.IsError());
+    EXPECT_EQ("1", ParseChunks<kParseStopWhenDoneFlag>("1 x", 1, 1, result));
+    EXPECT_FALSE(result.IsError());
+}
+
+TEST(ChunkedReader, Pending) {
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    ChunkedReader reader;
+
+    // Only the incomplete token is kept.
+    EXPECT_TRUE(reader.Feed("[true, \"ab", 10, writer));
+    EXPECT_STREQ("[true", buffer.GetString());
+    EXPECT_EQ(5u, reader.GetPendingSize()); // , "ab
+    EXPECT_TRUE(reader.Feed("c", 1, writer));
+    EXPECT_EQ(6u, reader.GetPendingSize());
+    EXPECT_TRUE(reader.Feed("d\", 12", 6, writer));
+    EXPECT_STREQ("[true,\"abcd\"", buffer.GetString());
+    EXPECT_EQ(4u, reader.GetPendingSize()); // , 12
+    EXPECT_FALSE(reader.IsComplete());
+    EXPECT_TRUE(reader.Feed("]", 1, writer));
+    EXPECT_EQ(0u, reader.GetPendingSize());
+    EXPECT_TRUE(reader.IsComplete());
+    EXPECT_TRUE(reader.Finish(writer));
+    EXPECT_STREQ("[true,\"abcd\",12]", buffer.GetString());
+
+    // Errors stop parsing.
+    StringBuffer buffer2;
+    Writer<StringBuffer> writer2(buffer2);
+    reader.Reset();
+    EXPECT_FALSE(reader.Feed("[1}", 3, writer2));
+    EXPECT_FALSE(reader.Feed("]", 1, writer2));
+    EXPECT_FALSE(reader.Finish(writer2));
+    EXPECT_EQ(kParseErrorArrayMissCommaOrSquareBracket, reader.GetParseErrorCode());
+    EXPECT_EQ(2u, reader.GetErrorOffset());
+}
+
+namespace {
+
+struct TerminateAtKey : BaseReaderHandler<UTF8<>, TerminateAtKey> {
+    TerminateAtKey() : keys() {}
+    bool Key(const char*, SizeType, bool) { return ++keys < 2; }
+    int keys;
+};
+
+// Feeds the chunks to a document, through Populate().
+struct ChunkGenerator {
+    ChunkGenerator(const char* const* chunks) : chunks_(chunks), reader_() {}
+
+    template <typename Handler>
+    bool operator()(Handler& handler) {
+        for (const char* const* c = chunks_; *c; c++)
+            reader_.Feed(*c, std::strlen(*c), handler);
+        return reader_.Finish(handler);
+    }
+
+    const char* const* chunks_;
+    ChunkedReader reader_;
+
+private:
+    ChunkGenerator(const ChunkGenerator&);
+    ChunkGenerator& operator=(const ChunkGenerator&);
+};
+
+} // namespace
+
+TEST(ChunkedReader, Termination) {
+    TerminateAtKey h;
+    ChunkedReader reader;
+    EXPECT_TRUE(reader.Feed("{\"a\":1,", 7, h));
+    EXPECT_FALSE(reader.Feed("\"b\":2}", 6, h));
+    EXPECT_EQ(kParseErrorTermination, reader.GetParseErrorCode());
+    EXPECT_EQ(10u, reader.GetErrorOffset());
+}
+
+TEST(ChunkedReader, Document) {
+    const char* chunks[] = { " { \"hello\" : \"world\", \"t\" : tr", "ue, \"f\" : false, \"n\": null, \"i\":123, \"pi\": 3.14", "16, \"a\":[1, 2, 3, 4] } ", 0 };
+    ChunkGenerator g(chunks);
+    Document d;
+    d.Populate(g);
+    EXPECT_FALSE(g.reader_.HasParseError());
+    EXPECT_TRUE(d["t"].IsTrue());
+    EXPECT_EQ(3.1416, d["pi"].GetDouble());
+    EXPECT_EQ(4u, d["a"].Size());
+}
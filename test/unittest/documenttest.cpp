@@ -368,6 +368,141 @@ TEST(Document, UserBuffer) {
     EXPECT_LE(parseAllocator.Size(), parseAllocator.Capacity());
 }
 
+// Counts the chunks allocated by memory pools.
+struct CountingAllocator : CrtAllocator {
+    void* Malloc(size_t size) { count++; return CrtAllocator::Malloc(size); }
+    static size_t count;
+};
+
+size_t CountingAllocator::count = 0;
+
+template <typename StackAllocator>
+static void TestReset() {
+    typedef GenericDocument<UTF8<>, MemoryPoolAllocator<CountingAllocator>, StackAllocator> DocumentType;
+    const char* json[] = {
+        "{\"hello\":\"world\",\"t\":true,\"f\":false,\"n\":null,\"i\":123,\"pi\":3.1416,\"a\":[1,2,3,4]}",
+        "[\"a string long enough to make the reader's stack grow a few times: 0123456789012345678901234567890123456789\"]",
+        "{\"a\":{\"b\":{\"c\":[[[[[[\"deep\"]]]]]]}}}"
+    };
+
+    // A small chunk capacity makes the documents span several chunks.
+    MemoryPoolAllocator<CountingAllocator> allocator(64);
+    DocumentType doc(&allocator);
+    size_t count = 0;
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+            doc.Reset().Parse(json[i]);
+            EXPECT_FALSE(doc.HasParseError());
+
+            StringBuffer buffer;
+            Writer<StringBuffer> writer(buffer);
+            doc.Accept(writer);
+            EXPECT_STREQ(json[i], buffer.GetString());
+        }
+        // Once the kept chunk holds every document, no chunk is allocated anymore.
+        if (round == 1)
+            count = CountingAllocator::count;
+    }
+    EXPECT_EQ(count, CountingAllocator::count);
+
+    doc.Reset();
+    EXPECT_TRUE(doc.IsNull());
+    EXPECT_EQ(0u, allocator.Size());
+    EXPECT_LT(0u, allocator.Capacity());
+
+    doc.Parse("[");
+    EXPECT_TRUE(doc.HasParseError());
+    doc.Reset();
+    EXPECT_FALSE(doc.HasParseError());
+}
+
+TEST(Document, Reset) {
+    TestReset<MemoryPoolAllocator<CountingAllocator> >();
+    TestReset<CrtAllocator>();
+
+    // Values freed one by one by CrtAllocator
+    GenericDocument<UTF8<>, CrtAllocator> doc;
+    doc.Parse("{\"a\":[1,2,3],\"b\":\"a string which is not short\"}");
+    EXPECT_TRUE(doc.IsObject());
+    EXPECT_TRUE(doc.Reset().IsNull());
+}
+
+TEST(Document, PackNumberArrays) {
+    const char* json = "{\"d\":[1.5,-2.5,3e10],\"i\":[1,-2,5000000000],\"s\":[1,\"x\"],\"e\":[],"
+        "\"u\":[1,18446744073709551615],\"m\":[100,0.5,3],\"n\":[[1,2],[3.5]]}";
+    Document doc;
+    doc.Parse<kParsePackNumberArraysFlag>(json);
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_TRUE(doc["d"].IsDoubleArray());
+    EXPECT_EQ(-2.5, doc["d"].GetDoubleArray()[1]);
+    EXPECT_EQ(3e10, doc["d"].GetDoubleArray()[2]);
+    EXPECT_TRUE(doc["i"].IsInt64Array());
+    EXPECT_EQ(5000000000LL, doc["i"].GetInt64Array()[2]);
+    EXPECT_FALSE(doc["s"].IsPackedArray());
+    EXPECT_FALSE(doc["e"].IsPackedArray());
+    EXPECT_FALSE(doc["u"].IsPackedArray());     // above int64_t
+    EXPECT_FALSE(doc["m"].IsPackedArray());     // integers and doubles
+    EXPECT_FALSE(doc["n"].IsPackedArray());
+    EXPECT_TRUE(doc["n"][0].IsInt64Array());
+    EXPECT_TRUE(doc["n"][1].IsDoubleArray());
+
+    // Numbers keep their value and type.
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    EXPECT_STREQ("{\"d\":[1.5,-2.5,30000000000.0],\"i\":[1,-2,5000000000],\"s\":[1,\"x\"],\"e\":[],"
+        "\"u\":[1,18446744073709551615],\"m\":[100,0.5,3],\"n\":[[1,2],[3.5]]}", buffer.GetString());
+    Document unpacked;
+    unpacked.Parse(json);
+    EXPECT_TRUE(doc == unpacked);
+    EXPECT_TRUE(doc["m"][0].IsInt());
+
+    // Const access reads the packed numbers as values.
+    const Document& cdoc = doc;
+    EXPECT_TRUE(cdoc["d"][1].IsDouble());
+    EXPECT_EQ(-2.5, cdoc["d"][1].GetDouble());
+    EXPECT_TRUE(cdoc["i"][0].IsInt());
+    EXPECT_TRUE(cdoc["i"][2].IsInt64());
+    EXPECT_FALSE(cdoc["i"][2].IsInt());
+    unsigned numbers = 0;
+    for (Value::ConstValueIterator it = cdoc["d"].Begin(); it != cdoc["d"].End(); ++it)
+        numbers += it->IsNumber() ? 1u : 0u;
+    EXPECT_EQ(3u, numbers);
+    EXPECT_TRUE(cdoc["d"].IsPackedArray());
+    EXPECT_TRUE(cdoc["i"].IsPackedArray());
+
+    // Non-const access unpacks.
+    EXPECT_TRUE(doc["i"][0].IsInt());
+    EXPECT_TRUE(doc["i"][2].IsInt64());
+    EXPECT_FALSE(doc["i"].IsPackedArray());
+    EXPECT_TRUE(doc == unpacked);
+
+    // Not packed without the flag.
+    doc.Parse(json);
+    EXPECT_FALSE(doc["d"].IsPackedArray());
+}
+
+TEST(Document, NumberRuns) {
+    const char* json = "{\"d\":[1.5,-2,3e10],\"i\":[1,-2,5000000000,4294967295],\"s\":[1,\"x\",2],"
+        "\"u\":[1,18446744073709551615],\"n\":[[1,2],[3.5]],\"m\":-1}";
+    Document doc, expected;
+    expected.Parse(json);
+    doc.Parse<kParseNumberRunsFlag>(json);
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_TRUE(doc == expected);
+    EXPECT_TRUE(doc["i"][0].IsInt());
+    EXPECT_TRUE(doc["i"][3].IsUint());
+    EXPECT_FALSE(doc["i"][3].IsInt());
+    EXPECT_TRUE(doc["u"][1].IsUint64());
+    EXPECT_TRUE(doc["d"][1].IsInt());
+
+    doc.Parse<kParseNumberRunsFlag | kParsePackNumberArraysFlag>(json);
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_TRUE(doc == expected);
+    EXPECT_TRUE(doc["i"].IsInt64Array());
+    EXPECT_TRUE(doc["n"][1].IsDoubleArray());
+}
+
 // Issue 226: Value of string type should not point to NULL
 TEST(Document, AssertAcceptInvalidNameType) {
     Document doc;
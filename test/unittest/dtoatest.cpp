@@ -14,6 +14,8 @@
 
 #include "unittest.h"
 #include "rapidjson/internal/dtoa.h"
+#include <cstdlib>
+#include <cstring>
 
 #ifdef __GNUC__
 RAPIDJSON_DIAG_PUSH
@@ -91,6 +93,89 @@ TEST(dtoa, maxDecimalPlaces) {
 #undef TEST_DTOA
 }
 
+// dtoa() as with RAPIDJSON_SCHUBFACH defined to 1.
+static char* dtoaSchubfach(double value, char* buffer, int maxDecimalPlaces = 324) {
+    if (Double(value).IsZero())
+        return dtoa(value, buffer, maxDecimalPlaces);
+    if (value < 0) {
+        *buffer++ = '-';
+        value = -value;
+    }
+    int length, K;
+    Schubfach(value, buffer, &length, &K);
+    return Prettify(buffer, length, K, maxDecimalPlaces);
+}
+
+TEST(dtoa, Schubfach) {
+    char buffer[30];
+
+#define TEST_DTOA(d, a)\
+    *dtoaSchubfach(d, buffer) = '\0';\
+    EXPECT_STREQ(a, buffer)
+
+    TEST_DTOA(-0.0, "-0.0");
+    TEST_DTOA(1.0, "1.0");
+    TEST_DTOA(-1.0, "-1.0");
+    TEST_DTOA(1.2345, "1.2345");
+    TEST_DTOA(0.123456789012, "0.123456789012");
+    TEST_DTOA(1234567.8, "1234567.8");
+    TEST_DTOA(0.000001, "0.000001");
+    TEST_DTOA(0.0000001, "1e-7");
+    TEST_DTOA(1e30, "1e30");
+    TEST_DTOA(1.234567890123456e30, "1.234567890123456e30");
+    TEST_DTOA(5e-324, "5e-324"); // Min subnormal positive double
+    TEST_DTOA(1e-323, "1e-323");
+    TEST_DTOA(2.225073858507201e-308, "2.225073858507201e-308"); // Max subnormal positive double
+    TEST_DTOA(2.2250738585072014e-308, "2.2250738585072014e-308"); // Min normal positive double
+    TEST_DTOA(1.7976931348623157e308, "1.7976931348623157e308"); // Max double
+    TEST_DTOA(9007199254740992.0, "9007199254740992.0"); // 2^53
+    TEST_DTOA(123456789012345680.0, "123456789012345680.0");
+
+    // Grisu2 is one digit longer
+    TEST_DTOA(1e23, "1e23"); // Grisu2: 9.999999999999999e22
+    TEST_DTOA(9.13e-305, "9.13e-305"); // Grisu2: 9.129999999999999e-305
+    TEST_DTOA(4.25e-276, "4.25e-276"); // Grisu2: 4.2499999999999996e-276
+
+    // Grisu2 is not the closest
+    TEST_DTOA(2.1201840400810927e-105, "2.1201840400810927e-105"); // Grisu2: ...929e-105
+    TEST_DTOA(3.0251373381551392e240, "3.0251373381551392e240"); // Grisu2: ...393e240
+
+#undef TEST_DTOA
+
+#define TEST_DTOA(m, d, a)\
+    *dtoaSchubfach(d, buffer, m) = '\0';\
+    EXPECT_STREQ(a, buffer)
+
+    TEST_DTOA(3, 1.2345, "1.234");
+    TEST_DTOA(1, 1.0001, "1.0");
+    TEST_DTOA(2, 0.123456789012, "0.12");
+    TEST_DTOA(3, 0.0001, "0.0");
+    TEST_DTOA(3, 1e30, "1e30");
+    TEST_DTOA(3, 5e-324, "0.0");
+    TEST_DTOA(3, -0.14000000000000001, "-0.14");
+
+#undef TEST_DTOA
+}
+
+TEST(dtoa, SchubfachRoundTrip) {
+    char buffer[30];
+    char grisu2[30];
+    uint64_t x = 88172645463325252u;
+    for (int i = 0; i < 100000; i++) {
+        // xorshift64 over all finite doubles
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        const Double d(x & RAPIDJSON_UINT64_C2(0x7FFFFFFF, 0xFFFFFFFF));
+        if (d.IsNanOrInf())
+            continue;
+        *dtoaSchubfach(d.Value(), buffer) = '\0';
+        *dtoa(d.Value(), grisu2) = '\0';
+        EXPECT_EQ(d.Uint64Value(), Double(strtod(buffer, 0)).Uint64Value()) << buffer;
+        EXPECT_LE(std::strlen(buffer), std::strlen(grisu2)) << buffer;
+    }
+}
+
 
 #ifdef __GNUC__
 RAPIDJSON_DIAG_POP
@@ -0,0 +1,153 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+
+#include "rapidjson/elementreader.h"
+#include "rapidjson/filereadstream.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <cstdio>
+#include <string>
+
+using namespace rapidjson;
+
+// A FeatureCollection with members before and after its features.
+static std::string MakeCollection(size_t count) {
+    return "{\"type\": \"FeatureCollection\", \"crs\": {\"features\": [0]}, \"features\": [\n"
+        + MakeFeatures(count, "\n, ") + "\n], \"bbox\": [[1, 2], {\"a\": \"]\"}]}";
+}
+
+TEST(ElementReader, Features) {
+    const std::string json = MakeCollection(1000);
+    Document expected;
+    expected.Parse(json.c_str());
+    ASSERT_FALSE(expected.HasParseError());
+
+    MemoryPoolAllocator<> allocator(1024);
+    StringStream s(json.c_str());
+    ElementReader r(s, Pointer("/features"), &allocator);
+    EXPECT_TRUE(r.HasArray());
+    EXPECT_TRUE(r.GetElement().IsNull());
+    size_t capacity = 0;
+    SizeType count = 0;
+    while (r.Next()) {
+        EXPECT_EQ(count, r.GetIndex());
+        EXPECT_TRUE(r.GetElement() == expected["features"][count]);
+        EXPECT_EQ(count, r.GetElement()["id"].GetUint());
+        if (count == 1)
+            capacity = r.GetElement().GetAllocator().Capacity();
+        count++;
+    }
+    EXPECT_FALSE(r.HasParseError());
+    EXPECT_EQ(1000u, count);
+    EXPECT_TRUE(r.GetElement().IsNull());
+    EXPECT_FALSE(r.Next());
+
+    // The allocator is reused: its memory does not grow with the elements.
+    EXPECT_EQ(capacity, r.GetElement().GetAllocator().Capacity());
+    EXPECT_LT(capacity, json.size() / 50);
+}
+
+TEST(ElementReader, Pointers) {
+    const char json[] = "[{\"a\": 1, \"b\": [[], [true, [2, 3]], {\"c\": [4]}]}, \"x\"]";
+    const char* pointers[] = { "", "/0/b", "/0/b/0", "/0/b/1/1", "/0/b/2/c" };
+    const char* elements[] = { "{\"a\":1,\"b\":[[],[true,[2,3]],{\"c\":[4]}]}|\"x\"|", "[]|[true,[2,3]]|{\"c\":[4]}|", "", "2|3|", "4|" };
+    for (size_t i = 0; i < sizeof(pointers) / sizeof(pointers[0]); i++) {
+        StringStream s(json);
+        ElementReader r(s, Pointer(pointers[i]));
+        EXPECT_TRUE(r.HasArray()) << pointers[i];
+        std::string result;
+        while (r.Next()) {
+            StringBuffer buffer;
+            Writer<StringBuffer> writer(buffer);
+            r.GetElement().Accept(writer);
+            result = result + buffer.GetString() + "|";
+        }
+        EXPECT_FALSE(r.HasParseError()) << pointers[i];
+        EXPECT_EQ(elements[i], result) << pointers[i];
+    }
+
+    // The root array without a pointer.
+    StringStream s(json);
+    ElementReader r(s);
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_STREQ("x", r.GetElement().GetString());
+    EXPECT_FALSE(r.Next());
+    EXPECT_FALSE(r.HasParseError());
+
+    // No array at these pointers.
+    const char* missing[] = { "/1", "/2", "/0/a", "/0/c", "/0/b/3", "/0/b/1/1/0", "/a" };
+    for (size_t i = 0; i < sizeof(missing) / sizeof(missing[0]); i++) {
+        StringStream s2(json);
+        ElementReader r2(s2, Pointer(missing[i]));
+        EXPECT_FALSE(r2.HasArray()) << missing[i];
+        EXPECT_FALSE(r2.HasParseError()) << missing[i];
+        EXPECT_FALSE(r2.Next()) << missing[i];
+    }
+}
+
+TEST(ElementReader, Error) {
+    const std::string collection = MakeCollection(10);
+    std::string json[] = {
+        collection.substr(0, collection.size() / 2),                      // in an element
+        collection.substr(0, collection.size() - 1),                      // after the array
+        collection.substr(0, collection.find("\"crs\"")) + "]" + collection.substr(collection.find("\"crs\"")), // before the array
+        collection.substr(0, collection.find("}\n,") + 2) + collection.substr(collection.find("}\n,") + 3), // missing comma
+        collection + "]"
+    };
+    for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+        Document expected;
+        expected.Parse(json[i].c_str());
+        ASSERT_TRUE(expected.HasParseError()) << i;
+
+        StringStream s(json[i].c_str());
+        ElementReader r(s, Pointer("/features"));
+        while (r.Next())
+            ;
+        EXPECT_TRUE(r.HasParseError()) << i;
+        EXPECT_EQ(expected.GetParseError(), r.GetParseErrorCode()) << i;
+        EXPECT_EQ(expected.GetErrorOffset(), r.GetErrorOffset()) << i;
+        EXPECT_FALSE(r.Next());
+    }
+
+    // Comments and trailing commas with their flags.
+    StringStream s("/* [ */ {\"features\": [1 /* , */, // ]\n 2, ], \"bbox\": null}");
+    GenericElementReader<UTF8<>, StringStream, kParseCommentsFlag | kParseTrailingCommasFlag> r(s, Pointer("/features"));
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(1, r.GetElement().GetInt());
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(2, r.GetElement().GetInt());
+    EXPECT_FALSE(r.Next());
+    EXPECT_FALSE(r.HasParseError());
+}
+
+TEST(ElementReader, FileReadStream) {
+    const std::string json = MakeCollection(100);
+    FILE* fp = tmpfile();
+    ASSERT_TRUE(fp != 0);
+    fwrite(json.c_str(), 1, json.size(), fp);
+    rewind(fp);
+
+    char buffer[64];    // smaller than the elements
+    FileReadStream is(fp, buffer, sizeof(buffer));
+    GenericElementReader<UTF8<>, FileReadStream> r(is, Pointer("/features"));
+    unsigned count = 0;
+    while (r.Next())
+        EXPECT_EQ(count++, r.GetElement()["id"].GetUint());
+    EXPECT_FALSE(r.HasParseError());
+    EXPECT_EQ(100u, count);
+    fclose(fp);
+}
@@ -17,6 +17,7 @@
 #include "rapidjson/filewritestream.h"
 #include "rapidjson/encodedstream.h"
 #include "rapidjson/stringbuffer.h"
+#include <string>
 
 using namespace rapidjson;
 
@@ -333,6 +334,85 @@ TEST(EncodingsTest, UTF8) {
     }
 }
 
+// Offset of the first invalid sequence, by UTF8::Validate() for each code point.
+static size_t FindInvalidUTF8(const std::string& s) {
+    const std::string padded = s + std::string(4, '\0'); // Validate() may read past a cut-off sequence
+    StringStream is(padded.c_str());
+    StringBuffer os;
+    while (is.Tell() < s.size()) {
+        const size_t offset = is.Tell();
+        if (!UTF8<>::Validate(is, os))
+            return offset;
+    }
+    return s.size();
+}
+
+TEST(EncodingsTest, UTF8ValidateBuffer) {
+    // Every code point, at all positions of a block.
+    StringBuffer os;
+    for (const unsigned* range = kCodepointRanges; *range != 0xFFFFFFFF; range += 2) {
+        for (unsigned codepoint = range[0]; codepoint <= range[1]; ++codepoint) {
+            os.Clear();
+            UTF8<>::Encode(os, codepoint);
+            std::string s(codepoint % 37, 'a');
+            s += os.GetString();
+            s.append(codepoint % 29, 'b');
+            size_t offset = 0;
+            EXPECT_TRUE(UTF8<>::ValidateBuffer(s.c_str(), s.size(), &offset));
+            EXPECT_EQ(s.size(), offset);
+
+            const char* p = os.GetString();
+            unsigned decodedCodepoint = 0;
+            EXPECT_TRUE(internal::DecodeUTF8(p, os.GetString() + os.GetSize(), &decodedCodepoint));
+            EXPECT_EQ(codepoint, decodedCodepoint);
+        }
+    }
+
+    // Surrogates, above U+10FFFF, overlong forms and cut-off sequences.
+    static const char* const invalid[] = {
+        "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF",
+        "\xC0\xAF", "\xC1\xBF", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF",
+        "\x80", "\xC2", "\xE2\x82", "\xF0\x9F\x98", "\xE2\x82 ", "\xC2\x80\x80"
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+        for (size_t before = 0; before < 40; before++) {
+            std::string s(before, 'x');
+            s += "\xC3\xA9";
+            const size_t expected = i == 14 ? s.size() + 2 : s.size();
+            s += invalid[i];
+            size_t offset = 0;
+            EXPECT_FALSE(UTF8<>::ValidateBuffer(s.c_str(), s.size(), &offset));
+            EXPECT_EQ(expected, offset);
+            s.append(70, 'y');
+            EXPECT_FALSE(UTF8<>::ValidateBuffer(s.c_str(), s.size(), &offset));
+            EXPECT_EQ(expected, offset);
+        }
+
+    // Random bytes, mostly of valid sequences.
+    static const unsigned char bytes[] = { 'a', 'z', 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC2, 0xDF, 0xE0, 0xED, 0xEF, 0xF0, 0xF4, 0xF5 };
+    unsigned r = 1;
+    for (unsigned trial = 0; trial < 100000; trial++) {
+        std::string s;
+        const size_t length = trial % 100;
+        while (s.size() < length) {
+            r = r * 1103515245u + 12345u;
+            if ((r >> 16) % 8 != 0) {
+                os.Clear();
+                UTF8<>::Encode(os, (r >> 8) % 3 == 0 ? (r >> 4) % 0x80 : (r >> 9) % 0x10000 < 0xD800 ? (r >> 9) % 0x10000 : 0x10000 + (r >> 5) % 0x100000);
+                s += os.GetString();
+            }
+            else
+                s += static_cast<char>(bytes[(r >> 20) % sizeof(bytes)]);
+        }
+        const size_t expected = FindInvalidUTF8(s);
+        size_t offset = 0;
+        EXPECT_EQ(expected == s.size(), UTF8<>::ValidateBuffer(s.c_str(), s.size(), &offset));
+        EXPECT_EQ(expected, offset);
+    }
+
+    EXPECT_TRUE(UTF8<>::ValidateBuffer("", 0));
+}
+
 TEST(EncodingsTest, UTF16) {
     GenericStringBuffer<UTF16<> > os, os2;
     GenericStringBuffer<UTF8<> > utf8os;
@@ -16,6 +16,8 @@
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/filewritestream.h"
 #include "rapidjson/encodedstream.h"
+#include "rapidjson/memorymappedfile.h"
+#include "rapidjson/document.h"
 
 using namespace rapidjson;
 
@@ -110,3 +112,78 @@ TEST_F(FileStreamTest, FileWriteStream) {
     //std::cout << filename << std::endl;
     remove(filename);
 }
+
+TEST_F(FileStreamTest, MemoryMappedFile) {
+    MemoryMappedFile file(filename_);
+    ASSERT_TRUE(file.IsOpen());
+    EXPECT_EQ(MemoryMappedFile::kReadOnly, file.GetMode());
+    EXPECT_EQ(length_, file.GetSize());
+    EXPECT_EQ(0, memcmp(json_, file.GetString(), length_ + 1));   // including the terminator
+
+    Document expected, d;
+    expected.Parse(json_);
+    StringStream s = file.GetStream();
+    d.ParseStream(s);
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_TRUE(expected == d);
+
+    d.Parse<kParseStructuralIndexFlag>(file.GetString());
+    EXPECT_TRUE(expected == d);
+
+    MemoryMappedFile missing("file_which_does_not_exist.json");
+    EXPECT_FALSE(missing.IsOpen());
+    EXPECT_EQ(0u, missing.GetSize());
+    EXPECT_STREQ("", missing.GetString());
+}
+
+TEST_F(FileStreamTest, MemoryMappedFile_CopyOnWrite) {
+    Document expected;
+    expected.Parse(json_);
+    {
+        MemoryMappedFile file(filename_, MemoryMappedFile::kCopyOnWrite);
+        ASSERT_TRUE(file.IsOpen());
+        Document d;
+        d.ParseInsitu(file.GetInsituString());
+        EXPECT_FALSE(d.HasParseError());
+        EXPECT_TRUE(expected == d);
+        EXPECT_NE(0, memcmp(json_, file.GetString(), length_));      // modified in memory
+    }
+
+    // The file is unchanged.
+    MemoryMappedFile file(filename_, MemoryMappedFile::kCopyOnWrite);
+    ASSERT_TRUE(file.IsOpen());
+    EXPECT_EQ(0, memcmp(json_, file.GetString(), length_ + 1));
+    InsituStringStream s = file.GetInsituStream();
+    Document d;
+    d.ParseStream<kParseInsituFlag>(s);
+    EXPECT_TRUE(expected == d);
+}
+
+TEST_F(FileStreamTest, MemoryMappedFile_Sizes) {
+    // Files ending on a page boundary still get a terminator.
+    const size_t sizes[] = { 0, 1, 4095, 4096, 4097, 8192, 65536 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        char filename[L_tmpnam];
+        FILE* fp = TempFile(filename);
+        ASSERT_TRUE(fp != 0);
+        std::string content;
+        if (sizes[i] >= 2)
+            content = "[" + std::string(sizes[i] - 2, ' ') + "]";
+        content.resize(sizes[i], ']');
+        fwrite(content.data(), 1, content.size(), fp);
+        fclose(fp);
+
+        for (int mode = 0; mode < 2; mode++) {
+            MemoryMappedFile file(filename, static_cast<MemoryMappedFile::Mode>(mode));
+            ASSERT_TRUE(file.IsOpen());
+            EXPECT_EQ(sizes[i], file.GetSize());
+            EXPECT_EQ(content, std::string(file.GetString()));
+            if (sizes[i] >= 2) {
+                Document d;
+                d.Parse(file.GetString());
+                EXPECT_FALSE(d.HasParseError());
+            }
+        }
+        remove(filename);
+    }
+}
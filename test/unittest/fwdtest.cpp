@@ -81,6 +81,9 @@ struct Foo {
     // pointer.h
     Pointer* pointer;
 
+    // pathfilter.h
+    PathFilter* pathfilter;
+
     // schema.h
     SchemaDocument* schemadocument;
     SchemaValidator* schemavalidator;
@@ -99,6 +102,7 @@ struct Foo {
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/schema.h"   // -> pointer.h
+#include "rapidjson/pathfilter.h"
 
 Foo::Foo() : 
     // encodings.h
@@ -153,6 +157,9 @@ Foo::Foo() :
     // pointer.h
     pointer(RAPIDJSON_NEW(Pointer)),
 
+    // pathfilter.h
+    pathfilter(RAPIDJSON_NEW(PathFilter)),
+
     // schema.h
     schemadocument(RAPIDJSON_NEW(SchemaDocument(*document))),
     schemavalidator(RAPIDJSON_NEW(SchemaValidator(*schemadocument)))
@@ -213,6 +220,9 @@ Foo::~Foo() {
     // pointer.h
     RAPIDJSON_DELETE(pointer);
 
+    // pathfilter.h
+    RAPIDJSON_DELETE(pathfilter);
+
     // schema.h
     RAPIDJSON_DELETE(schemadocument);
     RAPIDJSON_DELETE(schemavalidator);
@@ -0,0 +1,140 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+#include "rapidjson/keyset.h"
+#include "rapidjson/reader.h"
+#include <string>
+#include <vector>
+
+using namespace rapidjson;
+
+TEST(KeySet, Find) {
+    static const KeySet::StringRefType keys[] = { "a", "b", "c", "ab", "ba", "abc", "id", "name", "value", "values", "x", "y", "z", "", "longer_name_1", "longer_name_2" };
+    const SizeType n = sizeof(keys) / sizeof(keys[0]);
+    const KeySet set(keys);
+    EXPECT_EQ(n, set.GetSize());
+    EXPECT_TRUE(set.HasPerfectHash());
+    for (SizeType i = 0; i < n; i++) {
+        EXPECT_EQ(static_cast<int>(i), set.Find(keys[i].s, keys[i].length)) << keys[i].s;
+        EXPECT_EQ(static_cast<int>(i), set.Find(keys[i].s)) << keys[i].s;
+        EXPECT_EQ(keys[i].s, set.GetKey(static_cast<int>(i)).s);
+    }
+    EXPECT_EQ(-1, set.Find("abcd"));
+    EXPECT_EQ(-1, set.Find("longer_name_3"));
+    EXPECT_EQ(-1, set.Find("valuex"));
+    EXPECT_EQ(-1, set.Find("na\0e", 4));
+    EXPECT_EQ(8, set.Find("valuesx", 5));    // not null-terminated
+
+    const Value name("id");
+    EXPECT_EQ(6, set.Find(name));
+
+    const KeySet set2(keys + 1, 3);
+    EXPECT_EQ(2, set2.Find("ab"));
+    EXPECT_EQ(-1, set2.Find("a"));
+}
+
+TEST(KeySet, Add) {
+    KeySet set;
+    EXPECT_EQ(0u, set.GetSize());
+    EXPECT_EQ(-1, set.Find("a"));
+    set.Build();
+    EXPECT_EQ(-1, set.Find("a"));
+    EXPECT_EQ(-1, set.Find(""));
+
+    // Keys are found in order before Build(), and with the hash after.
+    EXPECT_EQ(0, set.Add("first"));
+    EXPECT_EQ(1, set.Add("second"));
+    EXPECT_FALSE(set.HasPerfectHash());
+    EXPECT_EQ(1, set.Find("second"));
+    set.Build();
+    EXPECT_FALSE(set.HasPerfectHash());  // too few keys
+    EXPECT_EQ(1, set.Find("second"));
+    EXPECT_EQ(2, set.Add("third"));
+    EXPECT_EQ(2, set.Find("third"));
+    set.Build();
+    EXPECT_TRUE(set.HasPerfectHash());
+    EXPECT_EQ(2, set.Find("third"));
+    EXPECT_EQ(0, set.Find("first"));
+    EXPECT_EQ(-1, set.Find("fourth"));
+}
+
+TEST(KeySet, Similar) {
+    // Keys which only differ in characters not sampled need the full hash.
+    std::vector<std::string> names;
+    for (int i = 0; i < 100; i++) {
+        const char digits[] = { static_cast<char>('0' + i / 100), static_cast<char>('0' + i / 10 % 10), static_cast<char>('0' + i % 10), '\0' };
+        names.push_back(std::string("field_") + digits + "_x");
+    }
+    KeySet set;
+    for (size_t i = 0; i < names.size(); i++)
+        set.Add(KeySet::StringRefType(names[i].c_str(), static_cast<SizeType>(names[i].size())));
+    set.Build();
+    EXPECT_TRUE(set.HasPerfectHash());
+    for (size_t i = 0; i < names.size(); i++)
+        EXPECT_EQ(static_cast<int>(i), set.Find(names[i].c_str()));
+    EXPECT_EQ(-1, set.Find("field_100_x"));
+    EXPECT_EQ(-1, set.Find("field_000_y"));
+}
+
+TEST(KeySet, Wide) {
+    static const GenericKeySet<wchar_t>::StringRefType keys[] = { L"\u00E9t\u00E9", L"hiver", L"\u0100" };
+    const GenericKeySet<wchar_t> set(keys);
+    EXPECT_EQ(0, set.Find(L"\u00E9t\u00E9"));
+    EXPECT_EQ(2, set.Find(L"\u0100"));
+    EXPECT_EQ(-1, set.Find(L"\u0101"));
+}
+
+namespace {
+
+// Sums the values of known members by the ID of their names.
+struct SumHandler : BaseReaderHandler<UTF8<>, SumHandler> {
+    enum Field { kA, kB, kC };
+
+    SumHandler() : field_(-1), sum_() {}
+
+    bool Key(const char* str, SizeType length, bool) {
+        field_ = Keys().Find(str, length);
+        return true;
+    }
+
+    bool Uint(unsigned i) {
+        switch (field_) {
+        case kA: sum_ += i; break;
+        case kB: sum_ += 10 * i; break;
+        case kC: sum_ += 100 * i; break;
+        default: break;
+        }
+        return true;
+    }
+
+    static const KeySet& Keys() {
+        static const KeySet::StringRefType names[] = { "a", "b", "c" };
+        static const KeySet keys(names);
+        return keys;
+    }
+
+    int field_;
+    unsigned sum_;
+};
+
+} // namespace
+
+TEST(KeySet, Handler) {
+    SumHandler h;
+    Reader reader;
+    StringStream s("{\"c\": 3, \"d\": 5, \"a\": 1, \"b\": 2, \"ab\": 7}");
+    EXPECT_TRUE(reader.Parse(s, h));
+    EXPECT_EQ(321u, h.sum_);
+}
@@ -0,0 +1,235 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#define UNITTEST_STRINGIFY
+#include "unittest.h"
+#include "rapidjson/lazydocument.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <string>
+
+using namespace rapidjson;
+
+TEST(LazyDocument, Parse) {
+    LazyDocument d;
+    EXPECT_TRUE(d.IsNull());
+
+    d.Parse("{ \"hello\" : \"world\", \"t\" : true , \"f\" : false, \"n\": null, \"i\":123, \"pi\": 3.1416, \"a\":[1, 2, 3, 4], \"o\":{}, \"e\":[] } ");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_TRUE(d.IsObject());
+    EXPECT_EQ(kObjectType, d.GetType());
+    EXPECT_EQ(9u, d.MemberCount());
+    EXPECT_FALSE(d.ObjectEmpty());
+
+    EXPECT_TRUE(d.HasMember("hello"));
+    EXPECT_FALSE(d.HasMember("hell"));
+    EXPECT_FALSE(d.HasMember("hello2"));
+    const LazyValue& hello = d["hello"];
+    EXPECT_TRUE(hello.IsString());
+    EXPECT_STREQ("world", hello.GetString());
+    EXPECT_EQ(5u, hello.GetStringLength());
+
+    EXPECT_TRUE(d["t"].IsTrue());
+    EXPECT_TRUE(d["t"].GetBool());
+    EXPECT_TRUE(d["f"].IsFalse());
+    EXPECT_FALSE(d["f"].GetBool());
+    EXPECT_TRUE(d["n"].IsNull());
+    EXPECT_EQ(kNullType, d["n"].GetType());
+    EXPECT_EQ(kNumberType, d["i"].GetType());
+    EXPECT_EQ(123, d["i"].GetInt());
+    EXPECT_EQ(3.1416, d["pi"].GetDouble());
+
+    const LazyValue& a = d["a"];
+    EXPECT_TRUE(a.IsArray());
+    EXPECT_EQ(4u, a.Size());
+    int sum = 0;
+    for (LazyValue::ConstValueIterator v = a.Begin(); v != a.End(); ++v)
+        sum += v->GetInt();
+    EXPECT_EQ(10, sum);
+    EXPECT_EQ(4, a[3].GetInt());
+    EXPECT_TRUE(d["o"].ObjectEmpty());
+    EXPECT_TRUE(d["e"].Empty());
+
+    const char* names[] = { "hello", "t", "f", "n", "i", "pi", "a", "o", "e" };
+    size_t i = 0;
+    for (LazyValue::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m, ++i)
+        EXPECT_STREQ(names[i], m->name.GetString());
+    EXPECT_EQ(9u, i);
+    EXPECT_FALSE(d.HasParseError());
+}
+
+TEST(LazyDocument, Nested) {
+    LazyDocument d;
+    d.Parse("[[1, [2, {\"a\": [3]}]], {\"b\": {\"c\": [[], {}]}}, 4]");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ(3u, d.Size());
+    EXPECT_EQ(3, d[0][1][1]["a"][0].GetInt());
+    EXPECT_EQ(2u, d[1]["b"]["c"].Size());
+    EXPECT_TRUE(d[1]["b"]["c"][1].IsObject());
+    EXPECT_EQ(4, d[2].GetInt());
+}
+
+TEST(LazyDocument, Numbers) {
+    LazyDocument d;
+    d.Parse("[-1, 4294967295, -4294967296, 18446744073709551615, 1.5, 1e400]");
+    EXPECT_TRUE(d[0].IsInt());
+    EXPECT_EQ(-1, d[0].GetInt());
+    EXPECT_FALSE(d[1].IsInt());
+    EXPECT_EQ(4294967295u, d[1].GetUint());
+    EXPECT_TRUE(d[2].IsInt64());
+    EXPECT_FALSE(d[2].IsUint64());
+    EXPECT_EQ(RAPIDJSON_UINT64_C2(0xFFFFFFFF, 0xFFFFFFFF), d[3].GetUint64());
+    EXPECT_TRUE(d[4].IsDouble());
+    EXPECT_EQ(1.5, d[4].GetDouble());
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_TRUE(d[5].IsNull());  // parsed only now
+    EXPECT_TRUE(d.HasParseError());
+    EXPECT_EQ(kParseErrorNumberTooBig, d.GetParseError());
+    EXPECT_EQ(57u, d.GetErrorOffset());
+
+    GenericLazyDocument<UTF8<> > d2;
+    d2.Parse<kParseNumbersAsStringsFlag>("[12.50]");
+    EXPECT_TRUE(d2[0].IsString());
+    EXPECT_STREQ("12.50", d2[0].GetString());
+}
+
+TEST(LazyDocument, Strings) {
+    LazyDocument d;
+    d.Parse("{\"a\\u0062\": \"x\\ny\", \"a\": 1, \"ab\": 2, \"\": \"\\\"\", \"\\\\\": 3}");
+    EXPECT_FALSE(d.HasParseError());
+
+    // The escaped name is parsed to be compared.
+    LazyValue::ConstMemberIterator m = d.FindMember("ab");
+    ASSERT_NE(d.MemberEnd(), m);
+    EXPECT_EQ(d.MemberBegin(), m);
+    EXPECT_STREQ("x\ny", m->value.GetString());
+    EXPECT_EQ(1, d["a"].GetInt());
+    EXPECT_STREQ("\"", d[""].GetString());
+    EXPECT_EQ(3, d["\\"].GetInt());
+    EXPECT_EQ(d.MemberEnd(), d.FindMember("a\""));
+    EXPECT_EQ(d.MemberEnd(), d.FindMember("abc"));
+
+    const Value name("\\");
+    EXPECT_EQ(3, d.FindMember(name)->value.GetInt());
+#if RAPIDJSON_HAS_STDSTRING
+    EXPECT_TRUE(d.HasMember(std::string("a")));
+    EXPECT_EQ(1, d[std::string("a")].GetInt());
+#endif
+    EXPECT_FALSE(d.HasParseError());
+}
+
+TEST(LazyDocument, Lazy) {
+    // Invalid values are only found when accessed.
+    LazyDocument d;
+    d.Parse("{\"a\": 1, \"b\": [tru, 2], \"c\": {\"x\" 1}, \"d\": \"\\q\"}");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ(1, d["a"].GetInt());
+    EXPECT_EQ(2u, d["b"].Size());
+    EXPECT_EQ(2, d["b"][1].GetInt());
+    EXPECT_FALSE(d.HasParseError());
+
+    EXPECT_TRUE(d["c"].IsObject());
+    EXPECT_TRUE(d["c"].ObjectEmpty());
+    EXPECT_TRUE(d.HasParseError());
+    EXPECT_EQ(kParseErrorObjectMissColon, d.GetParseError());
+    EXPECT_EQ(34u, d.GetErrorOffset());
+
+    // Only the first error is kept.
+    EXPECT_TRUE(d["b"][0].IsNull());
+    EXPECT_TRUE(d["d"].IsNull());
+    EXPECT_EQ(kParseErrorObjectMissColon, d.GetParseError());
+
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    EXPECT_FALSE(d.Accept(writer));
+}
+
+// The first error found by Accept() on the root, to be compared with Reader.
+static ParseResult LazyError(const char* json) {
+    LazyDocument d;
+    d.Parse(json);
+    if (!d.HasParseError()) {
+        BaseReaderHandler<> h;
+        EXPECT_FALSE(d.Accept(h)) << json;
+    }
+    return d;
+}
+
+TEST(LazyDocument, ParseError) {
+    const char* errors[] = {
+        "", "  ", "]", "{}{}", "1 2", "[1] \"x", "\"ab", "[\"ab", "1x", "truE",
+        "[", "[1", "[1,", "[1 2]", "[1,]", "[,1]", "[1}", "[1, 2,}", "[1x]",
+        "{", "{]", "{1}", "{\"a\"}", "{\"a\": 1", "{\"a\" 1}", "{\"a\":}", "{\"a\": 1,}", "{\"a\": 1 \"b\": 2}", "{\"a\":1]",
+        "[\"\\x\"]", "[-]", "[1.]", "{\"a\"x: 1}", "[[1], [2 3]]"
+    };
+    for (size_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++) {
+        Reader reader;
+        StringStream s(errors[i]);
+        BaseReaderHandler<> h;
+        const ParseResult expected = reader.Parse(s, h);
+        ASSERT_TRUE(expected.IsError()) << errors[i];
+        const ParseResult result = LazyError(errors[i]);
+        EXPECT_EQ(expected.Code(), result.Code()) << errors[i];
+        EXPECT_EQ(expected.Offset(), result.Offset()) << errors[i];
+    }
+}
+
+TEST(LazyDocument, Flags) {
+    LazyDocument d;
+    d.Parse<kParseTrailingCommasFlag>("{\"a\": [1, 2,], \"b\": {\"c\": 3,},}");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ("{\"a\":[1,2],\"b\":{\"c\":3}}", Stringify(d));
+
+    d.Parse<kParseFullPrecisionFlag>("[0.1234567890123456789]");
+    Document expected;
+    expected.Parse<kParseFullPrecisionFlag>("[0.1234567890123456789]");
+    EXPECT_EQ(expected[0].GetDouble(), d[0].GetDouble());
+
+    d.Parse<kParseValidateEncodingFlag>("[\"\xC3\"]");
+    EXPECT_TRUE(d[0].IsNull());
+    EXPECT_EQ(kParseErrorStringInvalidEncoding, d.GetParseError());
+}
+
+TEST(LazyDocument, Accept) {
+    const char* json = "{\"hello\":\"wor\\\"ld\\u00e9\",\"t\":true,\"f\":false,\"n\":null,\"i\":-123,\"pi\":3.1416,\"a\":[1,[2,{}],[]],\"u\":18446744073709551615}";
+    LazyDocument d;
+    d.Parse(json);
+    Document expected;
+    expected.Parse(json);
+    EXPECT_EQ(Stringify(expected), Stringify(d));
+    EXPECT_EQ(Stringify(expected["a"]), Stringify(d["a"]));
+    EXPECT_FALSE(d.HasParseError());
+}
+
+TEST(LazyDocument, Reparse) {
+    LazyDocument d;
+    d.Parse("{\"a\": [1, 2]}");
+    EXPECT_EQ(2u, d["a"].Size());
+    d.Parse("[1");
+    EXPECT_TRUE(d.HasParseError());
+    EXPECT_TRUE(d.IsNull());
+    d.Parse("\"str\"");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_STREQ("str", d.GetString());
+}
+
+TEST(LazyDocument, CrtAllocator) {
+    // Members, elements and strings are freed with the document.
+    GenericLazyDocument<UTF8<>, CrtAllocator> d;
+    d.Parse("{\"a\": [\"x\", {\"b\": \"y\"}], \"c\": \"z\"}");
+    EXPECT_STREQ("y", d["a"][1]["b"].GetString());
+    EXPECT_STREQ("z", d["c"].GetString());
+    d.Parse("[\"w\"]");
+    EXPECT_STREQ("w", d[0].GetString());
+}
@@ -0,0 +1,173 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+#include "rapidjson/rapidjson.h"
+
+#if RAPIDJSON_HAS_CXX11_THREAD
+
+#include "rapidjson/ndjson.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <string>
+#include <vector>
+
+using namespace rapidjson;
+
+struct RecordCollector {
+    RecordCollector() : records(), indices(), limit(static_cast<size_t>(-1)) {}
+
+    bool operator()(const Value& record, size_t index) {
+        StringBuffer buffer;
+        Writer<StringBuffer> writer(buffer);
+        record.Accept(writer);
+        records.push_back(buffer.GetString());
+        indices.push_back(index);
+        return records.size() < limit;
+    }
+
+    std::vector<std::string> records;
+    std::vector<size_t> indices;
+    size_t limit;
+};
+
+static std::string MakeNDJson(size_t count) {
+    return MakeFeatures(count, "\n") + "\n";
+}
+
+TEST(NDJsonParser, Basic) {
+    const char json[] = "{\"a\":1}\n[1,2]\r\n\n  \t\n\"s\"\n  3  \nnull";
+    NDJsonParser parser(2, 4);
+    EXPECT_EQ(2u, parser.GetThreadCount());
+    EXPECT_EQ(4u, parser.GetBatchSize());
+
+    RecordCollector c;
+    ParseResult r = parser.Parse(json, sizeof(json) - 1, c);
+    EXPECT_FALSE(r.IsError());
+    EXPECT_EQ(5u, parser.GetRecordCount());
+    ASSERT_EQ(5u, c.records.size());
+    EXPECT_EQ("{\"a\":1}", c.records[0]);
+    EXPECT_EQ("[1,2]", c.records[1]);
+    EXPECT_EQ("\"s\"", c.records[2]);
+    EXPECT_EQ("3", c.records[3]);
+    EXPECT_EQ("null", c.records[4]);
+    for (size_t i = 0; i < c.indices.size(); i++)
+        EXPECT_EQ(i, c.indices[i]);
+}
+
+TEST(NDJsonParser, Empty) {
+    NDJsonParser parser(3);
+    RecordCollector c;
+    EXPECT_FALSE(parser.Parse("", 0, c).IsError());
+    EXPECT_FALSE(parser.Parse("\n\n \n", 4, c).IsError());
+    EXPECT_EQ(0u, parser.GetRecordCount());
+    EXPECT_TRUE(c.records.empty());
+}
+
+TEST(NDJsonParser, Order) {
+    const std::string json = MakeNDJson(5000);
+
+    std::vector<std::string> expected;
+    {
+        Document d;
+        size_t begin = 0;
+        for (size_t end; (end = json.find('\n', begin)) != std::string::npos; begin = end + 1) {
+            d.Parse(json.c_str() + begin, end - begin);
+            ASSERT_FALSE(d.HasParseError());
+            StringBuffer buffer;
+            Writer<StringBuffer> writer(buffer);
+            d.Accept(writer);
+            expected.push_back(buffer.GetString());
+        }
+    }
+
+    const unsigned threadCounts[] = { 1, 2, 4, 7 };
+    const size_t batchSizes[] = { 1, 100, 4096, NDJsonParser::kDefaultBatchSize };
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); i++)
+        for (size_t j = 0; j < sizeof(batchSizes) / sizeof(batchSizes[0]); j++) {
+            NDJsonParser parser(threadCounts[i], batchSizes[j]);
+            // The same parser can be reused.
+            for (int k = 0; k < 2; k++) {
+                RecordCollector c;
+                EXPECT_FALSE(parser.Parse<kParseFullPrecisionFlag>(json.c_str(), json.size(), c).IsError());
+                EXPECT_EQ(expected.size(), parser.GetRecordCount());
+                EXPECT_TRUE(expected == c.records);
+            }
+        }
+}
+
+TEST(NDJsonParser, Error) {
+    std::string json = MakeNDJson(1000);
+    const size_t errorLine = json.find("{\"id\":700,");
+    const std::string bad = "{\"id\":700,\"name\":tru}";
+    json.insert(errorLine, bad + "\n");
+
+    Document d;
+    d.Parse(bad.c_str(), bad.size());
+    ASSERT_TRUE(d.HasParseError());
+
+    for (unsigned threads = 1; threads <= 4; threads++) {
+        NDJsonParser parser(threads, 256);
+        RecordCollector c;
+        ParseResult r = parser.Parse(json.c_str(), json.size(), c);
+        EXPECT_EQ(d.GetParseError(), r.Code());
+        EXPECT_EQ(errorLine + d.GetErrorOffset(), r.Offset());
+        EXPECT_EQ(700u, parser.GetRecordCount());
+        EXPECT_EQ(700u, c.records.size());
+    }
+
+    // A record may not span lines.
+    NDJsonParser parser(2);
+    RecordCollector c;
+    const char split[] = "[1,\n2]\n";
+    ParseResult r = parser.Parse(split, sizeof(split) - 1, c);
+    EXPECT_EQ(kParseErrorValueInvalid, r.Code());
+    EXPECT_EQ(3u, r.Offset());
+    EXPECT_TRUE(c.records.empty());
+}
+
+TEST(NDJsonParser, Termination) {
+    const std::string json = MakeNDJson(1000);
+    NDJsonParser parser(4, 512);
+    RecordCollector c;
+    c.limit = 321;
+    ParseResult r = parser.Parse(json.c_str(), json.size(), c);
+    EXPECT_EQ(kParseErrorTermination, r.Code());
+    EXPECT_EQ(json.find("{\"id\":320,"), r.Offset());
+    EXPECT_EQ(320u, parser.GetRecordCount());
+    EXPECT_EQ(321u, c.records.size());
+}
+
+template <typename Encoding>
+struct EventCounter : BaseReaderHandler<Encoding, EventCounter<Encoding> > {
+    EventCounter() : values(), objects(), sum() {}
+    bool Default() { values++; return true; }
+    bool Int(int i) { sum += static_cast<unsigned>(i); return Default(); }
+    bool EndObject(SizeType) { objects++; return true; }
+    unsigned values;
+    unsigned objects;
+    unsigned long long sum;
+};
+
+TEST(NDJsonParser, ParseEvents) {
+    const std::string json = MakeNDJson(100);
+    NDJsonParser parser(3, 64);
+    EventCounter<UTF8<> > h;
+    EXPECT_FALSE(parser.ParseEvents(json.c_str(), json.size(), h).IsError());
+    EXPECT_EQ(100u * 4u, h.objects);
+    EXPECT_EQ(100u * 25u, h.values);    // every event but EndObject
+    EXPECT_EQ(99u * 100u / 2u, h.sum);  // the ids
+}
+
+#endif // RAPIDJSON_HAS_CXX11_THREAD
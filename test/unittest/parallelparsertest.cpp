@@ -0,0 +1,137 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#define UNITTEST_STRINGIFY
+#include "unittest.h"
+#include "rapidjson/rapidjson.h"
+
+#if RAPIDJSON_HAS_CXX11_THREAD
+
+#include "rapidjson/parallelparser.h"
+#include <cstring>
+#include <string>
+
+using namespace rapidjson;
+
+// A FeatureCollection's array of features, with whitespace around.
+static std::string MakeArray(size_t count) {
+    return " [\n" + MakeFeatures(count, ",\n  ") + "]\r\n";
+}
+
+TEST(ParallelParser, Basic) {
+    ParallelParser parser(3, 16);
+    EXPECT_EQ(3u, parser.GetThreadCount());
+    EXPECT_EQ(16u, parser.GetMinChunkSize());
+
+    const char json[] = "[1, \"a,b\", [2, 3], {\"c\": [4]}, null, \"\\\"]\", 5.5]";
+    Document d;
+    EXPECT_FALSE(parser.Parse(d, json, sizeof(json) - 1).IsError());
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_TRUE(parser.IsParallel());
+    EXPECT_EQ("[1,\"a,b\",[2,3],{\"c\":[4]},null,\"\\\"]\",5.5]", Stringify(d));
+}
+
+TEST(ParallelParser, Chunks) {
+    const std::string json = MakeArray(200);
+    Document expected;
+    expected.Parse(json.c_str(), json.size());
+    ASSERT_FALSE(expected.HasParseError());
+    const std::string expectedString = Stringify(expected);
+
+    // Chunk boundaries at every kind of position.
+    const unsigned threadCounts[] = { 2, 3, 8, 64 };
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); i++)
+        for (size_t minChunkSize = 1; minChunkSize < json.size(); minChunkSize = minChunkSize * 3 + 1) {
+            ParallelParser parser(threadCounts[i], minChunkSize);
+            Document d;
+            EXPECT_FALSE(parser.Parse(d, json.c_str(), json.size()).IsError());
+            EXPECT_EQ(json.size() / minChunkSize >= 2, parser.IsParallel()) << minChunkSize;
+            EXPECT_EQ(expectedString, Stringify(d));
+        }
+
+    // The document keeps its values when the parser is gone, and can be parsed again.
+    Document d;
+    {
+        ParallelParser parser(4, 100);
+        parser.Parse<kParseFullPrecisionFlag>(d, json.c_str(), json.size());
+        EXPECT_TRUE(parser.IsParallel());
+        parser.Parse<kParseFullPrecisionFlag>(d, json.c_str(), json.size());
+        EXPECT_TRUE(parser.IsParallel());
+    }
+    EXPECT_TRUE(d == expected);
+    EXPECT_EQ(199u, d[199]["id"].GetUint());
+}
+
+TEST(ParallelParser, Sequential) {
+    // Not an array, too short, or an element spanning all chunks.
+    const char* json[] = { "{\"a\":[1,2,3,4,5,6,7,8,9]}", "[1, 2]", "[[1,2,3,4,5,6,7,8,9,10,11,12]]", "[]", "  [ ] " };
+    for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+        ParallelParser parser(2, 4);
+        Document d, expected;
+        expected.Parse(json[i]);
+        EXPECT_FALSE(parser.Parse(d, json[i], strlen(json[i])).IsError()) << json[i];
+        EXPECT_TRUE(d == expected) << json[i];
+    }
+
+    ParallelParser parser(2, 1);
+    Document d;
+    parser.Parse(d, "[1, 2]", 2);
+    EXPECT_FALSE(parser.IsParallel());
+    EXPECT_EQ(kParseErrorArrayMissCommaOrSquareBracket, d.GetParseError());
+
+    // Comments may contain quotes.
+    const char comments[] = "[1, /* \" */ 2, 3, // ]\" \n 4, 5, 6, 7, 8]";
+    parser.Parse<kParseCommentsFlag>(d, comments, sizeof(comments) - 1);
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ("[1,2,3,4,5,6,7,8]", Stringify(d));
+}
+
+TEST(ParallelParser, Error) {
+    const std::string features = MakeArray(50);
+    const size_t middle = features.find("\"coordinates\"", features.size() / 2);  // outside strings
+    std::string json[] = {
+        features.substr(0, features.size() / 2),
+        features.substr(0, features.size() - 3) + ",]",
+        features + "x",
+        features.substr(0, middle) + "\"" + features.substr(middle),
+        features.substr(0, middle) + "]" + features.substr(middle),
+        features.substr(0, middle) + "}" + features.substr(middle),
+        "[1, 2 3, 4, 5, 6, 7, 8, 9]",
+        "[1, 2, 3, 4, 5, 6, 7, 8, 9,]"
+    };
+    for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+        Document expected;
+        expected.Parse(json[i].c_str(), json[i].size());
+        ASSERT_TRUE(expected.HasParseError()) << i;
+
+        ParallelParser parser(4, 8);
+        Document d;
+        ParseResult r = parser.Parse(d, json[i].c_str(), json[i].size());
+        EXPECT_EQ(expected.GetParseError(), r.Code()) << i;
+        EXPECT_EQ(expected.GetErrorOffset(), r.Offset()) << i;
+        EXPECT_EQ(expected.GetParseError(), d.GetParseError()) << i;
+        EXPECT_FALSE(parser.IsParallel());
+    }
+
+    // Trailing content is allowed with kParseStopWhenDoneFlag, as are trailing commas with their flag.
+    ParallelParser parser(4, 8);
+    Document d;
+    EXPECT_FALSE(parser.Parse<kParseStopWhenDoneFlag>(d, json[2].c_str(), json[2].size()).IsError());
+    EXPECT_TRUE(parser.IsParallel());
+    EXPECT_EQ(50u, d.Size());
+    EXPECT_FALSE(parser.Parse<kParseTrailingCommasFlag>(d, json[7].c_str(), json[7].size()).IsError());
+    EXPECT_EQ(9u, d.Size());
+}
+
+#endif // RAPIDJSON_HAS_CXX11_THREAD
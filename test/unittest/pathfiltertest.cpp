@@ -0,0 +1,253 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#define UNITTEST_STRINGIFY
+#include "unittest.h"
+#include "rapidjson/pathfilter.h"
+#include "rapidjson/document.h"
+
+using namespace rapidjson;
+
+static const char kGeoJson[] =
+    "{\"type\":\"FeatureCollection\",\"features\":["
+        "{\"type\":\"Feature\",\"properties\":{\"name\":\"a\",\"id\":1},"
+         "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1.5,2.5]}},"
+        "{\"type\":\"Feature\",\"properties\":{\"name\":\"b\",\"id\":2},"
+         "\"geometry\":{\"type\":\"LineString\",\"coordinates\":[[1,2],[3,4]]}}"
+    "]}";
+
+static std::string Filter(const char* json, const PathFilter& filter) {
+    Document d;
+    d.Parse(json, filter);
+    EXPECT_FALSE(d.HasParseError());
+    return Stringify(d);
+}
+
+TEST(PathFilter, Patterns) {
+    PathFilter f;
+    EXPECT_EQ(0u, f.GetPatternCount());
+    EXPECT_FALSE(f.HasInclusion());
+
+    EXPECT_TRUE(f.Exclude("/a/b~1c/0"));
+    EXPECT_TRUE(f.Exclude("a.*.c"));
+    EXPECT_TRUE(f.Include(""));
+    EXPECT_FALSE(f.Exclude("/a~2"));  // invalid escape
+    EXPECT_FALSE(f.Exclude("/a~"));
+    EXPECT_EQ(3u, f.GetPatternCount());
+    EXPECT_TRUE(f.HasInclusion());
+
+    EXPECT_FALSE(f.IsInclusion(0));
+    EXPECT_EQ(3u, f.GetTokenCount(0));
+    EXPECT_TRUE(f.MatchName(0, 0, "a", 1));
+    EXPECT_FALSE(f.MatchName(0, 0, "b", 1));
+    EXPECT_TRUE(f.MatchName(0, 1, "b/c", 3));
+    EXPECT_TRUE(f.MatchIndex(0, 2, 0));
+    EXPECT_FALSE(f.MatchIndex(0, 2, 1));
+    EXPECT_FALSE(f.MatchIndex(0, 0, 0));
+
+    EXPECT_EQ(3u, f.GetTokenCount(1));
+    EXPECT_TRUE(f.MatchName(1, 1, "anything", 8));
+    EXPECT_TRUE(f.MatchIndex(1, 1, 42));
+
+    EXPECT_TRUE(f.IsInclusion(2));
+    EXPECT_EQ(0u, f.GetTokenCount(2));
+
+    f.Clear();
+    EXPECT_EQ(0u, f.GetPatternCount());
+    EXPECT_FALSE(f.HasInclusion());
+}
+
+TEST(PathFilter, NoPattern) {
+    PathFilter f;
+    EXPECT_EQ(std::string(kGeoJson), Filter(kGeoJson, f));
+    EXPECT_EQ("1", Filter("1", f));
+}
+
+TEST(PathFilter, Exclude) {
+    PathFilter f;
+    f.Exclude("features.*.geometry.coordinates");
+    EXPECT_EQ(
+        "{\"type\":\"FeatureCollection\",\"features\":["
+        "{\"type\":\"Feature\",\"properties\":{\"name\":\"a\",\"id\":1},\"geometry\":{\"type\":\"Point\"}},"
+        "{\"type\":\"Feature\",\"properties\":{\"name\":\"b\",\"id\":2},\"geometry\":{\"type\":\"LineString\"}}]}",
+        Filter(kGeoJson, f));
+
+    PathFilter g;
+    g.Exclude("/features/0");
+    g.Exclude("/type");
+    g.Exclude("/features/1/properties/name");
+    EXPECT_EQ(
+        "{\"features\":["
+        "{\"type\":\"Feature\",\"properties\":{\"id\":2},\"geometry\":{\"type\":\"LineString\",\"coordinates\":[[1,2],[3,4]]}}]}",
+        Filter(kGeoJson, g));
+
+    // Excluded elements are matched with their index in the input.
+    PathFilter h;
+    h.Exclude("/0");
+    h.Exclude("/2");
+    EXPECT_EQ("[1,3]", Filter("[0,1,[2],3]", h));
+}
+
+TEST(PathFilter, Include) {
+    PathFilter f;
+    f.Include("/features/*/properties/name");
+    f.Include("type");
+    EXPECT_EQ(
+        "{\"type\":\"FeatureCollection\",\"features\":[{\"properties\":{\"name\":\"a\"}},{\"properties\":{\"name\":\"b\"}}]}",
+        Filter(kGeoJson, f));
+
+    // Exclusion inside an included subtree
+    PathFilter g;
+    g.Include("/features/1");
+    g.Exclude("/features/*/geometry");
+    g.Exclude("/features/*/properties/id");
+    EXPECT_EQ(
+        "{\"features\":[{\"type\":\"Feature\",\"properties\":{\"name\":\"b\"}}]}",
+        Filter(kGeoJson, g));
+
+    // A scalar on the way to an inclusion is dropped.
+    PathFilter h;
+    h.Include("/a/b");
+    EXPECT_EQ("{\"a\":{\"b\":2}}", Filter("{\"a\":{\"b\":2,\"c\":3},\"d\":4}", h));
+    EXPECT_EQ("{}", Filter("{\"a\":1,\"d\":4}", h));
+    EXPECT_EQ("{\"a\":[]}", Filter("{\"a\":[1,{\"b\":3}]}", h));
+
+    PathFilter root;
+    root.Include("");
+    root.Exclude("/a");
+    EXPECT_EQ("{\"b\":2}", Filter("{\"a\":1,\"b\":2}", root));
+}
+
+TEST(PathFilter, PendingKey) {
+    // The name of a member on the way to an inclusion is forwarded only when the
+    // value is an object or array. It must survive the reader reusing its buffer.
+    PathFilter f;
+    f.Include("/*/x");
+    EXPECT_EQ("{\"a\\u0000b\":{\"x\":\"1\"},\"c\":{\"x\":\"2\"}}",
+        Filter("{\"a\\u0000b\":{\"x\":\"1\"},\"s\":\"str\",\"c\":{\"y\":\"3\",\"x\":\"2\"}}", f));
+
+    char json[] = "{\"abc\":{\"x\":\"1\"},\"s\":\"str\",\"def\":{\"x\":\"2\"}}";
+    Document d;
+    d.ParseInsitu(json, f);
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ("{\"abc\":{\"x\":\"1\"},\"def\":{\"x\":\"2\"}}", Stringify(d));
+}
+
+TEST(PathFilter, NoAllocationForSkipped) {
+    std::string json = "{\"keep\":[\"short\"],\"skip\":[";
+    for (int i = 0; i < 1000; i++)
+        json += "\"a long string which would be allocated in the memory pool\",";
+    json += "{\"nested\":[1,2,3]}]}";
+
+    PathFilter f;
+    f.Exclude("/skip");
+    Document d;
+    d.Parse(json.c_str(), f);
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ("{\"keep\":[\"short\"]}", Stringify(d));
+
+    Document full;
+    full.Parse(json.c_str());
+    EXPECT_FALSE(full.HasParseError());
+    EXPECT_GT(full.GetAllocator().Size(), 50000u);
+    EXPECT_LT(d.GetAllocator().Size(), 256u);  // Only the root object and the "keep" array
+}
+
+TEST(PathFilter, ParseError) {
+    PathFilter f;
+    f.Exclude("/a");
+    Document d;
+    d.Parse("{\"a\":[1,2,}", f);
+    EXPECT_TRUE(d.HasParseError());
+    d.Parse("{\"b\":[1,2,}", f);
+    EXPECT_TRUE(d.HasParseError());
+}
+
+struct CountingHandler : BaseReaderHandler<UTF8<>, CountingHandler> {
+    CountingHandler() : values(), memberCount(), elementCount() {}
+    bool Default() { values++; return true; }
+    bool EndObject(SizeType n) { memberCount += n; return true; }
+    bool EndArray(SizeType n) { elementCount += n; return true; }
+    unsigned values;
+    unsigned memberCount;
+    unsigned elementCount;
+};
+
+TEST(PathFilter, FilteredHandler) {
+    PathFilter f;
+    f.Exclude("features.*.geometry");
+    CountingHandler h;
+    GenericFilteredHandler<PathFilter, CountingHandler> filtered(f, h);
+    Reader reader;
+    StringStream s(kGeoJson);
+    EXPECT_TRUE(reader.Parse(s, filtered));
+    EXPECT_EQ(2u, filtered.GetSkippedCount());
+    EXPECT_EQ(2u + 2u * (2u + 2u), h.memberCount); // root, then features with type/properties and name/id
+    EXPECT_EQ(2u, h.elementCount);
+
+    // Same result when skipped subtrees are scanned structurally.
+    CountingHandler h2;
+    GenericFilteredHandler<PathFilter, CountingHandler> filtered2(f, h2);
+    StringStream s2(kGeoJson);
+    EXPECT_TRUE(reader.Parse<kParseSkipValueFlag>(s2, filtered2));
+    EXPECT_EQ(2u, filtered2.GetSkippedCount());
+    EXPECT_EQ(h.memberCount, h2.memberCount);
+    EXPECT_EQ(h.elementCount, h2.elementCount);
+    EXPECT_EQ(h.values, h2.values);
+}
+
+TEST(PathFilter, Iterative) {
+    PathFilter f;
+    f.Exclude("features.*.geometry.coordinates");
+    Document d;
+    d.Parse(kGeoJson, f);
+    Document e;
+    e.Parse<kParseIterativeFlag>(kGeoJson, f);
+    EXPECT_FALSE(e.HasParseError());
+    EXPECT_EQ(Stringify(d), Stringify(e));
+}
+
+TEST(PathFilter, NumberRuns) {
+    static const char json[] = "{\"a\":[1,2,3,4.5,5.5,6],\"b\":[[1,2],[3,4]],\"c\":[7,8]}";
+    PathFilter f;
+    f.Exclude("/a/1");
+    f.Exclude("/a/4");
+    f.Exclude("b.*.0");
+    f.Exclude("c");
+    Document d;
+    d.Parse<kParseNumberRunsFlag>(json, f);
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ("{\"a\":[1,3,4.5,6],\"b\":[[2],[4]]}", Stringify(d));
+    EXPECT_EQ(Filter(json, f), Stringify(d));
+}
+
+struct NoStringHandler : BaseReaderHandler<UTF8<>, NoStringHandler> {
+    bool String(const char*, SizeType, bool) { return false; }
+    bool Key(const char*, SizeType, bool) { return true; }
+};
+
+TEST(PathFilter, Termination) {
+    PathFilter f;
+    NoStringHandler h;
+    GenericFilteredHandler<PathFilter, NoStringHandler> filtered(f, h);
+    Reader reader;
+    StringStream s("{\"a\":\"x\",\"b\":1}");
+    EXPECT_TRUE(reader.Parse(s, filtered).IsError());
+    EXPECT_EQ(kParseErrorTermination, reader.GetParseErrorCode());
+
+    f.Exclude("a");
+    GenericFilteredHandler<PathFilter, NoStringHandler> filtered2(f, h);
+    StringStream s2("{\"a\":\"x\",\"b\":1}");
+    EXPECT_FALSE(reader.Parse(s2, filtered2).IsError());
+}
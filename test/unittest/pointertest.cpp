@@ -638,6 +638,32 @@ TEST(Pointer, Get) {
     EXPECT_EQ(2, unresolvedTokenIndex);
 }
 
+TEST(Pointer, Get_PackedArray) {
+    Document d;
+    d.Parse<kParsePackNumberArraysFlag>("{\"a\":[1.5,0.5,2.5],\"b\":[[1,2,3]]}");
+    ASSERT_TRUE(d["a"].IsDoubleArray());
+
+    // Const pointers read the numbers without unpacking.
+    const Value& v = d;
+    const Value* a2 = GetValueByPointer(v, "/a/2");
+    ASSERT_TRUE(a2 != 0);
+    EXPECT_TRUE(a2->IsDouble());
+    EXPECT_EQ(2.5, a2->GetDouble());
+    ASSERT_TRUE(Pointer("/b/0/1").Get(v) != 0);
+    EXPECT_EQ(2, Pointer("/b/0/1").Get(v)->GetInt());
+    size_t unresolvedTokenIndex;
+    EXPECT_TRUE(Pointer("/a/3").Get(v, &unresolvedTokenIndex) == 0);
+    EXPECT_EQ(1u, unresolvedTokenIndex);
+    EXPECT_TRUE(Pointer("/a/0/0").Get(v, &unresolvedTokenIndex) == 0);
+    EXPECT_EQ(2u, unresolvedTokenIndex);
+    EXPECT_TRUE(d["a"].IsDoubleArray());
+    EXPECT_TRUE(d["b"][0].IsInt64Array());
+
+    // Non-const pointers unpack.
+    EXPECT_EQ(2.5, Pointer("/a/2").Get(d)->GetDouble());
+    EXPECT_FALSE(d["a"].IsPackedArray());
+}
+
 TEST(Pointer, GetWithDefault) {
     Document d;
     d.Parse(kJson);
@@ -0,0 +1,256 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "unittest.h"
+
+#include "rapidjson/pullreader.h"
+#include "rapidjson/document.h"
+#include <cstring>
+
+using namespace rapidjson;
+
+TEST(PullReader, Tokens) {
+    StringStream s("{\"a\": [null, false, true], \"b\": \"str\\ning\", \"c\": {}}");
+    PullReader r(s);
+
+    const PullToken e[] = {
+        kPullTokenStartObject,
+        kPullTokenKey, kPullTokenStartArray, kPullTokenNull, kPullTokenFalse, kPullTokenTrue, kPullTokenEndArray,
+        kPullTokenKey, kPullTokenString,
+        kPullTokenKey, kPullTokenStartObject, kPullTokenEndObject,
+        kPullTokenEndObject
+    };
+    const unsigned depth[] = { 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 0 };
+
+    EXPECT_EQ(kPullTokenNone, r.GetToken());
+    for (size_t i = 0; i < sizeof(e) / sizeof(e[0]); i++) {
+        EXPECT_FALSE(r.IsDone());
+        ASSERT_TRUE(r.Next()) << "i = " << i;
+        EXPECT_EQ(e[i], r.GetToken()) << "i = " << i;
+        EXPECT_EQ(depth[i], r.GetDepth()) << "i = " << i;
+        if (i == 8) {
+            EXPECT_STREQ("str\ning", r.GetString());
+            EXPECT_EQ(7u, r.GetStringLength());
+        }
+        else if (i == 9)
+            EXPECT_STREQ("c", r.GetString());
+    }
+    EXPECT_TRUE(r.IsDone());
+    EXPECT_FALSE(r.Next());
+    EXPECT_EQ(kPullTokenNone, r.GetToken());
+    EXPECT_FALSE(r.HasParseError());
+}
+
+TEST(PullReader, Numbers) {
+    StringStream s("[-1, 1, 4294967295, -4294967296, 18446744073709551615, 1.5]");
+    PullReader r(s);
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.IsInt());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.IsInt());
+    EXPECT_FALSE(r.IsUint());
+    EXPECT_TRUE(r.IsInt64());
+    EXPECT_EQ(-1, r.GetInt());
+    EXPECT_EQ(-1, r.GetInt64());
+    EXPECT_EQ(-1.0, r.GetDouble());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.IsInt());
+    EXPECT_TRUE(r.IsUint64());
+    EXPECT_EQ(1u, r.GetUint());
+    EXPECT_EQ(1u, r.GetUint64());
+    EXPECT_FALSE(r.IsDouble());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.IsInt());
+    EXPECT_TRUE(r.IsUint());
+    EXPECT_EQ(4294967295u, r.GetUint());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.IsInt());
+    EXPECT_FALSE(r.IsUint64());
+    EXPECT_EQ(static_cast<int64_t>(RAPIDJSON_UINT64_C2(0xFFFFFFFF, 0x00000000)), r.GetInt64());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.IsInt64());
+    EXPECT_EQ(RAPIDJSON_UINT64_C2(0xFFFFFFFF, 0xFFFFFFFF), r.GetUint64());
+    EXPECT_EQ(18446744073709551615.0, r.GetDouble());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.IsDouble());
+    EXPECT_FALSE(r.IsInt());
+    EXPECT_EQ(1.5, r.GetDouble());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenEndArray, r.GetToken());
+    EXPECT_FALSE(r.IsInt());
+    EXPECT_FALSE(r.Next());
+    EXPECT_FALSE(r.HasParseError());
+}
+
+TEST(PullReader, NumbersAsStrings) {
+    StringStream s("[12.50]");
+    GenericPullReader<UTF8<>, UTF8<>, StringStream, kParseNumbersAsStringsFlag> r(s);
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenNumber, r.GetToken());
+    EXPECT_FALSE(r.IsDouble());
+    EXPECT_STREQ("12.50", r.GetString());
+    EXPECT_EQ(5u, r.GetStringLength());
+}
+
+TEST(PullReader, Insitu) {
+    char json[] = "{\"name\": \"a\\tb\", \"id\": 7}";
+    InsituStringStream s(json);
+    InsituPullReader r(s);
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    const char* name = r.GetString();
+    EXPECT_TRUE(r.Next());
+    const char* value = r.GetString();
+    while (r.Next())
+        ;
+    EXPECT_FALSE(r.HasParseError());
+
+    // Names and strings point into the buffer and stay valid.
+    EXPECT_GE(name, json);
+    EXPECT_LT(value, json + sizeof(json));
+    EXPECT_STREQ("name", name);
+    EXPECT_STREQ("a\tb", value);
+}
+
+TEST(PullReader, Skip) {
+    StringStream s("{\"skip\": {\"a\": [1, {\"b\": \"}\"}]}, \"keep\": [1, [2, 3], 4], \"also\": \"x\"}");
+    PullReader r(s);
+    int sum = 0;
+    bool inKeep = false;
+    while (r.Next()) {
+        switch (r.GetToken()) {
+        case kPullTokenKey:
+            inKeep = std::strcmp(r.GetString(), "keep") == 0;
+            if (std::strcmp(r.GetString(), "skip") == 0)
+                EXPECT_TRUE(r.Skip());
+            break;
+        case kPullTokenStartArray:
+            // Skip nested arrays
+            if (r.GetDepth() > 2) {
+                EXPECT_TRUE(r.Skip());
+                EXPECT_EQ(2u, r.GetDepth());
+            }
+            break;
+        case kPullTokenNumber:
+            EXPECT_TRUE(inKeep);
+            sum += r.GetInt();
+            break;
+        default:
+            break;
+        }
+    }
+    EXPECT_FALSE(r.HasParseError());
+    EXPECT_EQ(5, sum);
+    EXPECT_EQ(0u, r.GetDepth());
+}
+
+// Sends the events of the next element to a document.
+struct ElementGenerator {
+    explicit ElementGenerator(PullReader& r) : reader(r), parsed() {}
+    template <typename Handler>
+    bool operator()(Handler& handler) { return parsed = reader.ParseElement(handler); }
+    PullReader& reader;
+    bool parsed;
+};
+
+TEST(PullReader, ParseElement) {
+    StringStream s("{\"a\": [ {\"b\": [1, 2]} , \"c\", 3, [4] ], \"d\": []}");
+    PullReader r(s);
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenStartArray, r.GetToken());
+
+    ElementGenerator g(r);
+    Document d;
+    d.Populate(g);
+    EXPECT_TRUE(g.parsed);
+    EXPECT_EQ(2, d["b"][1].GetInt());
+    EXPECT_EQ(kPullTokenNone, r.GetToken());
+    d.Reset().Populate(g);
+    EXPECT_STREQ("c", d.GetString());
+
+    // Tokens and whole elements can be mixed.
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(3, r.GetInt());
+    d.Reset().Populate(g);
+    EXPECT_EQ(4, d[0].GetInt());
+    d.Reset().Populate(g);
+    EXPECT_FALSE(g.parsed);
+    EXPECT_FALSE(r.HasParseError());
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenEndArray, r.GetToken());
+    EXPECT_EQ(1u, r.GetDepth());
+
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenStartArray, r.GetToken());
+    d.Reset().Populate(g);
+    EXPECT_FALSE(g.parsed);
+    EXPECT_TRUE(r.Next());
+    EXPECT_EQ(kPullTokenEndArray, r.GetToken());
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.Next());
+    EXPECT_FALSE(r.HasParseError());
+}
+
+TEST(PullReader, ParseElementError) {
+    const char* json[] = { "[1 2]", "[1, ]", "[1, {\"a\" 1}]", "[1" };
+    const ParseErrorCode codes[] = { kParseErrorArrayMissCommaOrSquareBracket, kParseErrorValueInvalid, kParseErrorObjectMissColon, kParseErrorArrayMissCommaOrSquareBracket };
+    const size_t offsets[] = { 3, 4, 9, 2 };
+    for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+        StringStream s(json[i]);
+        PullReader r(s);
+        ElementGenerator g(r);
+        Document d;
+        EXPECT_TRUE(r.Next());
+        do
+            d.Reset().Populate(g);
+        while (g.parsed);
+        if (!r.HasParseError()) {
+            EXPECT_FALSE(r.Next());
+        }
+        EXPECT_EQ(codes[i], r.GetParseErrorCode()) << i;
+        EXPECT_EQ(offsets[i], r.GetErrorOffset()) << i;
+    }
+}
+
+TEST(PullReader, Error) {
+    StringStream s("[1, 2");
+    PullReader r(s);
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_TRUE(r.Next());
+    EXPECT_FALSE(r.Next());
+    EXPECT_TRUE(r.IsDone());
+    EXPECT_EQ(kPullTokenNone, r.GetToken());
+    EXPECT_TRUE(r.HasParseError());
+    EXPECT_EQ(kParseErrorArrayMissCommaOrSquareBracket, r.GetParseErrorCode());
+    EXPECT_EQ(5u, r.GetErrorOffset());
+    EXPECT_FALSE(r.Next());
+
+    StringStream s2("");
+    PullReader r2(s2);
+    EXPECT_FALSE(r2.Next());
+    EXPECT_EQ(kParseErrorDocumentEmpty, r2.GetParseErrorCode());
+}
@@ -18,6 +18,8 @@
 #include "rapidjson/internal/dtoa.h"
 #include "rapidjson/internal/itoa.h"
 #include "rapidjson/memorystream.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 using namespace rapidjson;
 
@@ -239,6 +241,12 @@ static void TestParseDouble() {
     TEST_DOUBLE(fullPrecision, "1e-214748364", 0.0);
     TEST_DOUBLE(fullPrecision, "1e-21474836311", 0.0);
     TEST_DOUBLE(fullPrecision, "0.017976931348623157e+310", 1.7976931348623157e+308); // Max double in another form
+    TEST_DOUBLE(fullPrecision, "123456789012345678.9012345", 123456789012345678.9012345);
+    TEST_DOUBLE(fullPrecision, "12345678901234567890123.4567", 12345678901234567890123.4567);
+    TEST_DOUBLE(fullPrecision, "0.00000000000000000000001234567890123456789012345", 0.00000000000000000000001234567890123456789012345);
+    TEST_DOUBLE(fullPrecision, "99652783630921e-338", 0.0);                          // Rounds to zero
+    TEST_DOUBLE(fullPrecision, "2.4703282292062328e-324", 4.9406564584124654e-324);  // Above half of minimum denormal
+    TEST_DOUBLE(fullPrecision, "2.4703282292062327e-324", 0.0);                      // Below half of minimum denormal
 
     // Since
     // abs((2^-1022 - 2^-1074) - 2.2250738585072012e-308) = 3.109754131239141401123495768877590405345064751974375599... �� 10^-324
@@ -726,6 +734,51 @@ TEST(Reader, ParseString_Error) {
 #undef TEST_STRINGARRAY_ERROR
 }
 
+TEST(Reader, ParseString_ValidateEncodingRuns) {
+    // Runs of unescaped characters are validated at once, before and after an escape,
+    // which are skipped in place and moved by insitu parsing.
+    const std::string bad = "\xE2\x28";
+    for (size_t before = 0; before < 40; before++)
+        for (int where = 0; where < 3; where++) {
+            std::string json = "\"" + std::string(before, 'a') + "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+            if (where == 1)
+                json += bad;
+            json += "\\n" + std::string(before % 19, 'b') + "\xE4\xB8\xAD";
+            if (where == 2)
+                json += bad;
+            json += "cc\"";
+            const size_t errorOffset = json.find(bad);
+
+            StringStream s(json.c_str());
+            Reader reader;
+            if (where == 0) {
+                ParseStringHandler<UTF8<> > h;
+                EXPECT_TRUE(reader.Parse<kParseValidateEncodingFlag>(s, h));
+                std::string expected = json.substr(1, json.size() - 2);
+                expected.replace(expected.find("\\n"), 2, "\n");
+                EXPECT_EQ(expected, std::string(h.str_, h.length_));
+
+                std::string insitu = json;
+                InsituStringStream is(&insitu[0]);
+                ParseStringHandler<UTF8<> > h2;
+                EXPECT_TRUE(reader.Parse<kParseInsituFlag | kParseValidateEncodingFlag>(is, h2));
+                EXPECT_EQ(expected, std::string(h2.str_, h2.length_));
+            }
+            else {
+                BaseReaderHandler<> h;
+                EXPECT_FALSE(reader.Parse<kParseValidateEncodingFlag>(s, h));
+                EXPECT_EQ(kParseErrorStringInvalidEncoding, reader.GetParseErrorCode());
+                EXPECT_EQ(errorOffset, reader.GetErrorOffset());
+
+                std::string insitu = json;
+                InsituStringStream is(&insitu[0]);
+                EXPECT_FALSE(reader.Parse<kParseInsituFlag | kParseValidateEncodingFlag>(is, h));
+                EXPECT_EQ(kParseErrorStringInvalidEncoding, reader.GetParseErrorCode());
+                EXPECT_EQ(errorOffset, reader.GetErrorOffset());
+            }
+        }
+}
+
 template <unsigned count>
 struct ParseArrayHandler : BaseReaderHandler<UTF8<>, ParseArrayHandler<count> > {
     ParseArrayHandler() : step_(0) {}
@@ -1057,6 +1110,8 @@ TEST(Reader, CustomStringStream) {
 }
 
 #include <sstream>
+#include <iomanip>
+#include <algorithm>
 
 class IStreamWrapper {
 public:
@@ -1113,6 +1168,15 @@ TEST(Reader, Parse_IStreamWrapper_StringStream) {
     EXPECT_EQ(errorCode, reader.GetParseErrorCode()); \
     EXPECT_EQ(offset, reader.GetErrorOffset()); \
     EXPECT_EQ(streamPos, json.Tell()); \
+    StringStream json2(text); \
+    reader.IterativeParseInit(); \
+    while (!reader.IterativeParseComplete()) \
+        if (!reader.IterativeParseNext<kParseDefaultFlags>(json2, handler)) \
+            break; \
+    EXPECT_TRUE(reader.HasParseError()); \
+    EXPECT_EQ(errorCode, reader.GetParseErrorCode()); \
+    EXPECT_EQ(offset, reader.GetErrorOffset()); \
+    EXPECT_EQ(streamPos, json2.Tell()); \
 }
 
 TEST(Reader, IterativeParsing_ErrorHandling) {
@@ -1285,6 +1349,109 @@ TEST(Reader, IterativeParsing_Count) {
     }
 }
 
+TEST(Reader, IterativeParsing_TokenByToken) {
+    StringStream is(" [1, {\"k\": [1, 2]}, null, \"string\"] ");
+    Reader reader;
+    IterativeParsingReaderHandler<> handler;
+
+    int e[] = {
+        handler.LOG_STARTARRAY,
+        handler.LOG_INT,
+        handler.LOG_STARTOBJECT,
+        handler.LOG_KEY,
+        handler.LOG_STARTARRAY,
+        handler.LOG_INT,
+        handler.LOG_INT,
+        handler.LOG_ENDARRAY, 2,
+        handler.LOG_ENDOBJECT, 1,
+        handler.LOG_NULL,
+        handler.LOG_STRING,
+        handler.LOG_ENDARRAY, 4
+    };
+
+    // One event per call, the counts of the End events take one more log entry.
+    reader.IterativeParseInit();
+    for (size_t i = 0; !reader.IterativeParseComplete(); i++) {
+        size_t before = handler.LogCount;
+        EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler));
+        EXPECT_EQ(e[before], handler.Logs[before]) << "i = " << i;
+        EXPECT_EQ(e[before] == handler.LOG_ENDARRAY || e[before] == handler.LOG_ENDOBJECT ? 2u : 1u, handler.LogCount - before);
+    }
+    EXPECT_EQ(sizeof(e) / sizeof(int), handler.LogCount);
+    EXPECT_FALSE(reader.HasParseError());
+    EXPECT_EQ(0, is.Peek());
+
+    // The reader can be initialized again for another text.
+    StringStream is2("{\"a\":1}x");
+    reader.IterativeParseInit();
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is2, handler));
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is2, handler));
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is2, handler));
+    EXPECT_FALSE(reader.IterativeParseNext<kParseDefaultFlags>(is2, handler));
+    EXPECT_TRUE(reader.IterativeParseComplete());
+    EXPECT_EQ(kParseErrorDocumentRootNotSingular, reader.GetParseErrorCode());
+    EXPECT_EQ(7u, reader.GetErrorOffset());
+
+    // Unless parsing stops when done.
+    StringStream is3("[]x");
+    reader.IterativeParseInit();
+    EXPECT_TRUE(reader.IterativeParseNext<kParseStopWhenDoneFlag>(is3, handler));
+    EXPECT_TRUE(reader.IterativeParseNext<kParseStopWhenDoneFlag>(is3, handler));
+    EXPECT_TRUE(reader.IterativeParseComplete());
+    EXPECT_FALSE(reader.HasParseError());
+    EXPECT_EQ('x', is3.Peek());
+}
+
+TEST(Reader, IterativeParsing_TokenByTokenSkip) {
+    StringStream is("{\"a\": {\"b\": [1, \"]\"]}, \"c\": [2, 3], \"d\": 4}");
+    Reader reader;
+    IterativeParsingReaderHandler<> handler;
+
+    reader.IterativeParseInit();
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // {
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // "a"
+    EXPECT_TRUE(reader.IterativeParseSkip<kParseDefaultFlags>(is));          // {"b": ...}
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // "c"
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // [
+    EXPECT_TRUE(reader.IterativeParseSkip<kParseDefaultFlags>(is));          // 2, 3]
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // "d"
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // 4
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is, handler)); // }
+    EXPECT_TRUE(reader.IterativeParseComplete());
+    EXPECT_FALSE(reader.HasParseError());
+
+    int e[] = {
+        handler.LOG_STARTOBJECT,
+        handler.LOG_KEY,
+        handler.LOG_KEY,
+        handler.LOG_STARTARRAY,
+        handler.LOG_KEY,
+        handler.LOG_INT,
+        handler.LOG_ENDOBJECT, 3
+    };
+    EXPECT_EQ(sizeof(e) / sizeof(int), handler.LogCount);
+    for (size_t i = 0; i < handler.LogCount; ++i)
+        EXPECT_EQ(e[i], handler.Logs[i]) << "i = " << i;
+
+    // Skipping the root.
+    StringStream is2("[[1], 2] ");
+    reader.IterativeParseInit();
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is2, handler));
+    EXPECT_TRUE(reader.IterativeParseSkip<kParseDefaultFlags>(is2));
+    EXPECT_TRUE(reader.IterativeParseComplete());
+    EXPECT_FALSE(reader.HasParseError());
+
+    // Unclosed array.
+    StringStream is3("{\"a\": [1, 2}");
+    reader.IterativeParseInit();
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is3, handler));
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is3, handler));
+    EXPECT_TRUE(reader.IterativeParseNext<kParseDefaultFlags>(is3, handler));
+    EXPECT_FALSE(reader.IterativeParseSkip<kParseDefaultFlags>(is3));
+    EXPECT_TRUE(reader.IterativeParseComplete());
+    EXPECT_EQ(kParseErrorArrayMissCommaOrSquareBracket, reader.GetParseErrorCode());
+}
+
 // Test iterative parsing on kParseErrorTermination.
 struct HandlerTerminateAtStartObject : public IterativeParsingReaderHandler<> {
     bool StartObject() { return false; }
@@ -1774,6 +1941,345 @@ TEST(Reader, TrailingCommaHandlerTerminationIterative) {
     TestTrailingCommaHandlerTermination<kParseIterativeFlag>();
 }
 
+// Skips the values of members whose name begins with 'x', and objects/arrays nested deeper than 2.
+struct SkipValueHandler : BaseReaderHandler<UTF8<>, SkipValueHandler> {
+    SkipValueHandler() : events(), depth(), skip() {}
+    bool Default() { events += "v|"; return true; }
+    bool String(const char*, SizeType, bool) { events += "s|"; return true; }
+    bool Key(const char* str, SizeType length, bool) {
+        events.append(str, length);
+        events += "|";
+        skip = str[0] == 'x';
+        return true;
+    }
+    bool StartObject() { return Start('{'); }
+    bool EndObject(SizeType n) { return End('}', n); }
+    bool StartArray() { return Start('['); }
+    bool EndArray(SizeType n) { return End(']', n); }
+    bool SkipValue() { bool b = skip; skip = false; return b; }
+
+    bool Start(char c) {
+        events += c;
+        if (++depth > 2) {
+            events += '~';
+            depth--;
+            skip = true;
+        }
+        events += '|';
+        return true;
+    }
+    bool End(char c, SizeType n) {
+        depth--;
+        events += c;
+        events += static_cast<char>('0' + n);
+        events += '|';
+        return true;
+    }
+
+    std::string events;
+    unsigned depth;
+    bool skip;
+};
+
+template <unsigned parseFlags>
+static void TestSkipValue() {
+    const char* json =
+        "{ \"a\" : 1, \"xs\" : \"s\\\"}]\\\\\", \"xo\" : { \"b\" : [1, {\"c\":\"}\"}] },"
+        " \"d\" : [[1, [2]], {\"e\":{}}, 3], \"xn\" : -1.5e3, \"xt\" : true , \"xa\":[],\"f\":\"g\" }";
+    const char* expected = "{|a|v|xs|xo|d|[|[~|{~|v|]3|xn|xt|xa|f|s|}8|";
+    {
+        StringStream s(json);
+        SkipValueHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<parseFlags | kParseSkipValueFlag>(s, h));
+        EXPECT_EQ(std::string(expected), h.events);
+    }
+    {
+        char* buffer = StrDup(json);
+        InsituStringStream s(buffer);
+        SkipValueHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<parseFlags | kParseSkipValueFlag | kParseInsituFlag>(s, h));
+        EXPECT_EQ(std::string(expected), h.events);
+        free(buffer);
+    }
+    {
+        // Without the flag, SkipValue() is never called.
+        StringStream s(json);
+        SkipValueHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<parseFlags>(s, h));
+        EXPECT_NE(std::string::npos, h.events.find("|c|"));
+    }
+    {
+        // Comments inside skipped values
+        StringStream s("{\"xa\":[1,/* ] */2 // }\n], \"b\":[[/*]*/]]}");
+        SkipValueHandler h;
+        Reader reader;
+        EXPECT_TRUE(reader.Parse<parseFlags | kParseSkipValueFlag | kParseCommentsFlag>(s, h));
+        EXPECT_EQ(std::string("{|xa|b|[|[~|]1|}2|"), h.events);
+    }
+
+#define TEST_SKIP_ERROR(errorCode, json, errorOffset) \
+    { \
+        StringStream s(json); \
+        SkipValueHandler h; \
+        Reader reader; \
+        reader.Parse<parseFlags | kParseSkipValueFlag>(s, h); \
+        EXPECT_TRUE(reader.HasParseError()); \
+        EXPECT_EQ(errorCode, reader.GetParseErrorCode()); \
+        EXPECT_EQ(errorOffset, reader.GetErrorOffset()); \
+    }
+
+    TEST_SKIP_ERROR(kParseErrorArrayMissCommaOrSquareBracket, "{\"x\":[1,2", 9u);
+    TEST_SKIP_ERROR(kParseErrorArrayMissCommaOrSquareBracket, "{\"x\":[1}", 7u);
+    TEST_SKIP_ERROR(kParseErrorObjectMissCommaOrCurlyBracket, "{\"x\":{\"a\":1]", 11u);
+    TEST_SKIP_ERROR(kParseErrorStringMissQuotationMark, "{\"x\":\"abc", 9u);
+    TEST_SKIP_ERROR(kParseErrorStringMissQuotationMark, "{\"x\":[\"a\\", 9u);
+    TEST_SKIP_ERROR(kParseErrorObjectMissColon, "{\"x\" 1}", 5u);
+    TEST_SKIP_ERROR(kParseErrorValueInvalid, "{\"x\":,}", 5u);
+    TEST_SKIP_ERROR(kParseErrorObjectMissCommaOrCurlyBracket, "{\"x\":1 2}", 7u);
+    TEST_SKIP_ERROR(kParseErrorArrayMissCommaOrSquareBracket, "[[[[1]]]", 8u);
+
+#undef TEST_SKIP_ERROR
+}
+
+TEST(Reader, SkipValue) {
+    TestSkipValue<kParseNoFlags>();
+}
+
+TEST(Reader, SkipValueIterative) {
+    TestSkipValue<kParseIterativeFlag>();
+}
+
+TEST(Reader, SkipValueStructuralIndex) {
+    TestSkipValue<kParseStructuralIndexFlag>();
+}
+
+// Logs the events, with the runs of numbers of kParseNumberRunsFlag in parentheses.
+struct NumberRunsHandler : BaseReaderHandler<UTF8<>, NumberRunsHandler> {
+    NumberRunsHandler() : events(), failAt(-1) {}
+    bool Default() { events += "v|"; return true; }
+    bool Int(int i) { return Log("i", static_cast<double>(i)); }
+    bool Uint(unsigned u) { return Log("u", u); }
+    bool Int64(int64_t i) { return Log("I", static_cast<double>(i)); }
+    bool Uint64(uint64_t u) { return Log("U", static_cast<double>(u)); }
+    bool Double(double d) { return Log("d", d); }
+    bool StartArray() { events += "[|"; return true; }
+    bool EndArray(SizeType n) { return Log("]", n); }
+    bool Doubles(const double* values, SizeType count) { return Run("D(", values, count); }
+    bool Int64s(const int64_t* values, SizeType count) { return Run("I(", values, count); }
+
+    bool Log(const char* type, double value) {
+        std::ostringstream os;
+        os << type << value << "|";
+        events += os.str();
+        return true;
+    }
+    template <typename T>
+    bool Run(const char* type, const T* values, SizeType count) {
+        std::ostringstream os;
+        os << type;
+        for (SizeType i = 0; i < count; i++)
+            os << (i ? "," : "") << values[i];
+        os << ")|";
+        events += os.str();
+        return failAt-- != 0;
+    }
+
+    std::string events;
+    int failAt;     //!< Number of runs before one fails.
+};
+
+// Logs the events, with the default Doubles() and Int64s().
+struct NumberEventsHandler : BaseReaderHandler<UTF8<>, NumberEventsHandler> {
+    NumberEventsHandler() : events() {}
+    bool Default() { events += "v|"; return true; }
+    bool Int(int i) { return Log("i", static_cast<double>(i)); }
+    bool Uint(unsigned u) { return Log("u", u); }
+    bool Int64(int64_t i) { return Log("I", static_cast<double>(i)); }
+    bool Uint64(uint64_t u) { return Log("U", static_cast<double>(u)); }
+    bool Double(double d) { return Log("d", d); }
+    bool StartArray() { events += "[|"; return true; }
+    bool EndArray(SizeType n) { return Log("]", n); }
+    bool Log(const char* type, double value) {
+        std::ostringstream os;
+        os << std::setprecision(17) << type << value << "|";
+        events += os.str();
+        return true;
+    }
+    std::string events;
+};
+
+template <unsigned parseFlags>
+static std::string ParseNumberRuns(const char* json) {
+    StringStream s(json);
+    NumberRunsHandler h;
+    Reader reader;
+    EXPECT_TRUE(reader.Parse<parseFlags | kParseNumberRunsFlag>(s, h)) << json;
+    return h.events;
+}
+
+TEST(Reader, NumberRuns) {
+    EXPECT_EQ("[|D(1.5,2.5)|]2|", ParseNumberRuns<kParseNoFlags>("[1.5, 2.5]"));
+    EXPECT_EQ("[|I(1,-2,5000000000)|]3|", ParseNumberRuns<kParseNoFlags>("[1,-2, 5000000000 ]"));
+    EXPECT_EQ("[|I(1)|D(2.5)|I(3)|]3|", ParseNumberRuns<kParseNoFlags>("[1,2.5,3]"));
+    EXPECT_EQ("[|I(1)|U1.84467e+19|I(2)|]3|", ParseNumberRuns<kParseNoFlags>("[1,18446744073709551615,2]"));
+    EXPECT_EQ("[|I(1,2)|v|I(3)|[|D(4.5)|]1|v|]6|", ParseNumberRuns<kParseNoFlags>("[1,2,null,3,[4.5],\"x\"]"));
+    EXPECT_EQ("[|v|I(1)|]2|", ParseNumberRuns<kParseNoFlags>("[true,1]"));
+    EXPECT_EQ("v|v|i-1|v|d2.5|v|", ParseNumberRuns<kParseNoFlags>("{\"a\":-1,\"b\":2.5}"));
+    EXPECT_EQ("u7|", ParseNumberRuns<kParseNoFlags>("7"));
+    EXPECT_EQ("[|I(1,2)|]2|", ParseNumberRuns<kParseTrailingCommasFlag>("[1,2,]"));
+    EXPECT_EQ("[|I(1,2)|]2|", ParseNumberRuns<kParseCommentsFlag>("[1 /* , */, // ]\n 2]"));
+    EXPECT_EQ("[|I(1,2)|]2|", ParseNumberRuns<kParseInsituFlag>("[1,2]"));
+
+    // Not in runs with other parsers, nor with numbers as strings.
+    EXPECT_EQ("[|u1|d2.5|]2|", ParseNumberRuns<kParseIterativeFlag>("[1,2.5]"));
+    EXPECT_EQ("[|u1|d2.5|]2|", ParseNumberRuns<kParseStructuralIndexFlag>("[1,2.5]"));
+    EXPECT_EQ("[|v|v|]2|", ParseNumberRuns<kParseNumbersAsStringsFlag>("[1,2.5]"));
+
+    // Batches of 256
+    std::string json = "[0";
+    for (int i = 1; i < 300; i++) {
+        json += ",";
+        json += static_cast<char>('0' + i % 10);
+    }
+    json += "]";
+    StringStream s(json.c_str());
+    NumberRunsHandler h;
+    Reader reader;
+    EXPECT_TRUE(reader.Parse<kParseNumberRunsFlag>(s, h));
+    EXPECT_EQ(2u, static_cast<size_t>(std::count(h.events.begin(), h.events.end(), '(')));
+    EXPECT_NE(std::string::npos, h.events.find(",5)|I(6,"));
+    EXPECT_NE(std::string::npos, h.events.find(")|]300|"));
+}
+
+TEST(Reader, NumberRunsError) {
+    const char* errors[] = { "[1,2", "[1 2]", "[1,]", "[1,2}", "[1,-]", "[1,2.]", "[1,2,01]", "[1,[2,3]" };
+    for (size_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++) {
+        Reader expectedReader, reader;
+        StringStream expectedStream(errors[i]), s(errors[i]);
+        NumberEventsHandler expectedHandler, h;
+        expectedReader.Parse(expectedStream, expectedHandler);
+        reader.Parse<kParseNumberRunsFlag>(s, h);
+        EXPECT_TRUE(reader.HasParseError()) << errors[i];
+        EXPECT_EQ(expectedReader.GetParseErrorCode(), reader.GetParseErrorCode()) << errors[i];
+        EXPECT_EQ(expectedReader.GetErrorOffset(), reader.GetErrorOffset()) << errors[i];
+    }
+
+    // Termination by the handler
+    for (int failAt = 0; failAt < 3; failAt++) {
+        StringStream s("[1,2,[3.5],4]");
+        NumberRunsHandler h;
+        h.failAt = failAt;
+        Reader reader;
+        EXPECT_FALSE(reader.Parse<kParseNumberRunsFlag>(s, h));
+        EXPECT_EQ(kParseErrorTermination, reader.GetParseErrorCode());
+    }
+}
+
+TEST(Reader, NumberRunsDefault) {
+    // BaseReaderHandler reports the numbers of a run one by one, as without the flag.
+    const char* json = "[0, -1, 1, 2147483647, -2147483648, 2147483648, -2147483649, 4294967295, 4294967296,"
+        " 9223372036854775807, -9223372036854775808, 18446744073709551615, 1.5, -0.0, 1e-300, [1, 2.5, {}]]";
+    StringStream expectedStream(json), s(json);
+    NumberEventsHandler expected, h;
+    Reader reader;
+    EXPECT_TRUE(reader.Parse(expectedStream, expected));
+    EXPECT_TRUE(reader.Parse<kParseNumberRunsFlag>(s, h));
+    EXPECT_EQ(expected.events, h.events);
+}
+
+// Parses json with and without kParseStructuralIndexFlag, the events and errors must be the same.
+template <unsigned parseFlags>
+static void TestStructuralIndex(const char* json) {
+    StringBuffer expected, actual;
+    Writer<StringBuffer> expectedWriter(expected), actualWriter(actual);
+    Reader expectedReader, actualReader;
+    {
+        StringStream s(json);
+        expectedReader.Parse<parseFlags>(s, expectedWriter);
+    }
+    {
+        StringStream s(json);
+        actualReader.Parse<parseFlags | kParseStructuralIndexFlag>(s, actualWriter);
+    }
+    EXPECT_EQ(expectedReader.GetParseErrorCode(), actualReader.GetParseErrorCode()) << json;
+    EXPECT_EQ(expectedReader.GetErrorOffset(), actualReader.GetErrorOffset()) << json;
+    EXPECT_STREQ(expected.GetString(), actual.GetString()) << json;
+
+    char* buffer = StrDup(json);
+    StringBuffer insitu;
+    Writer<StringBuffer> insituWriter(insitu);
+    InsituStringStream s(buffer);
+    actualReader.Parse<parseFlags | kParseStructuralIndexFlag | kParseInsituFlag>(s, insituWriter);
+    EXPECT_EQ(expectedReader.GetParseErrorCode(), actualReader.GetParseErrorCode()) << json;
+    EXPECT_EQ(expectedReader.GetErrorOffset(), actualReader.GetErrorOffset()) << json;
+    EXPECT_STREQ(expected.GetString(), insitu.GetString()) << json;
+    free(buffer);
+}
+
+TEST(Reader, StructuralIndex) {
+    static const char* const json[] = {
+        "", " \n", "null", " true ", "false", "\"\"", "-1.5e-3", "0", "[]", "{}", " [ ] ", " { } ",
+        "[1,2,3]", "{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}",
+        " { \"a\" :\t1 ,\n\"b\"\r:[ 1 , [ ] , { } ] } ",
+        "[\"\\\"\",\"\\\\\",\"\\\\\\\"\",\"\\u00e9\\uD834\\uDD1E\",\"[{]},:\",\"\\/\"]",
+        "{\"\\\"}\":\"{\"}",
+        "1 2", "[1 2]", "[1,]", "[1,2", "[", "{", "{\"a\":1,}", "{\"a\" 1}", "{1:1}", "{\"a\":}", "{\"a\"",
+        "{\"a\":1", "{,}", "[,]", "[1,,2]", "[\"a]", "\"abc", "\"\\", "[\"\\x\"]", "[\"\\u00\"]", "nul", "[tru]",
+        "[1x]", "[\"a\"x]", "[\"a\"\"b\"]", "{\"a\":1x}", "{\"a\"x:1}", "[-]", "[1.]", "[01]", "[1e]", "[1,2]]",
+        "{}{}", "[}", "{]", "[1\f2]", "[1\v]", "{\"a\":1}x", "[\n1\n,\n2\n]x", "\\", "[\\\"]", "]", ":",
+        "{\"a\":[1,{\"b\":[2,{\"c\":[3]}]}],\"d\":[[[[[]]]]]}", "[[[[[1]]]],2", "{\"a\":{\"b\":{\"c\":1}}"
+    };
+    for (size_t i = 0; i < sizeof(json) / sizeof(json[0]); i++) {
+        TestStructuralIndex<kParseNoFlags>(json[i]);
+        TestStructuralIndex<kParseTrailingCommasFlag>(json[i]);
+        TestStructuralIndex<kParseNumbersAsStringsFlag>(json[i]);
+    }
+
+    // Every prefix of a text spanning several 64-byte blocks, with escapes and tokens across block boundaries.
+    std::string text = "{";
+    for (int i = 0; i < 8; i++) {
+        text += std::string(static_cast<size_t>(i * 5), ' ');
+        text += "\"k\\\\\\\"";
+        text += static_cast<char>('a' + i);
+        text += "\" : [ \"\\\\\", \"a\\\"b\\\\\", 1.25e";
+        text += static_cast<char>('0' + i);
+        text += " ,true,null, {\"x\":[]},\"\\u00e9\\\\\\\\\" ],";
+    }
+    text += "\"end\":false}";
+    for (size_t length = 0; length <= text.size(); length++) {
+        const std::string prefix = text.substr(0, length);
+        TestStructuralIndex<kParseNoFlags>(prefix.c_str());
+        TestStructuralIndex<kParseValidateEncodingFlag | kParseFullPrecisionFlag>(prefix.c_str());
+    }
+}
+
+struct TerminateAfterHandler : BaseReaderHandler<UTF8<>, TerminateAfterHandler> {
+    explicit TerminateAfterHandler(unsigned n) : remaining(n) {}
+    bool Default() { return remaining-- != 0; }
+    bool Key(const char*, SizeType, bool) { return Default(); }
+    bool StartObject() { return Default(); }
+    bool EndObject(SizeType) { return Default(); }
+    bool StartArray() { return Default(); }
+    bool EndArray(SizeType) { return Default(); }
+    unsigned remaining;
+};
+
+TEST(Reader, StructuralIndexTermination) {
+    const char* json = "{\"a\":[1,{}],\"b\":{\"c\":[]},\"d\":\"e\"}";
+    for (unsigned n = 0; n < 15; n++) {
+        Reader expectedReader, actualReader;
+        TerminateAfterHandler h1(n), h2(n);
+        StringStream s1(json), s2(json);
+        expectedReader.Parse(s1, h1);
+        actualReader.Parse<kParseStructuralIndexFlag>(s2, h2);
+        EXPECT_EQ(expectedReader.GetParseErrorCode(), actualReader.GetParseErrorCode()) << n;
+        EXPECT_EQ(expectedReader.GetErrorOffset(), actualReader.GetErrorOffset()) << n;
+    }
+}
+
 #ifdef __GNUC__
 RAPIDJSON_DIAG_POP
 #endif
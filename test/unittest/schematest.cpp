@@ -16,6 +16,7 @@
 #include "rapidjson/schema.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
+#include <string>
 
 #ifdef __clang__
 RAPIDJSON_DIAG_PUSH
@@ -190,6 +191,27 @@ TEST(SchemaValidator, Enum_Typless) {
     INVALIDATE(s, "0", "", "enum", "");
 }
 
+TEST(SchemaValidator, Enum_Large) {
+    std::string schema = "{\"enum\": [null, [1, {\"a\": 2}]";
+    for (unsigned i = 0; i < 1000; i += 2) {
+        char value[32];
+        sprintf(value, ", %u, \"%u\"", i, i);
+        schema += value;
+    }
+    Document sd;
+    sd.Parse((schema + "]}").c_str());
+    ASSERT_FALSE(sd.HasParseError());
+    SchemaDocument s(sd);
+
+    VALIDATE(s, "null", true);
+    VALIDATE(s, "[1, {\"a\": 2}]", true);
+    VALIDATE(s, "998", true);
+    VALIDATE(s, "\"0\"", true);
+    INVALIDATE(s, "999", "", "enum", "");
+    INVALIDATE(s, "\"1\"", "", "enum", "");
+    INVALIDATE(s, "[{\"a\": 2}, 1]", "", "enum", "");
+}
+
 TEST(SchemaValidator, Enum_InvalidType) {
     Document sd;
     sd.Parse("{ \"type\": \"string\", \"enum\": [\"red\", \"amber\", \"green\", null] }");
@@ -869,6 +891,31 @@ TEST(SchemaValidator, Array_UniqueItems) {
     VALIDATE(s, "[]", true);
 }
 
+TEST(SchemaValidator, Array_UniqueItems_Large) {
+    Document sd;
+    sd.Parse("{\"type\": \"array\", \"uniqueItems\": true}");
+    SchemaDocument s(sd);
+
+    // Enough items to grow the set of hash codes several times.
+    std::string json = "[{\"a\": [1, 2], \"b\": null}, {\"b\": null, \"a\": [2, 1]}, [], {}, \"\", 0, 0.5";
+    for (unsigned i = 1; i < 1000; i++) {
+        char item[32];
+        sprintf(item, ", %u, \"%u\"", i, i);
+        json += item;
+    }
+    VALIDATE(s, (json + "]").c_str(), true);
+    INVALIDATE(s, (json + ", 500]").c_str(), "", "uniqueItems", "/2005");
+    INVALIDATE(s, (json + ", {\"a\": [1, 2], \"b\": null}]").c_str(), "", "uniqueItems", "/2005");     // members in any order
+    INVALIDATE(s, (json + ", 0]").c_str(), "", "uniqueItems", "/2005");
+    INVALIDATE(s, (json + ", []]").c_str(), "", "uniqueItems", "/2005");
+
+    // Nested arrays have their own items.
+    sd.Parse("{\"uniqueItems\": true, \"items\": {\"uniqueItems\": true}}");
+    SchemaDocument nested(sd);
+    VALIDATE(nested, "[[1, 2], [2, 1], [[1], [2]]]", true);
+    INVALIDATE(nested, "[[1, 2], [[1], [1]]]", "/items", "uniqueItems", "/1/1");
+}
+
 TEST(SchemaValidator, Boolean) {
     Document sd;
     sd.Parse("{\"type\":\"boolean\"}");
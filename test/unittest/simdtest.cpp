@@ -22,6 +22,9 @@
 #elif defined(__SSE2__)
 #  define RAPIDJSON_SSE2
 #endif
+#if defined(__AVX2__)
+#  define RAPIDJSON_AVX2
+#endif
 
 #define RAPIDJSON_NAMESPACE rapidjson_simd
 
@@ -29,6 +32,8 @@
 
 #include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <vector>
 
 #ifdef __GNUC__
 RAPIDJSON_DIAG_PUSH
@@ -37,7 +42,9 @@ RAPIDJSON_DIAG_OFF(effc++)
 
 using namespace rapidjson_simd;
 
-#ifdef RAPIDJSON_SSE2
+#ifdef RAPIDJSON_AVX2
+#define SIMD_SUFFIX(name) name##_AVX2
+#elif defined(RAPIDJSON_SSE2)
 #define SIMD_SUFFIX(name) name##_SSE2
 #elif defined(RAPIDJSON_SSE42)
 #define SIMD_SUFFIX(name) name##_SSE42
@@ -210,6 +217,297 @@ TEST(SIMD, SIMD_SUFFIX(ScanWriteUnescapedString)) {
     }
 }
 
+struct SimdSkipValueHandler : BaseReaderHandler<UTF8<>, SimdSkipValueHandler> {
+    SimdSkipValueHandler() : y(), skip() {}
+    bool Uint(unsigned u) { y = u; return true; }
+    bool Key(const char* str, SizeType, bool) { skip = str[0] == 'x'; return true; }
+    bool SkipValue() { return skip; }
+    unsigned y;
+    bool skip;
+};
+
+template <unsigned parseFlags, typename StreamType>
+void TestSkipStructure() {
+    char buffer[1024 + 64 + 32];
+    char backup[1024 + 64 + 32];
+
+    for (size_t offset = 0; offset < 32; offset++) {
+        for (size_t step = 0; step < 256; step++) {
+            // {"x":["ABCD...\"\\]{", {"a":[[0,1,...]]}, "ABCD...\\"],"y":123}
+            // and {"x":"ABCD...\\","y":123}
+            for (int kind = 0; kind < 2; kind++) {
+                char* json = buffer + offset;
+                char* p = json;
+                const char* head = kind == 0 ? "{\"x\":[\"" : "{\"x\":\"";
+                while (*head)
+                    *p++ = *head++;
+                for (size_t i = 0; i < step; i++)
+                    *p++ = "AB{]"[i % 4];
+                *p++ = '\\';
+                *p++ = '\\';
+                if (kind == 0) {
+                    const char* middle = "\\\"]{\", {\"a\":[[";
+                    while (*middle)
+                        *p++ = *middle++;
+                    for (size_t i = 0; i < step % 32; i++) {
+                        *p++ = static_cast<char>('0' + i % 10);
+                        *p++ = i % 3 == 0 ? ',' : ']';
+                        if (i % 3 != 0) {
+                            *p++ = ',';
+                            *p++ = '[';
+                        }
+                    }
+                    *p++ = '0';
+                    *p++ = ']';
+                    *p++ = ']';
+                    *p++ = '}';
+                    *p++ = ']';
+                }
+                else
+                    *p++ = '\"';
+                const char* tail = ",\"y\":123}";
+                while (*tail)
+                    *p++ = *tail++;
+                *p = '\0';
+                strcpy(backup, json);
+
+                StreamType s(json);
+                Reader reader;
+                SimdSkipValueHandler h;
+                EXPECT_TRUE(reader.Parse<parseFlags | kParseSkipValueFlag>(s, h)) << backup;
+                EXPECT_EQ(123u, h.y) << backup;
+
+                // The skipped text is valid JSON
+                StringStream s2(backup);
+                BaseReaderHandler<> full;
+                EXPECT_TRUE(reader.Parse(s2, full)) << backup;
+            }
+        }
+    }
+}
+
+TEST(SIMD, SIMD_SUFFIX(SkipStructure)) {
+    TestSkipStructure<kParseDefaultFlags, StringStream>();
+    TestSkipStructure<kParseInsituFlag, InsituStringStream>();
+}
+
+TEST(SIMD, SIMD_SUFFIX(SkipStructure_Error)) {
+    // Missing quotation mark after an escape at every position in a block
+    char buffer[64 + 32];
+    for (size_t offset = 0; offset < 32; offset++) {
+        for (size_t step = 0; step < 48; step++) {
+            char* json = buffer + offset;
+            char* p = json;
+            *p++ = '{'; *p++ = '"'; *p++ = 'x'; *p++ = '"'; *p++ = ':'; *p++ = '"';
+            for (size_t i = 0; i < step; i++)
+                *p++ = 'A';
+            *p++ = '\\';
+            *p = '\0';
+
+            StringStream s(json);
+            Reader reader;
+            SimdSkipValueHandler h;
+            reader.Parse<kParseSkipValueFlag>(s, h);
+            EXPECT_EQ(kParseErrorStringMissQuotationMark, reader.GetParseErrorCode());
+            EXPECT_EQ(static_cast<size_t>(p - json), reader.GetErrorOffset());
+        }
+    }
+}
+
+// Byte by byte version of internal::StructuralIndexer::Build().
+static bool StructuralIndexReference(const char* json, std::vector<uint32_t>& index) {
+    bool inString = false, escaped = false, scalar = false;
+    uint32_t i = 0;
+    for (; json[i] != '\0'; i++) {
+        const char c = json[i];
+        const bool quote = c == '"' && !escaped;
+        escaped = c == '\\' && !escaped;
+        if (inString) {
+            inString = !quote;
+            continue;
+        }
+        const bool other = !quote && c != ' ' && c != '\n' && c != '\r' && c != '\t' &&
+            c != '{' && c != '}' && c != '[' && c != ']' && c != ',' && c != ':';
+        if (quote || (c != ' ' && c != '\n' && c != '\r' && c != '\t' && (!other || !scalar)))
+            index.push_back(i);
+        inString = quote;
+        scalar = other;
+    }
+    index.push_back(i);
+    return inString;
+}
+
+TEST(SIMD, SIMD_SUFFIX(StructuralIndexer)) {
+    static const char kAlphabet[] = "\"\"\\\\\\{}[],: \n\tab01";
+    unsigned seed = 1;
+    for (size_t n = 0; n < 2000; n++) {
+        char json[300];
+        const size_t length = n % sizeof(json);
+        for (size_t i = 0; i < length; i++) {
+            seed = seed * 1103515245u + 12345u;
+            json[i] = kAlphabet[(seed >> 16) % (sizeof(kAlphabet) - 1)];
+        }
+        json[length] = '\0';
+
+        std::vector<uint32_t> expected;
+        const bool expectedInString = StructuralIndexReference(json, expected);
+
+        CrtAllocator allocator;
+        internal::Stack<CrtAllocator> index(&allocator, 0);
+        EXPECT_EQ(expectedInString, internal::StructuralIndexer::Build(json, length, index));
+        ASSERT_EQ(expected.size(), index.GetSize() / sizeof(uint32_t)) << json;
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_EQ(expected[i], index.Bottom<uint32_t>()[i]) << json;
+    }
+}
+
+TEST(SIMD, SIMD_SUFFIX(StructuralIndexParse)) {
+    std::string json = "[";
+    for (int i = 0; i < 100; i++)
+        json += "{\"a\\\\\\\"b\":[\"\\\\\\\\\",-1.5e3,true,null,{}],\"c\" : \"d\\u00e9\\\"\" } ,\n";
+    json += "[ ]]";
+
+    // Shift the text through all positions of a block.
+    for (size_t offset = 0; offset < 64; offset++) {
+        const std::string text = std::string(offset, ' ') + json;
+        StringBuffer expected, actual;
+        Writer<StringBuffer> expectedWriter(expected), actualWriter(actual);
+        Reader reader;
+        StringStream s1(text.c_str()), s2(text.c_str());
+        EXPECT_TRUE(reader.Parse(s1, expectedWriter));
+        EXPECT_TRUE(reader.Parse<kParseStructuralIndexFlag>(s2, actualWriter));
+        EXPECT_STREQ(expected.GetString(), actual.GetString());
+
+        // Misplaced characters are found at any position.
+        const std::string bad = text.substr(0, text.size() - 60) + "x" + text.substr(text.size() - 60);
+        StringStream s3(bad.c_str()), s4(bad.c_str());
+        StringBuffer b1, b2;
+        Writer<StringBuffer> w1(b1), w2(b2);
+        reader.Parse(s3, w1);
+        const ParseErrorCode code = reader.GetParseErrorCode();
+        const size_t errorOffset = reader.GetErrorOffset();
+        reader.Parse<kParseStructuralIndexFlag>(s4, w2);
+        EXPECT_EQ(code, reader.GetParseErrorCode());
+        EXPECT_EQ(errorOffset, reader.GetErrorOffset());
+    }
+}
+
+TEST(SIMD, SIMD_SUFFIX(CountDigits)) {
+    // Every alignment, run length and number of leading zeros.
+    char storage[64 + 16];
+    char* buffer = reinterpret_cast<char*>((reinterpret_cast<size_t>(storage) + 15) & ~static_cast<size_t>(15));
+    for (size_t offset = 0; offset < 16; offset++)
+        for (unsigned length = 0; length <= 20; length++)
+            for (unsigned leading = 0; leading <= length; leading += (length > 3 ? 3 : 1)) {
+                memset(buffer, 'x', 64);
+                char* p = buffer + offset;
+                for (unsigned j = 0; j < length; j++)
+                    p[j] = j < leading ? '0' : static_cast<char>('1' + (j * 7) % 9);
+                p[length] = '\0';
+
+                unsigned zeros;
+                unsigned count = internal::CountDigits(p, zeros);
+                unsigned expected = length < 16 ? length : 16;
+                EXPECT_EQ(expected, count);
+                EXPECT_EQ(leading < expected ? leading : expected, zeros);
+
+                unsigned n = count < 8 ? count : 8;
+                uint32_t value = 0;
+                for (unsigned j = 0; j < n; j++)
+                    value = value * 10 + static_cast<uint32_t>(p[j] - '0');
+                EXPECT_EQ(value, internal::ParseDigits(p, n));
+            }
+
+    EXPECT_EQ(12345678u, internal::ParseEightDigits("12345678"));
+    EXPECT_EQ(99999999u, internal::ParseEightDigits("99999999"));
+    EXPECT_EQ(0u, internal::ParseEightDigits("00000000"));
+    EXPECT_EQ(1u, internal::ParseEightDigits("00000001"));
+}
+
+struct NumberRecorder : BaseReaderHandler<UTF8<>, NumberRecorder> {
+    NumberRecorder() : numbers() {}
+    bool Int(int i) { return Add(1, static_cast<uint64_t>(static_cast<int64_t>(i))); }
+    bool Uint(unsigned u) { return Add(2, u); }
+    bool Int64(int64_t i) { return Add(3, static_cast<uint64_t>(i)); }
+    bool Uint64(uint64_t u) { return Add(4, u); }
+    bool Double(double d) { uint64_t u; memcpy(&u, &d, sizeof(u)); return Add(5, u); }
+    bool Add(int type, uint64_t bits) { numbers.push_back(std::make_pair(type, bits)); return true; }
+    std::vector<std::pair<int, uint64_t> > numbers;
+};
+
+// A stream which is not a contiguous buffer for the reader, so digits are taken one by one.
+struct ByteStream {
+    typedef char Ch;
+    ByteStream(const char* src) : src_(src), head_(src) {}
+    Ch Peek() const { return *src_; }
+    Ch Take() { return *src_++; }
+    size_t Tell() const { return static_cast<size_t>(src_ - head_); }
+    Ch* PutBegin() { RAPIDJSON_ASSERT(false); return 0; }
+    void Put(Ch) { RAPIDJSON_ASSERT(false); }
+    void Flush() { RAPIDJSON_ASSERT(false); }
+    size_t PutEnd(Ch*) { RAPIDJSON_ASSERT(false); return 0; }
+    const char* src_;
+    const char* head_;
+};
+
+template <unsigned parseFlags>
+static void TestParseNumber(const std::string& json) {
+    Reader reader;
+    NumberRecorder expected, h1, h2;
+    ByteStream bs(json.c_str());
+    ASSERT_FALSE(reader.Parse<parseFlags>(bs, expected).IsError());
+
+    StringStream ss(json.c_str());
+    EXPECT_FALSE(reader.Parse<parseFlags>(ss, h1).IsError());
+    EXPECT_TRUE(expected.numbers == h1.numbers);
+
+    std::vector<char> insitu(json.begin(), json.end());
+    insitu.push_back('\0');
+    InsituStringStream is(&insitu[0]);
+    EXPECT_FALSE(reader.Parse<parseFlags | kParseInsituFlag>(is, h2).IsError());
+    EXPECT_TRUE(expected.numbers == h2.numbers);
+}
+
+TEST(SIMD, SIMD_SUFFIX(ParseNumber)) {
+    const char* numbers[] = {
+        "0", "-0", "7", "12", "123456789", "1234567890", "4294967295", "4294967296", "-2147483648", "-2147483649",
+        "9007199254740991", "9007199254740993", "18446744073709551615", "18446744073709551616", "-9223372036854775808",
+        "-9223372036854775809", "123456789012345678901234567890", "0.0", "0.5", "-0.000001", "0.00000000000000012345678",
+        "1.2345678901234567", "3.14159265358979323846", "90071991.99999999", "90071992.12345678", "900719925474.0991",
+        "1.7976931348623157e308", "2.2250738585072014e-308", "4.9e-324", "1e-400", "123.456e-7", "-65.613616999999977",
+        "0.10000000000000000555", "100000000.000000001", "1.00000000000000000000000000001"
+    };
+
+    std::string json = "[";
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+        if (i) json += ",";
+        json += numbers[i];
+    }
+    // Every length and leading zero count of integer and fraction digits.
+    for (int intLength = 1; intLength <= 21; intLength++)
+        for (int fracLength = 0; fracLength <= 21; fracLength++)
+            for (int zeros = 0; zeros <= fracLength; zeros += 4) {
+                json += ",";
+                if ((intLength + fracLength) % 2)
+                    json += "-";
+                for (int j = 0; j < intLength; j++)
+                    json += static_cast<char>('1' + (j * 5 + fracLength) % 9);
+                if (fracLength) {
+                    json += ".";
+                    for (int j = 0; j < fracLength; j++)
+                        json += j < zeros ? '0' : static_cast<char>('0' + (j * 3 + intLength) % 10);
+                }
+            }
+    json += "]";
+
+    // Each alignment of the numbers in the buffer.
+    for (int offset = 0; offset < 16; offset++) {
+        TestParseNumber<kParseDefaultFlags>(json);
+        TestParseNumber<kParseFullPrecisionFlag>(json);
+        json.insert(json.begin(), ' ');
+    }
+}
+
 #ifdef __GNUC__
 RAPIDJSON_DIAG_POP
 #endif
@@ -15,6 +15,7 @@
 #include "unittest.h"
 
 #include "rapidjson/internal/strtod.h"
+#include <cstdio>
 
 #ifdef __clang__
 RAPIDJSON_DIAG_PUSH
@@ -127,6 +128,82 @@ TEST(Strtod, CheckApproximationCase) {
     EXPECT_EQ(-1, delta.Compare(hS));
 }
 
+// Reference conversion by DiyFp approximation, with BigInteger comparison when it is not decided.
+static double StrtodBigIntegerReference(const char* decimals, size_t length, int exp) {
+    double approx;
+    if (StrtodDiyFp(decimals, length, length, exp, &approx))
+        return approx;
+    return StrtodBigInteger(approx, decimals, length, length, exp);
+}
+
+static uint64_t StrtodEiselLemireBits(uint64_t w, int q) {
+    double d;
+    EXPECT_TRUE(StrtodEiselLemire(w, q, &d));
+    return Double(d).Uint64Value();
+}
+
+TEST(Strtod, EiselLemire) {
+    EXPECT_EQ(Double(0.0).Uint64Value(), StrtodEiselLemireBits(0, 100));
+    EXPECT_EQ(Double(1.0).Uint64Value(), StrtodEiselLemireBits(1, 0));
+    EXPECT_EQ(Double(1e23).Uint64Value(), StrtodEiselLemireBits(1, 23));
+    EXPECT_EQ(Double(3.1416).Uint64Value(), StrtodEiselLemireBits(31416, -4));
+    EXPECT_EQ(Double(9007199254740992.0).Uint64Value(), StrtodEiselLemireBits(9007199254740993u, 0)); // halfway, round to even
+    EXPECT_EQ(Double(9007199254740996.0).Uint64Value(), StrtodEiselLemireBits(9007199254740995u, 0)); // halfway, round to even
+    EXPECT_EQ(Double(1.7976931348623157e+308).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x003FDDEC, 0x7F2FAF35), 292)); // 17976931348623157e292
+    EXPECT_EQ(Double(2.2250738585072014e-308).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x004F0CED, 0xC95A718E), -324)); // min normal
+    EXPECT_EQ(Double(2.2250738585072009e-308).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x004F0CED, 0xC95A7189), -324)); // max subnormal
+    EXPECT_EQ(Double(4.9406564584124654e-324).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x00AF8702, 0x3B9BF0EE), -340)); // min subnormal
+    EXPECT_EQ(Double(0.0).Uint64Value(), StrtodEiselLemireBits(1, -342)); // underflow
+    EXPECT_EQ(Double(0.0).Uint64Value(), StrtodEiselLemireBits(99652783630921u, -338));
+    EXPECT_EQ(Double(4.9406564584124654e-324).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x0057C381, 0x1DCDF878), -340)); // 24703282292062328e-340, above half of min subnormal
+    EXPECT_EQ(Double(0.0).Uint64Value(), StrtodEiselLemireBits(RAPIDJSON_UINT64_C2(0x0057C381, 0x1DCDF877), -340)); // below half of min subnormal
+
+    double d;
+    EXPECT_FALSE(StrtodEiselLemire(18, 307, &d));   // overflow
+    EXPECT_FALSE(StrtodEiselLemire(1, 309, &d));    // out of table
+    EXPECT_EQ(Double(0.0).Uint64Value(), StrtodEiselLemireBits(~uint64_t(0), -343)); // below the table
+
+    // More than 19 digits: both the truncated significand and its successor round to the same double,
+    // or the digits after decide between them.
+    const char many[] = "31415926535897932384626";
+    EXPECT_EQ(Double(3.1415926535897932384626).Uint64Value(), Double(StrtodFullPrecision(0.0, 100, many, sizeof(many) - 1, 1, 0)).Uint64Value());
+    const char above[] = "900719925474099300000001"; // 2^53 + 1 + 10^-8, above halfway
+    EXPECT_EQ(Double(9007199254740994.0).Uint64Value(), Double(StrtodFullPrecision(0.0, 100, above, sizeof(above) - 1, 16, 0)).Uint64Value());
+    const char below[] = "900719925474099299999999"; // 2^53 + 1 - 10^-8, below halfway
+    EXPECT_EQ(Double(9007199254740992.0).Uint64Value(), Double(StrtodFullPrecision(0.0, 100, below, sizeof(below) - 1, 16, 0)).Uint64Value());
+}
+
+TEST(Strtod, EiselLemireRandom) {
+    static const unsigned count = 100000; // Tested with 100000000 locally
+    Random r;
+    unsigned fallbacks = 0;
+    for (unsigned i = 0; i < count; i++) {
+        const size_t n = 1 + r() % 19;
+        char decimals[20];
+        uint64_t significand = 0;
+        for (size_t j = 0; j < n; j++) {
+            decimals[j] = static_cast<char>((j == 0 ? '1' + r() % 9 : '0' + r() % 10));
+            significand = significand * 10 + static_cast<unsigned>(decimals[j] - '0');
+        }
+        decimals[n] = '\0';
+        const int exp = static_cast<int>(r() % 620) - 325;
+        if (int(n) + exp < -306 || int(n) + exp > 308) // the reference does not handle deep subnormals
+            continue;
+
+        double expected = StrtodBigIntegerReference(decimals, n, exp);
+
+        double actual;
+        if (!StrtodEiselLemire(significand, exp, &actual)) {
+            fallbacks++;
+            continue;
+        }
+        EXPECT_EQ(Double(expected).Uint64Value(), Double(actual).Uint64Value());
+        if (Double(expected).Uint64Value() != Double(actual).Uint64Value())
+            printf("  String: %se%d\n  Actual: %.17g\nExpected: %.17g\n", decimals, exp, actual, expected);
+    }
+    EXPECT_LT(fallbacks, count / 1000);
+}
+
 #ifdef __clang__
 RAPIDJSON_DIAG_POP
 #endif
@@ -0,0 +1,283 @@
+// Tencent is pleased to support the open source community by making RapidJSON available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company, and Milo Yip. All rights reserved.
+//
+// Licensed under the MIT License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// http://opensource.org/licenses/MIT
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#define UNITTEST_STRINGIFY
+#include "unittest.h"
+#include "rapidjson/tapedocument.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include <string>
+
+using namespace rapidjson;
+
+TEST(TapeDocument, Parse) {
+    TapeDocument d;
+    EXPECT_TRUE(d.IsNull());
+
+    d.Parse("{ \"hello\" : \"world\", \"t\" : true , \"f\" : false, \"n\": null, \"i\":123, \"pi\": 3.1416, \"a\":[1, 2, 3, 4], \"o\":{}, \"e\":[] } ");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_TRUE(d.IsObject());
+    EXPECT_EQ(kObjectType, d.GetType());
+    EXPECT_EQ(9u, d.MemberCount());
+    EXPECT_FALSE(d.ObjectEmpty());
+
+    EXPECT_TRUE(d.HasMember("hello"));
+    EXPECT_FALSE(d.HasMember("hell"));
+    EXPECT_FALSE(d.HasMember("hello2"));
+    const TapeValue hello = d["hello"];
+    EXPECT_TRUE(hello.IsString());
+    EXPECT_STREQ("world", hello.GetString());
+    EXPECT_EQ(5u, hello.GetStringLength());
+
+    EXPECT_TRUE(d["t"].IsTrue());
+    EXPECT_TRUE(d["t"].GetBool());
+    EXPECT_TRUE(d["f"].IsFalse());
+    EXPECT_TRUE(d["f"].IsBool());
+    EXPECT_FALSE(d["f"].GetBool());
+    EXPECT_TRUE(d["n"].IsNull());
+    EXPECT_EQ(kNullType, d["n"].GetType());
+
+    EXPECT_TRUE(d["i"].IsNumber());
+    EXPECT_EQ(kNumberType, d["i"].GetType());
+    EXPECT_EQ(123, d["i"].GetInt());
+    EXPECT_TRUE(d["pi"].IsDouble());
+    EXPECT_DOUBLE_EQ(3.1416, d["pi"].GetDouble());
+
+    const TapeValue a = d["a"];
+    EXPECT_TRUE(a.IsArray());
+    EXPECT_EQ(4u, a.Size());
+    EXPECT_FALSE(a.Empty());
+    for (SizeType i = 0; i < 4; i++)
+        EXPECT_EQ(i + 1, a[i].GetUint());
+    unsigned sum = 0;
+    for (TapeValue::ConstValueIterator v = a.Begin(); v != a.End(); v++)
+        sum += v->GetUint();
+    EXPECT_EQ(10u, sum);
+
+    EXPECT_TRUE(d["o"].IsObject());
+    EXPECT_TRUE(d["o"].ObjectEmpty());
+    EXPECT_EQ(0u, d["o"].MemberCount());
+    EXPECT_TRUE(d["o"].MemberBegin() == d["o"].MemberEnd());
+    EXPECT_TRUE(d["e"].Empty());
+    EXPECT_EQ(0u, d["e"].Size());
+    EXPECT_TRUE(d["e"].Begin() == d["e"].End());
+
+    const char* names[] = { "hello", "t", "f", "n", "i", "pi", "a", "o", "e" };
+    SizeType i = 0;
+    for (TapeValue::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m, ++i)
+        EXPECT_STREQ(names[i], m->name.GetString());
+    EXPECT_EQ(9u, i);
+
+    TapeValue::ConstMemberIterator m = d.FindMember("pi");
+    ASSERT_TRUE(m != d.MemberEnd());
+    EXPECT_STREQ("pi", (*m).name.GetString());
+    EXPECT_TRUE(d.FindMember("x") == d.MemberEnd());
+    EXPECT_TRUE(d.FindMember(Value("a")) != d.MemberEnd());
+#if RAPIDJSON_HAS_STDSTRING
+    EXPECT_TRUE(d.HasMember(std::string("hello")));
+    EXPECT_TRUE(d[std::string("a")].IsArray());
+#endif
+}
+
+TEST(TapeDocument, Nested) {
+    const char json[] = "{\"a\":[[1,{\"b\":[2,[]]},3],{}],\"c\":{\"d\":{\"e\":-1.5e300}},\"f\":\"g\"}";
+    TapeDocument d;
+    d.Parse(json);
+    ASSERT_TRUE(d.IsObject());
+    EXPECT_EQ(3u, d.MemberCount());
+    EXPECT_EQ(2u, d["a"].Size());
+    EXPECT_EQ(3u, d["a"][0].Size());
+    EXPECT_EQ(3, d["a"][0][2].GetInt());
+    EXPECT_EQ(2, d["a"][0][1]["b"][0].GetInt());
+    EXPECT_TRUE(d["a"][0][1]["b"][1].Empty());
+    EXPECT_TRUE(d["a"][1].ObjectEmpty());
+    EXPECT_EQ(-1.5e300, d["c"]["d"]["e"].GetDouble());
+    EXPECT_STREQ("g", d["f"].GetString());
+    EXPECT_EQ(json, Stringify(d));
+    EXPECT_EQ("{\"b\":[2,[]]}", Stringify(d["a"][0][1]));
+}
+
+TEST(TapeDocument, Numbers) {
+    const char* numbers[] = {
+        "0", "-1", "2147483647", "-2147483648", "2147483648", "4294967295", "4294967296", "-2147483649",
+        "9223372036854775807", "-9223372036854775808", "9223372036854775808", "18446744073709551615",
+        "1.5", "-0.0", "1e308", "123456789012345678901234567890"
+    };
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+        Document d;
+        d.Parse(numbers[i]);
+        TapeDocument t;
+        t.Parse(numbers[i]);
+        ASSERT_TRUE(t.IsNumber()) << numbers[i];
+        EXPECT_EQ(d.IsInt(), t.IsInt()) << numbers[i];
+        EXPECT_EQ(d.IsUint(), t.IsUint()) << numbers[i];
+        EXPECT_EQ(d.IsInt64(), t.IsInt64()) << numbers[i];
+        EXPECT_EQ(d.IsUint64(), t.IsUint64()) << numbers[i];
+        EXPECT_EQ(d.IsDouble(), t.IsDouble()) << numbers[i];
+        if (d.IsInt())
+            EXPECT_EQ(d.GetInt(), t.GetInt());
+        if (d.IsUint())
+            EXPECT_EQ(d.GetUint(), t.GetUint());
+        if (d.IsInt64())
+            EXPECT_EQ(d.GetInt64(), t.GetInt64());
+        if (d.IsUint64())
+            EXPECT_EQ(d.GetUint64(), t.GetUint64());
+        EXPECT_EQ(d.GetDouble(), t.GetDouble()) << numbers[i];
+        EXPECT_EQ(Stringify(d), Stringify(t));
+    }
+
+}
+
+TEST(TapeDocument, Strings) {
+    TapeDocument d;
+    d.Parse("[\"\", \"a\\u0000b\", \"\\u00e9t\\u00e9\", \"abc\", \"abcd\"]");
+    ASSERT_TRUE(d.IsArray());
+    EXPECT_EQ(0u, d[0].GetStringLength());
+    EXPECT_STREQ("", d[0].GetString());
+    EXPECT_EQ(3u, d[1].GetStringLength());
+    EXPECT_EQ(0, memcmp("a\0b", d[1].GetString(), 4));
+    EXPECT_STREQ("\xC3\xA9t\xC3\xA9", d[2].GetString());
+    EXPECT_STREQ("abc", d[3].GetString());
+    EXPECT_STREQ("abcd", d[4].GetString());
+
+    // Lengths around the strings stored in the word, as values and names.
+    d.Parse("{\"\":0,\"a\":1,\"ab\":2,\"abc\":3,\"abcd\":4,\"abcde\":5,\"abcdef\":6,\"abcdefg\":7,\"abcdefgh\":8,"
+        "\"s\":[\"abcde\",\"abcdef\",\"abcdefg\"]}");
+    ASSERT_TRUE(d.IsObject());
+    const char name[] = "abcdefgh";
+    for (SizeType i = 0; i <= 8; i++) {
+        TapeValue::ConstMemberIterator m = d.FindMember(name, i);
+        ASSERT_TRUE(m != d.MemberEnd());
+        EXPECT_EQ(i, m->name.GetStringLength());
+        EXPECT_EQ(0, memcmp(name, m->name.GetString(), i));
+        EXPECT_EQ('\0', m->name.GetString()[i]);
+        EXPECT_EQ(i, m->value.GetUint());
+    }
+    EXPECT_FALSE(d.HasMember("abcdefghi"));
+    EXPECT_FALSE(d.HasMember("b"));
+    EXPECT_FALSE(d.HasMember("abcdeg"));
+    EXPECT_STREQ("abcde", d["s"][0].GetString());
+    EXPECT_STREQ("abcdef", d["s"][1].GetString());
+    EXPECT_EQ(6u, d["s"][1].GetStringLength());
+    EXPECT_STREQ("abcdefg", d["s"][2].GetString());
+    EXPECT_EQ(7u, d["s"][2].GetStringLength());
+
+    // Numbers as strings
+    d.Parse<kParseNumbersAsStringsFlag>("[1.50]");
+    EXPECT_STREQ("1.50", d[0].GetString());
+}
+
+TEST(TapeDocument, Size) {
+    TapeDocument d;
+    d.Parse("[1,-2,3.5,\"abc\",\"abcdefg\"]");
+    // Array, 1, -2, 3.5 on two words, strings
+    EXPECT_EQ(7 * sizeof(uint64_t), d.GetTapeSize());
+    // Length, "abcdefg" and terminator, while "abc" is in its word
+    EXPECT_EQ(sizeof(SizeType) + 8, d.GetStringBufferSize());
+
+    // A fraction of the memory of a Document.
+    StringBuffer json;
+    Writer<StringBuffer> writer(json);
+    writer.StartArray();
+    for (int i = 0; i < 1000; i++) {
+        writer.StartObject();
+        writer.Key("id");
+        writer.Int(i);
+        writer.Key("name");
+        writer.String("name");
+        writer.Key("flag");
+        writer.Bool(true);
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    d.Parse(json.GetString());
+    Document doc;
+    doc.Parse(json.GetString());
+    EXPECT_LT(d.GetTapeSize() + d.GetStringBufferSize(), doc.GetAllocator().Size() * 2 / 3);
+    EXPECT_EQ(json.GetString(), Stringify(d));
+}
+
+TEST(TapeDocument, ParseError) {
+    TapeDocument d;
+    d.Parse("[1, 2]");
+    EXPECT_TRUE(d.IsArray());
+
+    const char* errors[] = { "", "[1, 2", "{\"a\" 1}", "[1] 2", "{\"a\":[1,{\"b\":tru}]}" };
+    for (size_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++) {
+        Document expected;
+        expected.Parse(errors[i]);
+        d.Parse(errors[i]);
+        EXPECT_TRUE(d.HasParseError());
+        EXPECT_EQ(expected.GetParseError(), d.GetParseError());
+        EXPECT_EQ(expected.GetErrorOffset(), d.GetErrorOffset());
+        ParseResult r = d;
+        EXPECT_EQ(expected.GetParseError(), r.Code());
+        EXPECT_TRUE(d.IsNull());
+        EXPECT_EQ(0u, d.GetTapeSize());
+    }
+
+    // The document is reusable after an error.
+    d.Parse("{\"a\":1}");
+    EXPECT_FALSE(d.HasParseError());
+    EXPECT_EQ(1, d["a"].GetInt());
+}
+
+TEST(TapeDocument, Reparse) {
+    TapeDocument d;
+    d.Parse("[\"first\"]");
+    EXPECT_STREQ("first", d[0].GetString());
+    d.Parse("{\"second\":[2]}");
+    EXPECT_EQ(2, d["second"][0].GetInt());
+    d.Parse("3", 1);
+    EXPECT_EQ(3, d.GetInt());
+#if RAPIDJSON_HAS_STDSTRING
+    d.Parse(std::string("[4]"));
+    EXPECT_EQ(4, d[0].GetInt());
+#endif
+}
+
+struct StopHandler : BaseReaderHandler<UTF8<>, StopHandler> {
+    StopHandler() : count() {}
+    bool Default() { return ++count < 5; }
+    int count;
+};
+
+TEST(TapeDocument, Accept) {
+    const char json[] = "{\"hello\":\"world\",\"t\":true,\"f\":false,\"n\":null,\"i\":123,\"u\":4294967295,\"i64\":-9223372036854775808,\"u64\":18446744073709551615,\"pi\":3.1416,\"a\":[1,2,3,4,[]],\"o\":{\"p\":{}}}";
+    TapeDocument d;
+    d.Parse(json);
+    EXPECT_EQ(json, Stringify(d));
+
+    // Accept stops when the handler does.
+    StopHandler stop;
+    EXPECT_FALSE(d.Accept(stop));
+    EXPECT_EQ(5, stop.count);
+}
+
+TEST(TapeDocument, UTF16) {
+    typedef GenericTapeDocument<UTF16<> > TapeDocumentU16;
+    TapeDocumentU16 d;
+    d.Parse(L"{\"hello\":\"world\",\"a\":[1,\"\\u00e9\"]}");
+    ASSERT_TRUE(d.IsObject());
+    EXPECT_TRUE(d.HasMember(L"hello"));
+    EXPECT_EQ(5u, d[L"hello"].GetStringLength());
+    EXPECT_EQ(0, memcmp(L"world", d[L"hello"].GetString(), 6 * sizeof(wchar_t)));
+    EXPECT_EQ(1u, d[L"a"][1].GetStringLength());
+    EXPECT_EQ(0xE9, d[L"a"][1].GetString()[0]);
+
+    // Transcoded from UTF-8
+    d.Parse<kParseDefaultFlags, UTF8<> >("[\"\xC3\xA9\"]");
+    EXPECT_EQ(0xE9, d[0].GetString()[0]);
+}
@@ -45,7 +45,9 @@
 #endif
 
 #include "gtest/gtest.h"
+#include <cstdio>
 #include <stdexcept>
+#include <string>
 
 #if defined(__clang__) || defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
 #pragma GCC diagnostic pop
@@ -132,4 +134,38 @@ private:
     unsigned mSeed;
 };
 
+//! \c count JSON objects of increasing \c "id", each on one line, joined by \c separator.
+/*! The strings of the objects contain escaped quotes and backslashes, brackets and commas,
+    like the features of a GeoJSON FeatureCollection with some unusual names. */
+inline std::string MakeFeatures(size_t count, const char* separator) {
+    std::string json;
+    for (size_t i = 0; i < count; i++) {
+        const unsigned id = static_cast<unsigned>(i);
+        char feature[256];
+        sprintf(feature, "%s{\"id\":%u,\"type\":\"Feature\",\"properties\":{\"name\":\"f[%u], {\\\"q\\\\\\\\\\\"}\","
+            "\"tags\":[\"\\\\\",\",]\"]},\"geometry\":{\"type\":\"Point\",\"coordinates\":[%u.5,-1.25]},\"empty\":{}}",
+            i ? separator : "", id, id, id);
+        json += feature;
+    }
+    return json;
+}
+
+// Stringify() needs rapidjson/writer.h, which fixes the configuration of
+// RapidJSON, so it is only declared if UNITTEST_STRINGIFY is defined before
+// including this header.
+#ifdef UNITTEST_STRINGIFY
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include <string>
+
+//! Writes a value providing Accept(), like GenericValue, as compact JSON.
+template <typename T>
+inline std::string Stringify(const T& value) {
+    RAPIDJSON_NAMESPACE::StringBuffer buffer;
+    RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    return buffer.GetString();
+}
+#endif
+
 #endif // UNITTEST_H_
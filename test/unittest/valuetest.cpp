@@ -15,6 +15,7 @@
 #include "unittest.h"
 #include "rapidjson/document.h"
 #include <algorithm>
+#include <string>
 
 #ifdef __clang__
 RAPIDJSON_DIAG_PUSH
@@ -1135,6 +1136,93 @@ TEST(Value, ArrayHelperRangeFor) {
 }
 #endif
 
+TEST(Value, PackedArray) {
+    Value::AllocatorType allocator;
+    const double doubles[] = { 1.5, -2.0, 1e300 };
+    Value x;
+    x.SetDoubleArray(doubles, 3, allocator);
+    EXPECT_TRUE(x.IsArray());
+    EXPECT_EQ(kArrayType, x.GetType());
+    EXPECT_TRUE(x.IsPackedArray());
+    EXPECT_TRUE(x.IsDoubleArray());
+    EXPECT_FALSE(x.IsInt64Array());
+    EXPECT_FALSE(x.IsDouble());
+    EXPECT_EQ(3u, x.Size());
+    EXPECT_EQ(3u, x.Capacity());
+    EXPECT_EQ(-2.0, x.GetDoubleArray()[1]);
+
+    // Comparisons and copies keep the array packed.
+    Value y(kArrayType);
+    y.PushBack(1.5, allocator).PushBack(-2.0, allocator).PushBack(1e300, allocator);
+    EXPECT_TRUE(x == y);
+    EXPECT_TRUE(y == x);
+    y[1].SetDouble(2.0);
+    EXPECT_TRUE(x != y);
+    Value z(x, allocator);
+    EXPECT_TRUE(z.IsDoubleArray());
+    EXPECT_TRUE(z == x);
+
+    // Const access does not unpack it.
+    const Value& cx = x;
+    EXPECT_EQ(1e300, cx[2].GetDouble());
+    EXPECT_TRUE(cx[0].IsDouble());
+    SizeType count = 0;
+    for (Value::ConstValueIterator it = cx.Begin(); it != cx.End(); ++it)
+        count += it->IsDouble() ? 1u : 0u;
+    EXPECT_EQ(3u, count);
+    EXPECT_EQ(-2.0, cx.GetArray()[1].GetDouble());
+    EXPECT_EQ(3, cx.GetArray().End() - cx.GetArray().Begin());
+    EXPECT_TRUE(x.IsPackedArray());
+    EXPECT_EQ(-2.0, x.GetDoubleArray()[1]);
+    EXPECT_TRUE(z == x);
+
+    // Non-const access unpacks it, into the values of the const access.
+    const Value* element = &cx[2];
+    EXPECT_EQ(1e300, x[2].GetDouble());
+    EXPECT_FALSE(x.IsPackedArray());
+    EXPECT_EQ(element, &x[2]);
+    EXPECT_EQ(1e300, cx[2].GetDouble());
+    EXPECT_TRUE(x[0].IsDouble());
+    EXPECT_TRUE(z == x);
+    z.PushBack(4, allocator);
+    EXPECT_FALSE(z.IsPackedArray());
+    EXPECT_EQ(4u, z.Size());
+    EXPECT_EQ(4, z[3].GetInt());
+
+    const int64_t ints[] = { 1, -1, static_cast<int64_t>(RAPIDJSON_UINT64_C2(0x7FFFFFFF, 0xFFFFFFFF)) };
+    x.SetInt64Array(ints, 3, allocator);
+    EXPECT_TRUE(x.IsInt64Array());
+    EXPECT_EQ(-1, x.GetInt64Array()[1]);
+    z.SetArray().PushBack(1, allocator).PushBack(-1, allocator).PushBack(ints[2], allocator);
+    EXPECT_TRUE(z == x);
+    x.PopBack();
+    EXPECT_FALSE(x.IsPackedArray());
+    EXPECT_EQ(2u, x.Size());
+    EXPECT_TRUE(x[0].IsInt());
+    EXPECT_TRUE(x[0].IsUint());
+
+    x.SetInt64Array(ints, 3, allocator);
+    x.Clear();
+    EXPECT_TRUE(x.Empty());
+    x.SetDoubleArray(doubles, 0, allocator);
+    EXPECT_TRUE(x.IsArray());
+    EXPECT_FALSE(x.IsPackedArray());
+
+    // Unpacked with a CrtAllocator, and freed, also after const access.
+    typedef GenericValue<UTF8<>, CrtAllocator> CrtValue;
+    CrtAllocator crt;
+    CrtValue c;
+    c.SetDoubleArray(doubles, 3, crt);
+    CrtValue c2(c, crt);
+    const CrtValue& cc = c;
+    const CrtValue& cc2 = c2;
+    EXPECT_EQ(-2.0, cc[1].GetDouble());
+    EXPECT_EQ(-2.0, c[1].GetDouble());
+    EXPECT_TRUE(c2.IsDoubleArray());
+    EXPECT_EQ(1e300, cc2[2].GetDouble());
+    EXPECT_TRUE(c2.IsDoubleArray());
+}
+
 template <typename T, typename Allocator>
 static void TestObject(T& x, Allocator& allocator) {
     const T& y = x; // const version
@@ -1537,6 +1625,187 @@ TEST(Value, EraseMember_String) {
     EXPECT_TRUE(x.MemberBegin() == x.MemberEnd());
 }
 
+// Checks FindMember() against a scan of all members.
+static void CheckMembers(const Value& x, SizeType maxName) {
+    for (SizeType i = 0; i < maxName; i++) {
+        char name[16];
+        sprintf(name, "key%u", i);
+        Value::ConstMemberIterator expected = x.MemberBegin();
+        while (expected != x.MemberEnd() && strcmp(expected->name.GetString(), name) != 0)
+            ++expected;
+        EXPECT_TRUE(expected == x.FindMember(name)) << name;
+    }
+}
+
+TEST(Value, MemberHash) {
+    Value::AllocatorType allocator;
+    Value x(kObjectType);
+    static const SizeType n = 1000;
+    for (SizeType i = 0; i < n; i++) {
+        char name[16];
+        sprintf(name, "key%u", i);
+        Value v(name, allocator);
+        x.AddMember(v, Value(i).Move(), allocator);
+        if (i % 97 == 0)
+            CheckMembers(x, n);
+    }
+    EXPECT_EQ(n, x.MemberCount());
+    for (SizeType i = 0; i < n; i++) {
+        char name[16];
+        sprintf(name, "key%u", i);
+        ASSERT_TRUE(x.HasMember(name));
+        EXPECT_EQ(i, x[name].GetUint());
+    }
+    EXPECT_FALSE(x.HasMember("key"));
+    EXPECT_FALSE(x.HasMember(Value("key1\0", 5).Move()));
+
+    // RemoveMember() moves the last member
+    for (SizeType i = 0; i < n; i += 3) {
+        char name[16];
+        sprintf(name, "key%u", i);
+        EXPECT_TRUE(x.RemoveMember(name));
+        EXPECT_FALSE(x.RemoveMember(name));
+    }
+    CheckMembers(x, n);
+
+    // EraseMember() keeps the order
+    x.EraseMember(x.MemberBegin() + 10, x.MemberBegin() + 100);
+    EXPECT_TRUE(x.EraseMember("key1"));
+    CheckMembers(x, n);
+
+    // Shrink below the threshold and add again
+    x.EraseMember(x.MemberBegin(), x.MemberEnd() - 5);
+    EXPECT_EQ(5u, x.MemberCount());
+    CheckMembers(x, n);
+    x.AddMember("key1", "again", allocator);
+    EXPECT_STREQ("again", x["key1"].GetString());
+
+    x.RemoveAllMembers();
+    CheckMembers(x, n);
+    x.AddMember("key2", 2, allocator);
+    EXPECT_EQ(2, x["key2"].GetInt());
+
+    // Copies and parsed objects are indexed too.
+    Value y(kObjectType);
+    for (SizeType i = 0; i < 100; i++) {
+        char name[16];
+        sprintf(name, "key%u", i);
+        Value v(name, allocator);
+        y.AddMember(v, Value(i).Move(), allocator);
+    }
+    Value z(y, allocator);
+    CheckMembers(z, 200);
+    EXPECT_TRUE(z == y);
+
+    Document d;
+    d.Parse("{\"key0\":0,\"key1\":1,\"key2\":2,\"key3\":3,\"key4\":4,\"key5\":5,\"key6\":6,\"key7\":7,\"key8\":8,\"key9\":9,"
+        "\"key10\":10,\"key11\":11,\"key12\":12,\"key13\":13,\"key14\":14,\"key15\":15,\"key16\":16,\"key17\":17,\"key18\":18,\"key19\":19,"
+        "\"key20\":20,\"key21\":21,\"key22\":22,\"key23\":23,\"key24\":24,\"key25\":25,\"key26\":26,\"key27\":27,\"key28\":28,\"key29\":29,"
+        "\"key30\":30,\"key31\":31,\"key32\":32,\"key1\":-1}");
+    EXPECT_EQ(34u, d.MemberCount());
+    CheckMembers(d, 40);
+    EXPECT_EQ(1, d["key1"].GetInt());  // First of duplicated names
+}
+
+// An object with names k00 to k39 in order, indexed when parsed.
+static void ParseIndexedObject(Document& d) {
+    std::string json = "{";
+    for (int i = 0; i < 40; i++) {
+        char member[16];
+        sprintf(member, "%s\"k%02d\":%d", i ? "," : "", i, i);
+        json += member;
+    }
+    d.Parse((json + "}").c_str());
+    ASSERT_FALSE(d.HasParseError());
+}
+
+// Checks that all the names k00 to k39 are found, with the const and non-const lookups.
+static void CheckIndexedObject(Document& d, const char* except = 0) {
+    const Document& c = d;
+    for (int i = 0; i < 40; i++) {
+        char name[4];
+        sprintf(name, "k%02d", i);
+        if (except && strcmp(name, except) == 0) {
+            EXPECT_FALSE(c.HasMember(name)) << name;
+            EXPECT_FALSE(d.HasMember(name)) << name;
+            continue;
+        }
+        ASSERT_TRUE(c.HasMember(name)) << name;
+        EXPECT_EQ(i, c[name].GetInt()) << name;
+        ASSERT_TRUE(d.HasMember(name)) << name;
+        EXPECT_EQ(i, d[name].GetInt()) << name;
+    }
+}
+
+#if RAPIDJSON_HAS_CXX11_RVALUE_REFS
+struct MemberNameGreater {
+    bool operator()(const Value::Member& lhs, const Value::Member& rhs) const {
+        return strcmp(lhs.name.GetString(), rhs.name.GetString()) > 0;
+    }
+};
+
+TEST(Value, MemberHash_Sort) {
+    Document d;
+    ParseIndexedObject(d);
+    std::sort(d.MemberBegin(), d.MemberEnd(), MemberNameGreater());
+    EXPECT_STREQ("k39", d.MemberBegin()->name.GetString());
+    CheckIndexedObject(d);
+    EXPECT_FALSE(d.HasMember("k40"));
+
+    // Removing a moved member before any lookup.
+    std::reverse(d.MemberBegin(), d.MemberEnd());
+    d.RemoveMember(d.MemberBegin() + 5);
+    CheckIndexedObject(d, "k05");
+}
+#endif
+
+TEST(Value, MemberHash_Rename) {
+    Document d;
+    ParseIndexedObject(d);
+    d.MemberBegin()->name.SetString("renamed", d.GetAllocator());
+    EXPECT_TRUE(static_cast<const Document&>(d).HasMember("renamed"));
+    EXPECT_TRUE(d.HasMember("renamed"));
+    EXPECT_EQ(0, d["renamed"].GetInt());
+    EXPECT_FALSE(d.HasMember("k00"));
+    d.MemberBegin()->name.SetString("k00", d.GetAllocator());
+    CheckIndexedObject(d);
+    EXPECT_FALSE(d.HasMember("renamed"));
+
+    // Through the iterator of a non-const FindMember()
+    d.FindMember("k01")->name.SetString("one", d.GetAllocator());
+    EXPECT_TRUE(d.HasMember("one"));
+    EXPECT_FALSE(d.HasMember("k01"));
+    EXPECT_EQ(1, d["one"].GetInt());
+    EXPECT_TRUE(d.RemoveMember("one"));
+    CheckIndexedObject(d, "k01");
+}
+
+TEST(Value, MemberHash_Erase) {
+    // Swap the members in reverse order, then remove and erase them without a lookup in between.
+    Document d;
+    ParseIndexedObject(d);
+    for (Value::MemberIterator a = d.MemberBegin(), b = d.MemberEnd() - 1; a < b; ++a, --b) {
+        a->name.Swap(b->name);
+        a->value.Swap(b->value);
+    }
+    d.RemoveMember(d.MemberBegin());     // k39, replaced by k00
+    CheckIndexedObject(d, "k39");
+    EXPECT_STREQ("k00", d.MemberBegin()->name.GetString());
+
+    d.MemberBegin()->name.Swap((d.MemberBegin() + 1)->name);
+    d.MemberBegin()->value.Swap((d.MemberBegin() + 1)->value);
+    d.RemoveMember(d.MemberBegin() + 1);    // k00, replaced by the last member
+    d.EraseMember(d.MemberBegin());     // k38
+    EXPECT_TRUE(d.EraseMember("k10"));
+    EXPECT_FALSE(d.EraseMember("k10"));
+    EXPECT_EQ(36u, d.MemberCount());
+    for (Value::ConstMemberIterator m = d.MemberBegin(); m != d.MemberEnd(); ++m)
+        EXPECT_TRUE(d.FindMember(m->name) == m) << m->name.GetString();
+    EXPECT_FALSE(d.HasMember("k00"));
+    EXPECT_FALSE(d.HasMember("k38"));
+    EXPECT_FALSE(d.HasMember("k39"));
+}
+
 TEST(Value, BigNestedArray) {
     MemoryPoolAllocator<> allocator;
     Value x(kArrayType);
@@ -108,6 +108,77 @@ TEST(Writer, ScanWriteUnescapedString) {
     }
 }
 
+// Expected output of a valid UTF-8 string, with non-ASCII characters escaped for ASCII.
+static std::string EscapeString(const std::string& str, bool ascii) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    std::string result = "\"";
+    StringStream is(str.c_str());
+    while (is.Tell() < str.size()) {
+        const unsigned char c = static_cast<unsigned char>(is.Peek());
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += static_cast<char>(is.Take());
+        }
+        else if (c < 0x20 || (ascii && c >= 0x80)) {
+            unsigned codepoint;
+            EXPECT_TRUE(UTF8<>::Decode(is, &codepoint));
+            unsigned units[2] = { codepoint, 0 };
+            if (codepoint >= 0x10000) {
+                units[0] = 0xD800 + ((codepoint - 0x10000) >> 10);
+                units[1] = 0xDC00 + ((codepoint - 0x10000) & 0x3FF);
+            }
+            for (size_t i = 0; i < 2 && units[i]; i++) {
+                const char* named = strchr("\b\t\n\f\r", static_cast<int>(units[i]));
+                result += '\\';
+                if (units[i] != 0 && named)
+                    result += "btnfr"[named - "\b\t\n\f\r"];
+                else {
+                    result += 'u';
+                    for (int shift = 12; shift >= 0; shift -= 4)
+                        result += hexDigits[(units[i] >> shift) & 15];
+                }
+            }
+        }
+        else
+            result += static_cast<char>(is.Take());
+    }
+    return result + "\"";
+}
+
+template <typename TargetEncoding, unsigned writeFlags, typename OutputStream>
+static std::string WriteString(OutputStream& os, const std::string& str) {
+    Writer<OutputStream, UTF8<>, TargetEncoding, CrtAllocator, writeFlags> writer(os);
+    EXPECT_TRUE(writer.String(str.c_str(), static_cast<SizeType>(str.size())));
+    return std::string(os.GetString());
+}
+
+TEST(Writer, ScanWriteUnescapedStringBulk) {
+    // Runs of characters written at once, up to escapes and non-ASCII characters at all positions of a block.
+    static const char* const pieces[] = { "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9D\x84\x9E", "\"", "\\", "\n", "\x1F", "/", "\x7F" };
+    for (size_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); i++)
+        for (size_t before = 0; before < 70; before += (before < 40 ? 1 : 7)) {
+            std::string str(before, 'a');
+            str += pieces[i];
+            str += std::string(before % 33, 'b') + pieces[(i + 1) % (sizeof(pieces) / sizeof(pieces[0]))] + "c";
+
+            StringBuffer b1, b2, b3;
+            EXPECT_EQ(EscapeString(str, false), (WriteString<UTF8<>, kWriteNoFlags>(b1, str)));
+            EXPECT_EQ(EscapeString(str, false), (WriteString<UTF8<>, kWriteValidateEncodingFlag>(b2, str)));
+            EXPECT_EQ(EscapeString(str, true), (WriteString<ASCII<>, kWriteNoFlags>(b3, str)));
+
+            GenericStringBuffer<UTF8<>, MemoryPoolAllocator<> > b4;
+            EXPECT_EQ(EscapeString(str, true), (WriteString<ASCII<>, kWriteValidateEncodingFlag>(b4, str)));
+
+            // Invalid UTF-8 after a long run.
+            Writer<StringBuffer, UTF8<>, UTF8<>, CrtAllocator, kWriteValidateEncodingFlag> writer(b1);
+            b1.Clear();
+            EXPECT_FALSE(writer.String((str + "\xE2\x82").c_str()));
+            writer.Reset(b1);
+            b1.Clear();
+            EXPECT_FALSE(writer.String((str + "\xED\xA0\x80 ").c_str()));
+        }
+}
+
 TEST(Writer, Double) {
     TEST_ROUNDTRIP("[1.2345,1.2345678,0.123456789012,1234567.8]");
     TEST_ROUNDTRIP("0.0");